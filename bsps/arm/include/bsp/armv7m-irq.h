@@ -17,12 +17,100 @@
 #ifndef LIBBSP_ARM_SHARED_ARMV7M_IRQ_H
 #define LIBBSP_ARM_SHARED_ARMV7M_IRQ_H
 
+#include <rtems.h>
+#include <rtems/score/armv7m.h>
+
 #ifdef __cplusplus
 extern "C" {
 #endif
 
 void _ARMV7M_NVIC_Interrupt_dispatch(void);
 
+#ifdef ARM_MULTILIB_ARCH_V7M
+
+/**
+ * @brief Installs a direct handler for the interrupt vector.
+ *
+ * The handler is written into the RAM vector table, so the processor enters
+ * it without _ARMV7M_NVIC_Interrupt_dispatch(), the interrupt entry list and
+ * the interrupt service enter and leave bookkeeping.  The hardware stacks the
+ * caller-saved registers, so an ordinary C function may be used as handler.
+ *
+ * A direct handler is invisible to RTEMS.  The interrupt nest level is not
+ * incremented, rtems_interrupt_is_in_progress() returns false and no thread
+ * dispatch follows the handler.  So a direct handler
+ *
+ * - may access device registers and variables shared with threads through
+ *   atomic operations or single producer/single consumer buffers,
+ *
+ * - may use armv7m_interrupt_direct_defer() to hand off work to a vector
+ *   which has handlers installed by rtems_interrupt_handler_install(), these
+ *   handlers may use the directives allowed in interrupt context,
+ *
+ * - must not call any other RTEMS directive, in particular no directive
+ *   which may block, unblock a thread or print, and no memory allocation.
+ *
+ * Priorities numerically below 0x80 are not masked by
+ * rtems_interrupt_disable(), so the latency of such a direct handler is
+ * bounded by the hardware only.  Priorities of 0x80 or above are masked by
+ * the RTEMS critical sections like the generic interrupt handlers.
+ *
+ * Handlers installed by rtems_interrupt_handler_install() are not called
+ * while a direct handler is installed.
+ *
+ * @param vector is the interrupt vector number, i.e. the NVIC interrupt
+ *   number.
+ * @param priority is the NVIC priority.
+ * @param handler is the direct handler.
+ *
+ * @retval RTEMS_SUCCESSFUL Successful operation.
+ * @retval RTEMS_INCORRECT_STATE The interrupt support was not initialized.
+ * @retval RTEMS_INVALID_ADDRESS The handler was NULL.
+ * @retval RTEMS_INVALID_ID The vector number was invalid.
+ * @retval RTEMS_CALLED_FROM_ISR The function was called from interrupt
+ *   context.
+ * @retval RTEMS_RESOURCE_IN_USE The vector has already a direct handler or
+ *   handlers installed by rtems_interrupt_handler_install().
+ */
+rtems_status_code armv7m_interrupt_direct_install(
+  rtems_vector_number vector,
+  uint8_t priority,
+  ARMV7M_Exception_handler handler
+);
+
+/**
+ * @brief Removes the direct handler of the interrupt vector.
+ *
+ * The interrupt vector is disabled and the generic dispatcher is restored.
+ * The priority is reset to BSP_ARMV7M_IRQ_PRIORITY_DEFAULT.
+ *
+ * @param vector is the interrupt vector number.
+ *
+ * @retval RTEMS_SUCCESSFUL Successful operation.
+ * @retval RTEMS_INCORRECT_STATE The interrupt support was not initialized.
+ * @retval RTEMS_INVALID_ID The vector number was invalid.
+ * @retval RTEMS_CALLED_FROM_ISR The function was called from interrupt
+ *   context.
+ * @retval RTEMS_UNSATISFIED The vector has no direct handler.
+ */
+rtems_status_code armv7m_interrupt_direct_remove(rtems_vector_number vector);
+
+/**
+ * @brief Hands off work from a direct handler to the interrupt vector.
+ *
+ * The vector is set pending, its handlers installed by
+ * rtems_interrupt_handler_install() run after the direct handler returned,
+ * provided the vector is enabled and its priority permits.
+ *
+ * @param vector is the interrupt vector number.
+ */
+static inline void armv7m_interrupt_direct_defer(rtems_vector_number vector)
+{
+  _ARMV7M_NVIC_Set_pending((int) vector);
+}
+
+#endif /* ARM_MULTILIB_ARCH_V7M */
+
 #ifdef __cplusplus
 }
 #endif /* __cplusplus */
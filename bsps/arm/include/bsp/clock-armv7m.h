@@ -27,6 +27,51 @@ typedef struct {
 
 extern ARMV7M_Timecounter _ARMV7M_TC;
 
+#ifdef BSP_ARMV7M_SYSTICK_TICKLESS_IDLE
+/*
+ * The BSP enables the tickless idle mode with BSP_ARMV7M_SYSTICK_TICKLESS_IDLE
+ * and uses _ARMV7M_Clock_tickless_idle_body() as the idle thread body.  While
+ * the idle thread has nothing to do until the next watchdog expiration, the
+ * SysTick keeps on counting, however, its interrupt is disabled.  A BSP
+ * provided timer wakes up the processor in time.  The ticks elapsed in the
+ * meantime are caught up by the next clock interrupt.
+ */
+
+typedef struct {
+  /**
+   * @brief Count of idle periods with a disabled clock tick interrupt.
+   */
+  uint32_t idle_periods;
+
+  /**
+   * @brief Count of clock ticks elapsed with a disabled clock tick interrupt.
+   *
+   * Each of these clock ticks would have raised an interrupt without the
+   * tickless idle mode.
+   */
+  uint64_t suppressed_ticks;
+} ARMV7M_Clock_tickless_statistics;
+
+void *_ARMV7M_Clock_tickless_idle_body(uintptr_t ignored);
+
+void _ARMV7M_Clock_get_tickless_statistics(
+  ARMV7M_Clock_tickless_statistics *stats
+);
+
+/*
+ * Starts the BSP provided wake up timer.  The timer shall raise an interrupt
+ * after the specified count of SysTick clock cycles.
+ */
+void _ARMV7M_Clock_tickless_timer_start(uint64_t cycles);
+
+/*
+ * Stops the BSP provided wake up timer and returns the count of SysTick clock
+ * cycles elapsed since the start.  The result needs to be accurate to a
+ * fraction of a clock tick interval.
+ */
+uint64_t _ARMV7M_Clock_tickless_timer_stop(void);
+#endif
+
 static inline uint32_t _ARMV7M_Clock_frequency(void)
 {
 #ifdef BSP_ARMV7M_SYSTICK_FREQUENCY
@@ -37,6 +82,14 @@ static inline uint32_t _ARMV7M_Clock_frequency(void)
 #endif
 }
 
+/*
+ * Adjusts the SysTick reload value and the SysTick timecounter to a changed
+ * _ARMV7M_Clock_frequency(), so that the clock tick interval is kept.  The
+ * BSP calls it with interrupts disabled right after the processor clock
+ * change.
+ */
+void _ARMV7M_Clock_frequency_changed(void);
+
 static uint32_t _ARMV7M_Clock_counter(ARMV7M_Timecounter *tc)
 {
   volatile ARMV7M_Systick *systick;
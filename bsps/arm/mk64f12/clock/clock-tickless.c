@@ -0,0 +1,132 @@
+/*
+ * Copyright (c) 2026 Dave Rush.  All rights reserved.
+ *
+ * The license and distribution terms for this file may be
+ * found in the file LICENSE in this distribution or at
+ * http://www.rtems.org/license/LICENSE.
+ */
+
+#include <bsp.h>
+#include <bsp/clock-armv7m.h>
+#include <bsp/clock-scaling.h>
+#include <bsp/fatal.h>
+#include <bsp/irq.h>
+#include <bsp/mk64f12.h>
+
+#include <rtems/sysinit.h>
+
+#include <MK64F12.h>
+
+#ifdef MK64F12_TICKLESS_IDLE
+
+/*
+ * The wake up timer of the tickless idle mode is the last PIT channel.  The
+ * PIT runs from the bus clock which continues to run in the WAIT mode entered
+ * by the idle thread.  The LPTMR would be required only for the deeper stop
+ * modes, however, these also stop the SysTick.
+ */
+#define TICKLESS_PIT_CHANNEL 3
+
+#define TICKLESS_PIT_IRQ PIT3_IRQn
+
+static uint32_t tickless_bus_frequency;
+
+static uint32_t tickless_systick_frequency;
+
+void _ARMV7M_Clock_tickless_timer_start(uint64_t cycles)
+{
+  uint64_t load;
+
+  load = (cycles * tickless_bus_frequency) / tickless_systick_frequency;
+
+  if (load > 0xffffffff) {
+    load = 0xffffffff;
+  } else if (load == 0) {
+    load = 1;
+  }
+
+  PIT->CHANNEL[TICKLESS_PIT_CHANNEL].TCTRL = 0;
+  PIT->CHANNEL[TICKLESS_PIT_CHANNEL].TFLG = PIT_TFLG_TIF_MASK;
+  PIT->CHANNEL[TICKLESS_PIT_CHANNEL].LDVAL = (uint32_t) load - 1;
+  PIT->CHANNEL[TICKLESS_PIT_CHANNEL].TCTRL = PIT_TCTRL_TIE_MASK
+    | PIT_TCTRL_TEN_MASK;
+}
+
+uint64_t _ARMV7M_Clock_tickless_timer_stop(void)
+{
+  uint64_t elapsed;
+  uint32_t ldval;
+  uint32_t cval;
+  uint32_t tflg;
+
+  ldval = PIT->CHANNEL[TICKLESS_PIT_CHANNEL].LDVAL;
+  cval = PIT->CHANNEL[TICKLESS_PIT_CHANNEL].CVAL;
+  tflg = PIT->CHANNEL[TICKLESS_PIT_CHANNEL].TFLG;
+  PIT->CHANNEL[TICKLESS_PIT_CHANNEL].TCTRL = 0;
+  PIT->CHANNEL[TICKLESS_PIT_CHANNEL].TFLG = PIT_TFLG_TIF_MASK;
+
+  /* After the time out the channel reloads and continues to count down */
+  elapsed = ldval - cval;
+
+  if ((tflg & PIT_TFLG_TIF_MASK) != 0) {
+    elapsed += (uint64_t) ldval + 1;
+  }
+
+  return (elapsed * tickless_systick_frequency) / tickless_bus_frequency;
+}
+
+/*
+ * The interrupt only wakes up the processor.  The idle thread stopped the
+ * channel and cleared the flag already, so there is nothing left to do.
+ */
+static void tickless_interrupt(void *arg)
+{
+  (void) arg;
+  PIT->CHANNEL[TICKLESS_PIT_CHANNEL].TFLG = PIT_TFLG_TIF_MASK;
+}
+
+/*
+ * The idle thread stops the wake up timer before it enables interrupts, so
+ * the timer is not running during a clock change.
+ */
+static void tickless_clock_update(mk64f12_clock_listener *listener)
+{
+  (void) listener;
+  tickless_bus_frequency = CLOCK_GetBusClkFreq();
+  tickless_systick_frequency = _ARMV7M_Clock_frequency();
+}
+
+static mk64f12_clock_listener tickless_clock_listener = {
+  .update = tickless_clock_update
+};
+
+static void tickless_initialize(void)
+{
+  rtems_status_code sc;
+
+  tickless_clock_update(&tickless_clock_listener);
+  mk64f12_clock_add_listener(&tickless_clock_listener);
+
+  CLOCK_EnableClock(kCLOCK_Pit0);
+  PIT->MCR = PIT_MCR_FRZ_MASK;
+  PIT->CHANNEL[TICKLESS_PIT_CHANNEL].TCTRL = 0;
+  PIT->CHANNEL[TICKLESS_PIT_CHANNEL].TFLG = PIT_TFLG_TIF_MASK;
+
+  sc = rtems_interrupt_handler_install(
+    TICKLESS_PIT_IRQ,
+    "Tickless",
+    RTEMS_INTERRUPT_UNIQUE,
+    tickless_interrupt,
+    NULL
+  );
+  if (sc != RTEMS_SUCCESSFUL) {
+    bsp_fatal(MK64F12_FATAL_TICKLESS_IRQ_INSTALL);
+  }
+}
+
+RTEMS_SYSINIT_ITEM(
+  tickless_initialize,
+  RTEMS_SYSINIT_DEVICE_DRIVERS,
+  RTEMS_SYSINIT_ORDER_FIRST
+);
+#endif /* MK64F12_TICKLESS_IDLE */
@@ -0,0 +1,141 @@
+/*
+ * Copyright (c) 2026 Dave Rush.  All rights reserved.
+ *
+ * The license and distribution terms for this file may be
+ * found in the file LICENSE in this distribution or at
+ * http://www.rtems.org/license/LICENSE.
+ */
+
+#include <bsp.h>
+#include <bsp/clock-scaling.h>
+#include <bsp/fatal.h>
+#include <bsp/irq.h>
+#include <bsp/mk64f12.h>
+
+#include <rtems/sysinit.h>
+#include <rtems/score/watchdogimpl.h>
+
+#include <MK64F12.h>
+
+#ifdef MK64F12_HIGH_RESOLUTION_TIMERS
+
+/*
+ * The one-shot comparator of the high resolution watchdogs is PIT channel 2.
+ * The channel would reload and continue to count down after the time out, so
+ * the interrupt stops it.
+ */
+#define COMPARATOR_PIT_CHANNEL 2
+
+#define COMPARATOR_PIT_IRQ PIT2_IRQn
+
+typedef struct {
+  Watchdog_Comparator base;
+  uint32_t bus_frequency;
+  uint64_t max_nanoseconds;
+} comparator_context;
+
+static void comparator_set(
+  Watchdog_Comparator *base,
+  uint64_t nanoseconds
+)
+{
+  comparator_context *ctx;
+  uint64_t load;
+
+  ctx = (comparator_context *) base;
+
+  /* Round up, an early interrupt would only set the comparator again */
+  if (nanoseconds < ctx->max_nanoseconds) {
+    load = (nanoseconds * ctx->bus_frequency + 999999999) / 1000000000;
+  } else {
+    load = 0xffffffff;
+  }
+
+  if (load == 0) {
+    load = 1;
+  }
+
+  PIT->CHANNEL[COMPARATOR_PIT_CHANNEL].TCTRL = 0;
+  PIT->CHANNEL[COMPARATOR_PIT_CHANNEL].TFLG = PIT_TFLG_TIF_MASK;
+  PIT->CHANNEL[COMPARATOR_PIT_CHANNEL].LDVAL = (uint32_t) load - 1;
+  PIT->CHANNEL[COMPARATOR_PIT_CHANNEL].TCTRL = PIT_TCTRL_TIE_MASK
+    | PIT_TCTRL_TEN_MASK;
+}
+
+static comparator_context comparator_instance = {
+  .base = {
+    .set = comparator_set
+  }
+};
+
+static void comparator_interrupt(void *arg)
+{
+  (void) arg;
+  PIT->CHANNEL[COMPARATOR_PIT_CHANNEL].TCTRL = 0;
+  PIT->CHANNEL[COMPARATOR_PIT_CHANNEL].TFLG = PIT_TFLG_TIF_MASK;
+  _Watchdog_Comparator_expire(_Per_CPU_Get());
+}
+
+static void comparator_set_frequency(comparator_context *ctx)
+{
+  ctx->bus_frequency = CLOCK_GetBusClkFreq();
+  ctx->max_nanoseconds = (UINT64_C(0xffffffff) * 1000000000)
+    / ctx->bus_frequency;
+}
+
+/*
+ * A running channel would time out with the cycles of the previous bus
+ * clock, so it is restarted to time out immediately.  The interrupt sets the
+ * comparator again with the new bus clock.
+ */
+static void comparator_clock_update(mk64f12_clock_listener *listener)
+{
+  comparator_context *ctx;
+
+  (void) listener;
+  ctx = &comparator_instance;
+  comparator_set_frequency(ctx);
+
+  if ((PIT->CHANNEL[COMPARATOR_PIT_CHANNEL].TCTRL & PIT_TCTRL_TEN_MASK) != 0) {
+    comparator_set(&ctx->base, 0);
+  }
+}
+
+static mk64f12_clock_listener comparator_clock_listener = {
+  .update = comparator_clock_update
+};
+
+static void comparator_initialize(void)
+{
+  comparator_context *ctx;
+  rtems_status_code sc;
+
+  ctx = &comparator_instance;
+  comparator_set_frequency(ctx);
+  mk64f12_clock_add_listener(&comparator_clock_listener);
+
+  CLOCK_EnableClock(kCLOCK_Pit0);
+  PIT->MCR = PIT_MCR_FRZ_MASK;
+  PIT->CHANNEL[COMPARATOR_PIT_CHANNEL].TCTRL = 0;
+  PIT->CHANNEL[COMPARATOR_PIT_CHANNEL].TFLG = PIT_TFLG_TIF_MASK;
+
+  sc = rtems_interrupt_handler_install(
+    COMPARATOR_PIT_IRQ,
+    "Comparator",
+    RTEMS_INTERRUPT_UNIQUE,
+    comparator_interrupt,
+    NULL
+  );
+  if (sc != RTEMS_SUCCESSFUL) {
+    bsp_fatal(MK64F12_FATAL_COMPARATOR_IRQ_INSTALL);
+  }
+
+  _Watchdog_Comparator_install(&ctx->base);
+}
+
+RTEMS_SYSINIT_ITEM(
+  comparator_initialize,
+  RTEMS_SYSINIT_DEVICE_DRIVERS,
+  RTEMS_SYSINIT_ORDER_SECOND
+);
+#endif /* MK64F12_HIGH_RESOLUTION_TIMERS */
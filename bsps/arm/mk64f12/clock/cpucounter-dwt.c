@@ -0,0 +1,136 @@
+/*
+ * Copyright (c) 2026 Dave Rush.  All rights reserved.
+ *
+ * The license and distribution terms for this file may be
+ * found in the file LICENSE in this distribution or at
+ * http://www.rtems.org/license/LICENSE.
+ */
+
+#include <bsp.h>
+#include <bsp/clock-scaling.h>
+#include <bsp/deferred-init.h>
+#include <bsp/fatal.h>
+#include <bsp/pit.h>
+#include <bsp/printk-buffer.h>
+
+#include <rtems/counter.h>
+#include <rtems/score/armv7m.h>
+#include <rtems/sysinit.h>
+
+/*
+ * The CPU counter is the DWT cycle counter which counts the processor clock
+ * cycles plus the cycles slept.  The processor clock is gated off while the
+ * processor waits for an interrupt, so the idle thread adds the sleep time
+ * measured by the free running PIT counter to the slept cycles.  The cycle
+ * counter itself is never written, so the CPU counter only moves forward.
+ *
+ * The cycle counter frequency follows the clock mode, so the counter
+ * conversion is set up again after each mode change.
+ */
+
+static uint32_t mk64f12_cpu_counter_slept;
+
+uint32_t _CPU_Counter_frequency(void)
+{
+  return BSP_ARMV7M_SYSTICK_FREQUENCY;
+}
+
+CPU_Counter_ticks _CPU_Counter_read(void)
+{
+  return _ARMV7M_DWT->cyccnt + mk64f12_cpu_counter_slept;
+}
+
+/*
+ * The caller masks the interrupts with the PRIMASK, so no CPU counter read
+ * can observe a partial update.
+ */
+void mk64f12_wait_for_interrupt(void)
+{
+  uint64_t pit_begin;
+  uint64_t pit_elapsed;
+  uint32_t cyccnt;
+  uint32_t awake;
+  uint32_t elapsed;
+
+#if MK64F12_PRINTK_BUFFER_SIZE > 0
+  /* The idle thread drains the printk() buffer before it sleeps again */
+  if (!mk64f12_printk_is_empty()) {
+    return;
+  }
+#endif
+
+  pit_begin = mk64f12_pit_read();
+  cyccnt = _ARMV7M_DWT->cyccnt;
+
+  __asm__ volatile ("wfi");
+
+  pit_elapsed = mk64f12_pit_read() - pit_begin;
+  awake = _ARMV7M_DWT->cyccnt - cyccnt;
+  elapsed = (uint32_t) ((pit_elapsed * BSP_ARMV7M_SYSTICK_FREQUENCY)
+    / mk64f12_pit_frequency());
+
+  /* The elapsed time is rounded down, it may be less than the awake cycles */
+  if (elapsed > awake) {
+    mk64f12_cpu_counter_slept += elapsed - awake;
+  }
+}
+
+#ifdef BSP_ARMV7M_IDLE_WORK
+void mk64f12_idle_work(void)
+{
+#ifdef MK64F12_DEFERRED_INIT
+  mk64f12_deferred_init_run();
+#endif
+#if MK64F12_PRINTK_BUFFER_SIZE > 0
+  mk64f12_printk_flush();
+#endif
+}
+#endif
+
+#ifndef MK64F12_TICKLESS_IDLE
+void *mk64f12_idle_thread_body(uintptr_t ignored)
+{
+  (void) ignored;
+
+  while (true) {
+#ifdef BSP_ARMV7M_IDLE_WORK
+    BSP_ARMV7M_IDLE_WORK();
+#endif
+
+    /*
+     * The BASEPRI set by rtems_interrupt_local_disable() would prevent the
+     * wake up from the WFI, the PRIMASK does not.
+     */
+    _ARMV7M_Set_primask(1);
+    mk64f12_wait_for_interrupt();
+    _ARMV7M_Set_primask(0);
+  }
+}
+#endif
+
+static void mk64f12_cpu_counter_clock_update(
+  mk64f12_clock_listener *listener
+)
+{
+  (void) listener;
+  rtems_counter_initialize_converter(_CPU_Counter_frequency());
+}
+
+static mk64f12_clock_listener mk64f12_cpu_counter_clock_listener = {
+  .update = mk64f12_cpu_counter_clock_update
+};
+
+static void mk64f12_cpu_counter_initialize(void)
+{
+  if (!_ARMV7M_DWT_Enable_CYCCNT()) {
+    bsp_fatal(MK64F12_FATAL_NO_CYCCNT);
+  }
+
+  mk64f12_clock_add_listener(&mk64f12_cpu_counter_clock_listener);
+}
+
+RTEMS_SYSINIT_ITEM(
+  mk64f12_cpu_counter_initialize,
+  RTEMS_SYSINIT_CPU_COUNTER,
+  RTEMS_SYSINIT_ORDER_FIRST
+);
@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) 2026 Dave Rush.  All rights reserved.
+ *
+ * The license and distribution terms for this file may be
+ * found in the file LICENSE in this distribution or at
+ * http://www.rtems.org/license/LICENSE.
+ */
+
+#include <bsp.h>
+#include <bsp/clock-scaling.h>
+#include <bsp/mk64f12.h>
+#include <bsp/pit.h>
+
+#include <rtems/sysinit.h>
+#include <rtems/timecounter.h>
+
+#include <MK64F12.h>
+
+/*
+ * Channel 1 is chained to channel 0 and counts down once each time channel 0
+ * wraps around.  There is no lifetime timer register on this chip, so the two
+ * channels are read with a retry if the upper half changes in between.
+ */
+#define PIT_LOW 0
+
+#define PIT_HIGH 1
+
+static struct timecounter mk64f12_pit_tc;
+
+static void mk64f12_pit_clock_update(mk64f12_clock_listener *listener)
+{
+  (void) listener;
+  rtems_timecounter_set_frequency(&mk64f12_pit_tc, CLOCK_GetBusClkFreq());
+}
+
+static mk64f12_clock_listener mk64f12_pit_clock_listener = {
+  .update = mk64f12_pit_clock_update
+};
+
+static uint32_t mk64f12_pit_get_timecount(struct timecounter *tc)
+{
+  (void) tc;
+  return ~PIT->CHANNEL[PIT_LOW].CVAL;
+}
+
+uint64_t mk64f12_pit_read(void)
+{
+  uint32_t high;
+  uint32_t low;
+  uint32_t high_again;
+
+  high = PIT->CHANNEL[PIT_HIGH].CVAL;
+  low = PIT->CHANNEL[PIT_LOW].CVAL;
+  high_again = PIT->CHANNEL[PIT_HIGH].CVAL;
+
+  if (high != high_again) {
+    high = high_again;
+    low = PIT->CHANNEL[PIT_LOW].CVAL;
+  }
+
+  return ~(((uint64_t) high << 32) | low);
+}
+
+uint32_t mk64f12_pit_frequency(void)
+{
+  return mk64f12_pit_tc.tc_frequency;
+}
+
+static void mk64f12_pit_initialize(void)
+{
+  CLOCK_EnableClock(kCLOCK_Pit0);
+  PIT->MCR = PIT_MCR_FRZ_MASK;
+
+  PIT->CHANNEL[PIT_HIGH].TCTRL = 0;
+  PIT->CHANNEL[PIT_LOW].TCTRL = 0;
+  PIT->CHANNEL[PIT_HIGH].LDVAL = 0xffffffff;
+  PIT->CHANNEL[PIT_LOW].LDVAL = 0xffffffff;
+  PIT->CHANNEL[PIT_HIGH].TCTRL = PIT_TCTRL_CHN_MASK | PIT_TCTRL_TEN_MASK;
+  PIT->CHANNEL[PIT_LOW].TCTRL = PIT_TCTRL_TEN_MASK;
+
+  mk64f12_pit_tc.tc_get_timecount = mk64f12_pit_get_timecount;
+  mk64f12_pit_tc.tc_counter_mask = 0xffffffff;
+  mk64f12_pit_tc.tc_frequency = CLOCK_GetBusClkFreq();
+  mk64f12_pit_tc.tc_quality = RTEMS_TIMECOUNTER_QUALITY_CLOCK_DRIVER + 1;
+  rtems_timecounter_install(&mk64f12_pit_tc);
+  mk64f12_clock_add_listener(&mk64f12_pit_clock_listener);
+}
+
+RTEMS_SYSINIT_ITEM(
+  mk64f12_pit_initialize,
+  RTEMS_SYSINIT_DEVICE_DRIVERS,
+  RTEMS_SYSINIT_ORDER_FIRST
+);
@@ -13,6 +13,7 @@
 #include <bsp/irq.h>
 #include <bsp/usart.h>
 #include <bsp/mk64f12.h>
+#include <bsp/printk-buffer.h>
 
 console_tbl Console_Configuration_Ports [] = {
     {
@@ -32,7 +33,7 @@ console_tbl Console_Configuration_Ports [] = {
 
 unsigned long Console_Configuration_Count = PORT_COUNT;
 
-static void output_char(char c)
+void mk64f12_console_output_char(char c)
 {
   const console_fns *con =
     Console_Configuration_Ports [Console_Port_Minor].pDeviceFns;
@@ -46,16 +47,21 @@ static void output_char(char c)
 
 static int input_char(void)
 {
-  const console_fns *con =
-    Console_Configuration_Ports [Console_Port_Minor].pDeviceFns;
   /*
    * note to self, this tries writing to the uart data register before
    * the uart has been configured. It causes a bus abort if the uart
    * clock isn't running
+   *
+   * The device read function is NULL in interrupt mode, so use the polled
+   * read directly.
    */
-  return con->deviceRead((int) Console_Port_Minor);
+  return mk64f12_usart_read_polled((int) Console_Port_Minor);
 }
 
-BSP_output_char_function_type BSP_output_char = output_char;
+#if MK64F12_PRINTK_BUFFER_SIZE > 0
+BSP_output_char_function_type BSP_output_char = mk64f12_printk_output_char;
+#else
+BSP_output_char_function_type BSP_output_char = mk64f12_console_output_char;
+#endif
 
 BSP_polling_getchar_function_type BSP_poll_char = input_char;
@@ -0,0 +1,203 @@
+/*
+ * Copyright (c) 2026 Dave Rush.  All rights reserved.
+ *
+ * The license and distribution terms for this file may be
+ * found in the file LICENSE in this distribution or at
+ * http://www.rtems.org/license/LICENSE.
+ */
+
+#include <bsp.h>
+#include <bsp/printk-buffer.h>
+#include <bsp/usart.h>
+
+#include <rtems/score/atomic.h>
+#include <rtems/score/sysstate.h>
+
+#if MK64F12_PRINTK_BUFFER_SIZE > 0
+
+RTEMS_STATIC_ASSERT(
+  (MK64F12_PRINTK_BUFFER_SIZE & (MK64F12_PRINTK_BUFFER_SIZE - 1)) == 0
+    && MK64F12_PRINTK_BUFFER_SIZE <= 0x800000,
+  MK64F12_PRINTK_BUFFER_SIZE
+);
+
+#define PRINTK_INDEX_MASK (MK64F12_PRINTK_BUFFER_SIZE - 1)
+
+/*
+ * Each slot contains a 24-bit sequence number and the character, so that a
+ * producer publishes the character with a single store.  The sequence number
+ * is relative to the slot index, so that the zero initialized slots are empty
+ * for the first round.  For the position pos of a slot with the base
+ * pos - index, the sequence number is
+ *
+ *   - base, if the slot is empty,
+ *   - base + 1, if the slot contains the character of pos, and
+ *   - base + MK64F12_PRINTK_BUFFER_SIZE, if the slot is empty for the next
+ *     round.
+ */
+#define PRINTK_SLOT(seq, c) (((seq) << 8) | (uint8_t) (c))
+
+#define PRINTK_SLOT_SEQ(slot) ((slot) >> 8)
+
+#define PRINTK_SLOT_CHAR(slot) ((char) (slot))
+
+typedef struct {
+  Atomic_Uint head;
+  Atomic_Uint tail;
+  Atomic_Uint dropped;
+  uint32_t max_fill;
+  bool synchronous;
+  Atomic_Uint slots[MK64F12_PRINTK_BUFFER_SIZE];
+} printk_buffer_context;
+
+static printk_buffer_context printk_buffer_instance;
+
+/* Returns the difference of the 24-bit sequence numbers */
+static int32_t printk_buffer_seq_diff(uint32_t a, uint32_t b)
+{
+  return (int32_t) ((a - b) << 8) >> 8;
+}
+
+static bool printk_buffer_pop(printk_buffer_context *ctx, char *c)
+{
+  unsigned int pos;
+
+  pos = _Atomic_Load_uint(&ctx->tail, ATOMIC_ORDER_RELAXED);
+
+  while (true) {
+    Atomic_Uint *slot;
+    unsigned int base;
+    unsigned int value;
+    int32_t diff;
+
+    slot = &ctx->slots[pos & PRINTK_INDEX_MASK];
+    base = pos & ~PRINTK_INDEX_MASK;
+    value = _Atomic_Load_uint(slot, ATOMIC_ORDER_ACQUIRE);
+    diff = printk_buffer_seq_diff(PRINTK_SLOT_SEQ(value), base + 1);
+
+    if (diff == 0) {
+      if (
+        _Atomic_Compare_exchange_uint(
+          &ctx->tail,
+          &pos,
+          pos + 1,
+          ATOMIC_ORDER_RELAXED,
+          ATOMIC_ORDER_RELAXED
+        )
+      ) {
+        _Atomic_Store_uint(
+          slot,
+          PRINTK_SLOT(base + MK64F12_PRINTK_BUFFER_SIZE, 0),
+          ATOMIC_ORDER_RELEASE
+        );
+        *c = PRINTK_SLOT_CHAR(value);
+        return true;
+      }
+    } else if (diff < 0) {
+      return false;
+    } else {
+      pos = _Atomic_Load_uint(&ctx->tail, ATOMIC_ORDER_RELAXED);
+    }
+  }
+}
+
+void mk64f12_printk_flush(void)
+{
+  printk_buffer_context *ctx = &printk_buffer_instance;
+  uint32_t fill;
+  char c;
+
+  fill = _Atomic_Load_uint(&ctx->head, ATOMIC_ORDER_RELAXED)
+    - _Atomic_Load_uint(&ctx->tail, ATOMIC_ORDER_RELAXED);
+
+  if (fill > ctx->max_fill) {
+    ctx->max_fill = fill;
+  }
+
+  while (printk_buffer_pop(ctx, &c)) {
+    mk64f12_console_output_char(c);
+  }
+}
+
+void mk64f12_printk_output_char(char c)
+{
+  printk_buffer_context *ctx = &printk_buffer_instance;
+  unsigned int pos;
+
+  if (ctx->synchronous || !_System_state_Is_up(_System_state_Get())) {
+    mk64f12_printk_flush();
+    mk64f12_console_output_char(c);
+    return;
+  }
+
+  pos = _Atomic_Load_uint(&ctx->head, ATOMIC_ORDER_RELAXED);
+
+  while (true) {
+    Atomic_Uint *slot;
+    unsigned int base;
+    int32_t diff;
+
+    slot = &ctx->slots[pos & PRINTK_INDEX_MASK];
+    base = pos & ~PRINTK_INDEX_MASK;
+    diff = printk_buffer_seq_diff(
+      PRINTK_SLOT_SEQ(_Atomic_Load_uint(slot, ATOMIC_ORDER_ACQUIRE)),
+      base
+    );
+
+    if (diff == 0) {
+      if (
+        _Atomic_Compare_exchange_uint(
+          &ctx->head,
+          &pos,
+          pos + 1,
+          ATOMIC_ORDER_RELAXED,
+          ATOMIC_ORDER_RELAXED
+        )
+      ) {
+        _Atomic_Store_uint(
+          slot,
+          PRINTK_SLOT(base + 1, c),
+          ATOMIC_ORDER_RELEASE
+        );
+        return;
+      }
+    } else if (diff < 0) {
+      _Atomic_Fetch_add_uint(&ctx->dropped, 1, ATOMIC_ORDER_RELAXED);
+      return;
+    } else {
+      pos = _Atomic_Load_uint(&ctx->head, ATOMIC_ORDER_RELAXED);
+    }
+  }
+}
+
+bool mk64f12_printk_is_empty(void)
+{
+  printk_buffer_context *ctx = &printk_buffer_instance;
+
+  return _Atomic_Load_uint(&ctx->head, ATOMIC_ORDER_RELAXED)
+    == _Atomic_Load_uint(&ctx->tail, ATOMIC_ORDER_RELAXED);
+}
+
+void mk64f12_printk_get_statistics(mk64f12_printk_statistics *stats)
+{
+  printk_buffer_context *ctx = &printk_buffer_instance;
+
+  stats->chars = _Atomic_Load_uint(&ctx->head, ATOMIC_ORDER_RELAXED);
+  stats->dropped = _Atomic_Load_uint(&ctx->dropped, ATOMIC_ORDER_RELAXED);
+  stats->max_fill = ctx->max_fill;
+}
+
+void mk64f12_printk_fatal_extension(
+  rtems_fatal_source source,
+  bool always_set_to_false,
+  rtems_fatal_code code
+)
+{
+  printk_buffer_context *ctx = &printk_buffer_instance;
+
+  ctx->synchronous = true;
+  mk64f12_printk_flush();
+  bsp_fatal_extension(source, always_set_to_false, code);
+}
+
+#endif /* MK64F12_PRINTK_BUFFER_SIZE > 0 */
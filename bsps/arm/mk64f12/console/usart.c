@@ -9,86 +9,686 @@
 #include <libchip/sersupp.h>
 
 #include <bsp.h>
+#include <bsp/clock-scaling.h>
 #include <bsp/irq.h>
 #include <bsp/usart.h>
 #include <bsp/mk64f12.h>
 
+#if CONSOLE_USE_INTERRUPTS && MK64F12_USART_USE_DMA
+#define USART_USE_DMA 1
+#include <fsl/edma.h>
+#endif
+
+/*
+ * The TX interrupt is raised once the TX FIFO count drops to this level.  The
+ * RX interrupt is raised once the RX FIFO count reaches the RX watermark, a
+ * trailing partial FIFO is picked up by the idle line interrupt.
+ */
+#define USART_TX_WATERMARK 2
+
+#define USART_RX_WATERMARK 4
+
+#ifdef USART_USE_DMA
+/*
+ * The receive DMA channel runs forever on this ring buffer.  The buffer is
+ * emptied on the idle line interrupt and on the half and major loop
+ * interrupts of the channel.
+ */
+#define USART_DMA_RX_BUFFER_SIZE 256
+
+#define USART_DMA_TX_MAX_TRANSFER 0x7fff
+#endif
+
+typedef struct {
+  UART_Type *regs;
+  size_t fifo_size;
+  size_t tx_queued;
+  bool transmitting;
+  uint32_t baud;
+  struct rtems_termios_tty *tty;
+  mk64f12_usart_statistics stats;
+  mk64f12_clock_listener clock_listener;
+#ifdef USART_USE_DMA
+  fsl_edma_channel_context tx_edma;
+  fsl_edma_channel_context rx_edma;
+  size_t rx_tail;
+  uint8_t rx_buffer [USART_DMA_RX_BUFFER_SIZE];
+#endif
+} usart_context;
+
+static usart_context usart_context_table [FSL_FEATURE_SOC_UART_COUNT];
+
+static UART_Type *usart_get_regs(const console_tbl *ct)
+{
+  return (UART_Type *) ct->ulCtrlPort1;
+}
+
+#if CONSOLE_USE_INTERRUPTS
+static rtems_vector_number usart_get_irq_number(const console_tbl *ct)
+{
+  return ct->ulIntVector;
+}
+#endif
+
+/* UART0 and UART1 are clocked by the system clock, all others by the bus */
+static uint32_t usart_get_source_clock(const UART_Type *regs)
+{
+  if (regs == UART0 || regs == UART1) {
+    return CLOCK_GetCoreSysClkFreq();
+  }
+
+  return CLOCK_GetBusClkFreq();
+}
+
+static usart_context *usart_get_context(int minor)
+{
+  return Console_Port_Data [minor].pDeviceContext;
+}
+
+/*
+ * The baud rate divisor follows the source clock after a clock mode change.
+ * The transmitter drains first, so that no character is sent with a mixed
+ * bit time.
+ */
+static void usart_clock_update(mk64f12_clock_listener *listener)
+{
+  usart_context *ctx =
+    RTEMS_CONTAINER_OF(listener, usart_context, clock_listener);
+  UART_Type *regs = ctx->regs;
+
+  if (ctx->baud == 0) {
+    return;
+  }
+
+  while ((regs->S1 & UART_S1_TC_MASK) == 0) {
+    /* Wait */
+  }
+
+  (void) UART_SetBaudRate(regs, ctx->baud, usart_get_source_clock(regs));
+}
+
 static void usart_initialize(int minor)
 {
-/* console uart initialized in bspstart */
-#if 0
-  // const console_tbl *ct = Console_Port_Tbl [minor];
+  const console_tbl *ct = Console_Port_Tbl [minor];
+  UART_Type *regs = usart_get_regs(ct);
+  usart_context *ctx = &usart_context_table [UART_GetInstance(regs)];
+
+  ctx->regs = regs;
+  ctx->fifo_size = FSL_FEATURE_UART_FIFO_SIZEn(regs);
+  ctx->baud = ct->ulClock;
+  ctx->clock_listener.update = usart_clock_update;
+  mk64f12_clock_add_listener(&ctx->clock_listener);
+  Console_Port_Data [minor].pDeviceContext = ctx;
+
+  /* console uart initialized in bspstart */
+  if (regs != UART0) {
+    uart_config_t cfg;
+
+    UART_GetDefaultConfig(&cfg);
+    cfg.baudRate_Bps = ct->ulClock;
+    cfg.enableTx = true;
+    cfg.enableRx = true;
+    UART_Init(regs, &cfg, usart_get_source_clock(regs));
+  }
+}
+
+#ifdef USART_USE_DMA
+/* DMAMUX request sources of UART0 to UART3, UART4 and UART5 share one */
+static const uint8_t usart_dma_sources [][2] = {
+  { kDmaRequestMux0UART0Rx & 0xff, kDmaRequestMux0UART0Tx & 0xff },
+  { kDmaRequestMux0UART1Rx & 0xff, kDmaRequestMux0UART1Tx & 0xff },
+  { kDmaRequestMux0UART2Rx & 0xff, kDmaRequestMux0UART2Tx & 0xff },
+  { kDmaRequestMux0UART3Rx & 0xff, kDmaRequestMux0UART3Tx & 0xff }
+};
+
+static void usart_dma_rx_drain(usart_context *ctx)
+{
+  uintptr_t begin = (uintptr_t) &ctx->rx_buffer [0];
+  size_t head;
+  size_t tail;
+  rtems_interrupt_level level;
+
+  /*
+   * Claim the received range in a critical section, so that concurrent
+   * drains never hand out the same bytes twice.  The characters are passed to
+   * Termios with interrupts enabled.
+   */
+  rtems_interrupt_disable(level);
+  head = (size_t) (ctx->rx_edma.edma_tcd->DADDR - begin);
+
+  if (head >= USART_DMA_RX_BUFFER_SIZE) {
+    head = 0;
+  }
+
+  tail = ctx->rx_tail;
+  ctx->rx_tail = head;
+  rtems_interrupt_enable(level);
+
+  if (head < tail) {
+    size_t n = USART_DMA_RX_BUFFER_SIZE - tail;
+
+    rtems_termios_enqueue_raw_characters(
+      ctx->tty,
+      (const char *) &ctx->rx_buffer [tail],
+      (int) n
+    );
+    ctx->stats.rx_bytes += n;
+    tail = 0;
+  }
+
+  if (head > tail) {
+    size_t n = head - tail;
+
+    rtems_termios_enqueue_raw_characters(
+      ctx->tty,
+      (const char *) &ctx->rx_buffer [tail],
+      (int) n
+    );
+    ctx->stats.rx_bytes += n;
+  }
+}
+
+static void usart_dma_rx_done(fsl_edma_channel_context *edma, uint32_t error)
+{
+  usart_context *ctx = RTEMS_CONTAINER_OF(edma, usart_context, rx_edma);
+
+  (void) error;
+  ++ctx->stats.dma_interrupts;
+  usart_dma_rx_drain(ctx);
+}
+
+static void usart_dma_tx_done(fsl_edma_channel_context *edma, uint32_t error)
+{
+  usart_context *ctx = RTEMS_CONTAINER_OF(edma, usart_context, tx_edma);
+  size_t sent = ctx->tx_queued;
+
+  (void) error;
+  ++ctx->stats.dma_interrupts;
+  ctx->regs->C2 &= ~UART_C2_TIE_MASK;
+  ctx->transmitting = false;
+  ctx->tx_queued = 0;
+  ctx->stats.tx_bytes += sent;
+  rtems_termios_dequeue_characters(ctx->tty, (int) sent);
+}
+
+static void usart_dma_route(fsl_edma_channel_context *edma, uint8_t source)
+{
+  unsigned channel = fsl_edma_channel_index_of_tcd(edma->edma_tcd);
+
+  DMAMUX->CHCFG [channel] = 0;
+  DMAMUX->CHCFG [channel] = DMAMUX_CHCFG_SOURCE(source)
+    | DMAMUX_CHCFG_ENBL_MASK;
+}
+
+static int usart_dma_start(usart_context *ctx)
+{
+  UART_Type *regs = ctx->regs;
+  uint32_t instance = UART_GetInstance(regs);
+  struct fsl_edma_tcd tcd;
+  rtems_status_code sc;
+
+  if (instance >= RTEMS_ARRAY_SIZE(usart_dma_sources)) {
+    return -1;
+  }
+
+  ctx->rx_edma.done = usart_dma_rx_done;
+  sc = fsl_edma_obtain_next_free_channel(&ctx->rx_edma);
+  if (sc != RTEMS_SUCCESSFUL) {
+    return -1;
+  }
+
+  ctx->tx_edma.done = usart_dma_tx_done;
+  sc = fsl_edma_obtain_next_free_channel(&ctx->tx_edma);
+  if (sc != RTEMS_SUCCESSFUL) {
+    fsl_edma_release_channel(&ctx->rx_edma);
+    return -1;
+  }
+
+  usart_dma_route(&ctx->rx_edma, usart_dma_sources [instance][0]);
+  usart_dma_route(&ctx->tx_edma, usart_dma_sources [instance][1]);
+
+  ctx->rx_tail = 0;
+  tcd.SADDR = (uint32_t) &regs->D;
+  tcd.SDF = EDMA_TCD_SDF_SSIZE_8BIT | EDMA_TCD_SDF_DSIZE_8BIT
+    | EDMA_TCD_SDF_SOFF(0);
+  tcd.NBYTES = 1;
+  tcd.SLAST = 0;
+  tcd.DADDR = (uint32_t) &ctx->rx_buffer [0];
+  tcd.CDF = EDMA_TCD_CDF_CITER(USART_DMA_RX_BUFFER_SIZE)
+    | EDMA_TCD_CDF_DOFF(1);
+  tcd.DLAST_SGA = -(int32_t) USART_DMA_RX_BUFFER_SIZE;
+  tcd.BMF = EDMA_TCD_BMF_BITER(USART_DMA_RX_BUFFER_SIZE)
+    | EDMA_TCD_BMF_INT_HALF | EDMA_TCD_BMF_INT_MAJ;
+  fsl_edma_copy_and_enable_hardware_requests(ctx->rx_edma.edma_tcd, &tcd);
 
-  uart_config_t cfg;
-  UART_GetDefaultConfig(&cfg);
-  cfg.enableTx = true;
-  cfg.enableRx = true;
-  UART_Init(UART0, &cfg, CLOCK_GetCoreSysClkFreq());
+  /* Each received character is a DMA request, the DMA empties the FIFO */
+  UART_SetRxFifoWatermark(regs, 1);
+  regs->C5 |= UART_C5_TDMAS_MASK | UART_C5_RDMAS_MASK;
+
+  return 0;
+}
+
+static void usart_dma_stop(usart_context *ctx)
+{
+  ctx->regs->C5 &= ~(UART_C5_TDMAS_MASK | UART_C5_RDMAS_MASK);
+  fsl_edma_release_channel(&ctx->tx_edma);
+  fsl_edma_release_channel(&ctx->rx_edma);
+}
 #endif
+
+#if CONSOLE_USE_INTERRUPTS
+#define USART_S1_RX_ERRORS \
+  (UART_S1_OR_MASK | UART_S1_FE_MASK | UART_S1_PF_MASK)
+
+/*
+ * The idle and error flags are cleared by a read of S1 followed by a read of
+ * D.  The caller saw an empty FIFO, however, a character may arrive before
+ * the read of D.  Deliver the characters read until the FIFO is empty.  A read
+ * of D from the empty FIFO sets the underflow flag instead, this read returned
+ * no character.  The FIFO is not flushed, so no character is lost.
+ */
+static void usart_clear_rx_flags(usart_context *ctx)
+{
+  UART_Type *regs = ctx->regs;
+
+  (void) regs->S1;
+
+  do {
+    char c = (char) regs->D;
+
+    if ((regs->SFIFO & UART_SFIFO_RXUF_MASK) != 0) {
+      regs->SFIFO = UART_SFIFO_RXUF_MASK;
+      break;
+    }
+
+    rtems_termios_enqueue_raw_characters(ctx->tty, &c, 1);
+    ++ctx->stats.rx_bytes;
+  } while (regs->RCFIFO != 0);
 }
 
+static void usart_interrupt(void *arg)
+{
+  usart_context *ctx = arg;
+  UART_Type *regs = ctx->regs;
+  uint8_t s1 = regs->S1;
+#ifndef USART_USE_DMA
+  struct rtems_termios_tty *tty = ctx->tty;
+  char buf [8];
+  size_t n;
+#endif
+
+  ++ctx->stats.interrupts;
+
+#ifdef USART_USE_DMA
+  if ((s1 & (UART_S1_IDLE_MASK | USART_S1_RX_ERRORS)) != 0) {
+    usart_dma_rx_drain(ctx);
+
+    /*
+     * Reading D clears the flags, but this must not steal a character from
+     * the DMA.  If the FIFO is not yet empty, the flags are cleared by the
+     * next interrupt.
+     */
+    if (regs->RCFIFO == 0) {
+      usart_clear_rx_flags(ctx);
+    }
+  }
+#else
+  if (
+    (s1 & (UART_S1_RDRF_MASK | UART_S1_IDLE_MASK | USART_S1_RX_ERRORS)) != 0
+  ) {
+    n = regs->RCFIFO;
+
+    while (n > 0) {
+      size_t i;
+      size_t m = n < sizeof(buf) ? n : sizeof(buf);
+
+      for (i = 0; i < m; ++i) {
+        buf [i] = (char) regs->D;
+      }
+
+      rtems_termios_enqueue_raw_characters(tty, buf, (int) m);
+      ctx->stats.rx_bytes += m;
+      n -= m;
+    }
+
+    if (
+      (s1 & (UART_S1_IDLE_MASK | USART_S1_RX_ERRORS)) != 0
+        && regs->RCFIFO == 0
+    ) {
+      usart_clear_rx_flags(ctx);
+    }
+  }
+#endif
+
+  if ((s1 & USART_S1_RX_ERRORS) != 0) {
+    ++ctx->stats.rx_errors;
+  }
+
+#ifndef USART_USE_DMA
+  if (ctx->transmitting && (s1 & UART_S1_TDRE_MASK) != 0) {
+    size_t sent = ctx->tx_queued;
+
+    regs->C2 &= ~UART_C2_TIE_MASK;
+    ctx->transmitting = false;
+    ctx->tx_queued = 0;
+    ctx->stats.tx_bytes += sent;
+    rtems_termios_dequeue_characters(tty, (int) sent);
+  }
+#endif
+}
+#endif
+
 static int usart_first_open(int major, int minor, void *arg)
 {
   rtems_libio_open_close_args_t *oc = (rtems_libio_open_close_args_t *) arg;
   struct rtems_termios_tty *tty = (struct rtems_termios_tty *) oc->iop->data1;
   const console_tbl *ct = Console_Port_Tbl [minor];
   console_data *cd = &Console_Port_Data [minor];
+#if CONSOLE_USE_INTERRUPTS
+  usart_context *ctx = usart_get_context(minor);
+  UART_Type *regs = ctx->regs;
+  rtems_status_code sc;
+#endif
 
   cd->termios_data = tty;
   rtems_termios_set_initial_baud(tty, ct->ulClock);
 
+#if CONSOLE_USE_INTERRUPTS
+  ctx->tty = tty;
+  ctx->tx_queued = 0;
+  ctx->transmitting = false;
+
+  regs->C2 &= ~(UART_C2_TIE_MASK | UART_C2_TCIE_MASK | UART_C2_RIE_MASK
+    | UART_C2_ILIE_MASK);
+  UART_SetTxFifoWatermark(regs, USART_TX_WATERMARK);
+  UART_SetRxFifoWatermark(regs, USART_RX_WATERMARK);
+
+  sc = rtems_interrupt_handler_install(
+    usart_get_irq_number(ct),
+    "USART",
+    RTEMS_INTERRUPT_UNIQUE,
+    usart_interrupt,
+    ctx
+  );
+  if (sc != RTEMS_SUCCESSFUL) {
+    return -1;
+  }
+
+#ifdef USART_USE_DMA
+  if (usart_dma_start(ctx) != 0) {
+    rtems_interrupt_handler_remove(
+      usart_get_irq_number(ct),
+      usart_interrupt,
+      ctx
+    );
+    return -1;
+  }
+#endif
+
+  regs->C3 |= UART_C3_ORIE_MASK;
+  regs->C2 |= UART_C2_RIE_MASK | UART_C2_ILIE_MASK;
+#endif
+
   return 0;
 }
 
 static int usart_last_close(int major, int minor, void *arg)
 {
+#if CONSOLE_USE_INTERRUPTS
+  const console_tbl *ct = Console_Port_Tbl [minor];
+  usart_context *ctx = usart_get_context(minor);
+  UART_Type *regs = ctx->regs;
+
+  regs->C2 &= ~(UART_C2_TIE_MASK | UART_C2_RIE_MASK | UART_C2_ILIE_MASK);
+  regs->C3 &= ~UART_C3_ORIE_MASK;
+#ifdef USART_USE_DMA
+  usart_dma_stop(ctx);
+#endif
+  rtems_interrupt_handler_remove(
+    usart_get_irq_number(ct),
+    usart_interrupt,
+    ctx
+  );
+#endif
+
   return 0;
 }
 
-static int usart_read_polled(int minor)
+int mk64f12_usart_read_polled(int minor)
 {
-  /* const console_tbl *ct = Console_Port_Tbl [minor]; */
+  const console_tbl *ct = Console_Port_Tbl [minor];
+  UART_Type *regs = usart_get_regs(ct);
+
+  if (UART_GetRxFifoCount(regs) > 0)
+    return UART_ReadByte(regs) & 0xFF;
 
-  if (UART_GetRxFifoCount(UART0) > 0)
-    return UART_ReadByte(UART0) & 0xFF;
-  
   return -1;
 }
 
 static void usart_write_polled(int minor, char c)
 {
-/*  const console_tbl *ct = Console_Port_Tbl [minor]; */
-  UART_WriteBlocking(UART0, (const uint8_t *)&c, 1);
+  const console_tbl *ct = Console_Port_Tbl [minor];
+  UART_Type *regs = usart_get_regs(ct);
+
+  UART_WriteBlocking(regs, (const uint8_t *)&c, 1);
 }
 
+#ifdef USART_USE_DMA
+static ssize_t usart_write_support_dma(
+  int minor,
+  const char *s,
+  size_t n
+)
+{
+  usart_context *ctx = usart_get_context(minor);
+  UART_Type *regs = ctx->regs;
+
+  regs->C2 &= ~UART_C2_TIE_MASK;
+
+  if (n > 0) {
+    struct fsl_edma_tcd tcd;
+
+    /* The Termios output buffer stays valid until the characters dequeue */
+    if (n > USART_DMA_TX_MAX_TRANSFER) {
+      n = USART_DMA_TX_MAX_TRANSFER;
+    }
+
+    tcd.SADDR = (uint32_t) s;
+    tcd.SDF = EDMA_TCD_SDF_SSIZE_8BIT | EDMA_TCD_SDF_DSIZE_8BIT
+      | EDMA_TCD_SDF_SOFF(1);
+    tcd.NBYTES = 1;
+    tcd.SLAST = 0;
+    tcd.DADDR = (uint32_t) &regs->D;
+    tcd.CDF = EDMA_TCD_CDF_CITER(n) | EDMA_TCD_CDF_DOFF(0);
+    tcd.DLAST_SGA = 0;
+    tcd.BMF = EDMA_TCD_BMF_BITER(n) | EDMA_TCD_BMF_INT_MAJ
+      | EDMA_TCD_BMF_D_REQ;
+
+    ctx->tx_queued = n;
+    ctx->transmitting = true;
+    fsl_edma_copy_and_enable_hardware_requests(ctx->tx_edma.edma_tcd, &tcd);
+    regs->C2 |= UART_C2_TIE_MASK;
+  }
+
+  return 0;
+}
+#elif CONSOLE_USE_INTERRUPTS
+static ssize_t usart_write_support_int(
+  int minor,
+  const char *s,
+  size_t n
+)
+{
+  usart_context *ctx = usart_get_context(minor);
+  UART_Type *regs = ctx->regs;
+  size_t space;
+  size_t i;
+
+  regs->C2 &= ~UART_C2_TIE_MASK;
+
+  if (n > 0) {
+    /*
+     * The polled output of printk() may fill the FIFO, so wait at most one
+     * character time for free space.  The transmission state is only set up
+     * if characters are queued, otherwise no interrupt would complete it.
+     */
+    do {
+      space = ctx->fifo_size - regs->TCFIFO;
+    } while (space == 0);
+
+    if (n > space) {
+      n = space;
+    }
+
+    for (i = 0; i < n; ++i) {
+      regs->D = (uint8_t) s [i];
+    }
+
+    ctx->tx_queued = n;
+    ctx->transmitting = true;
+    regs->C2 |= UART_C2_TIE_MASK;
+  }
+
+  return 0;
+}
+#else
 static ssize_t usart_write_support_polled(
   int minor,
   const char *s,
   size_t n
 )
 {
+  usart_context *ctx = usart_get_context(minor);
   ssize_t i = 0;
 
   for (i = 0; i < n; ++i) {
     usart_write_polled(minor, s [i]);
   }
 
+  ctx->stats.tx_bytes += n;
+
   return n;
 }
+#endif
 
 static int usart_set_attributes(int minor, const struct termios *term)
 {
-  return -1;
+  usart_context *ctx = usart_get_context(minor);
+  UART_Type *regs = ctx->regs;
+  int32_t baud = rtems_termios_baud_to_number(term->c_ospeed);
+  uint8_t c1 = regs->C1 & ~(UART_C1_M_MASK | UART_C1_PE_MASK | UART_C1_PT_MASK);
+  uint8_t bdh = regs->BDH & ~UART_BDH_SBNS_MASK;
+  uint8_t c2;
+
+  /*
+   * The frame is either 8 or 9 bits long including the parity bit, so seven
+   * data bits are only possible with parity and eight data bits with parity
+   * need the 9-bit mode.
+   */
+  switch (term->c_cflag & CSIZE) {
+    case CS7:
+      if ((term->c_cflag & PARENB) == 0) {
+        return -1;
+      }
+      break;
+    case CS8:
+      if ((term->c_cflag & PARENB) != 0) {
+        c1 |= UART_C1_M_MASK;
+      }
+      break;
+    default:
+      return -1;
+  }
+
+  if ((term->c_cflag & PARENB) != 0) {
+    c1 |= UART_C1_PE_MASK;
+
+    if ((term->c_cflag & PARODD) != 0) {
+      c1 |= UART_C1_PT_MASK;
+    }
+  }
+
+  if ((term->c_cflag & CSTOPB) != 0) {
+    bdh |= UART_BDH_SBNS_MASK;
+  }
+
+  /* Let the transmitter drain before the frame format changes */
+  while ((regs->S1 & UART_S1_TC_MASK) == 0) {
+    /* Wait */
+  }
+
+  c2 = regs->C2;
+  regs->C2 = c2 & ~(UART_C2_TE_MASK | UART_C2_RE_MASK);
+
+  /* There are no modem control lines to de-assert for B0 */
+  if (baud > 0) {
+    status_t status = UART_SetBaudRate(
+      regs,
+      (uint32_t) baud,
+      usart_get_source_clock(regs)
+    );
+
+    if (status != kStatus_Success) {
+      regs->C2 = c2;
+      return -1;
+    }
+
+    ctx->baud = (uint32_t) baud;
+  }
+
+  regs->BDH = (regs->BDH & UART_BDH_SBR_MASK) | (bdh & ~UART_BDH_SBR_MASK);
+  regs->C1 = c1;
+  regs->C2 = c2;
+
+  return 0;
+}
+
+void mk64f12_usart_get_statistics(
+  int minor,
+  mk64f12_usart_statistics *stats
+)
+{
+  usart_context *ctx = usart_get_context(minor);
+  rtems_interrupt_level level;
+
+  rtems_interrupt_disable(level);
+  *stats = ctx->stats;
+  rtems_interrupt_enable(level);
+}
+
+void mk64f12_usart_set_loopback(int minor, bool enable)
+{
+  usart_context *ctx = usart_get_context(minor);
+  UART_Type *regs = ctx->regs;
+  rtems_interrupt_level level;
+
+  rtems_interrupt_disable(level);
+
+  if (enable) {
+    regs->C1 = (regs->C1 & ~UART_C1_RSRC_MASK) | UART_C1_LOOPS_MASK;
+  } else {
+    regs->C1 &= ~UART_C1_LOOPS_MASK;
+  }
+
+  rtems_interrupt_enable(level);
 }
 
 const console_fns mk64f12_usart_fns = {
   .deviceProbe = libchip_serial_default_probe,
   .deviceFirstOpen = usart_first_open,
   .deviceLastClose = usart_last_close,
-  .deviceRead = usart_read_polled,
+#if defined(USART_USE_DMA)
+  .deviceRead = NULL,
+  .deviceWrite = usart_write_support_dma,
+#elif CONSOLE_USE_INTERRUPTS
+  .deviceRead = NULL,
+  .deviceWrite = usart_write_support_int,
+#else
+  .deviceRead = mk64f12_usart_read_polled,
   .deviceWrite = usart_write_support_polled,
+#endif
   .deviceInitialize = usart_initialize,
   .deviceWritePolled = usart_write_polled,
   .deviceSetAttributes = usart_set_attributes,
-  .deviceOutputUsesInterrupts = false
+  .deviceOutputUsesInterrupts = CONSOLE_USE_INTERRUPTS
 };
@@ -0,0 +1,266 @@
+/*
+ * Copyright (c) 2026 Dave Rush.  All rights reserved.
+ *
+ * The license and distribution terms for this file may be
+ * found in the file LICENSE in this distribution or at
+ * http://www.rtems.org/license/LICENSE.
+ */
+
+#include <bsp.h>
+#include <bsp/crc.h>
+#include <bsp/mk64f12.h>
+
+#include <fsl/edma.h>
+#include <rtems/crc32.h>
+#include <rtems/score/sysstate.h>
+#include <rtems/thread.h>
+
+#include <MK64F12.h>
+
+/*
+ * The reflected CRC-32 is computed by the module with the non-reflected
+ * polynomial, if the bits and bytes of the written words and of the result
+ * are transposed.  The transposition of the seed turns the reflected CRC-32
+ * state into the register state of the module.
+ */
+#define CRC_CTRL_CRC32 \
+  (CRC_CTRL_TOT(2) | CRC_CTRL_TOTR(2) | CRC_CTRL_TCRC_MASK)
+
+#define CRC_POLY 0x04c11db7
+
+#define CRC_POLY_REFLECTED 0xedb88320
+
+/* Below this size, the mutex costs more than the portable implementation */
+#define CRC_MIN_SIZE 64
+
+/*
+ * The eDMA moves a minor loop per request of the always enabled DMAMUX
+ * source, so that other channels get the bus in between.
+ */
+#define CRC_DMA_MINOR_LOOP_SIZE 32
+
+#define CRC_DMA_MAX_MAJOR_LOOP_COUNT 0x7fff
+
+#define CRC_DMA_SOURCE (kDmaRequestMux0AlwaysOn63 & 0xff)
+
+typedef struct {
+  rtems_mutex mutex;
+  rtems_binary_semaphore done;
+  fsl_edma_channel_context edma;
+  uint32_t dma_error;
+  bool has_dma;
+} crc_context;
+
+static crc_context crc_instance = {
+  .mutex = RTEMS_MUTEX_INITIALIZER("CRC"),
+  .done = RTEMS_BINARY_SEMAPHORE_INITIALIZER("CRC")
+};
+
+/* Only used for the at most three bytes before and after the words */
+static uint32_t crc_update_bytes(uint32_t crc, const uint8_t *p, size_t n)
+{
+  while (n > 0) {
+    int i;
+
+    crc ^= *p;
+
+    for (i = 0; i < 8; ++i) {
+      crc = (crc >> 1) ^ (CRC_POLY_REFLECTED & -(crc & 1));
+    }
+
+    ++p;
+    --n;
+  }
+
+  return crc;
+}
+
+static void crc_seed(CRC_Type *regs, uint32_t crc)
+{
+  regs->CTRL = CRC_CTRL_CRC32 | CRC_CTRL_WAS_MASK;
+  regs->DATA = crc;
+  regs->CTRL = CRC_CTRL_CRC32;
+}
+
+static void crc_cpu_feed(CRC_Type *regs, const uint32_t *words, size_t n)
+{
+  while (n >= 4) {
+    regs->DATA = words[0];
+    regs->DATA = words[1];
+    regs->DATA = words[2];
+    regs->DATA = words[3];
+    words += 4;
+    n -= 4;
+  }
+
+  while (n > 0) {
+    regs->DATA = *words;
+    ++words;
+    --n;
+  }
+}
+
+static void crc_dma_done(fsl_edma_channel_context *edma, uint32_t error)
+{
+  crc_context *ctx = RTEMS_CONTAINER_OF(edma, crc_context, edma);
+
+  ctx->dma_error = error;
+  rtems_binary_semaphore_post(&ctx->done);
+}
+
+static bool crc_dma_feed(
+  crc_context *ctx,
+  CRC_Type *regs,
+  const uint32_t *words,
+  size_t major
+)
+{
+  struct fsl_edma_tcd tcd;
+
+  tcd.SADDR = (uint32_t) words;
+  tcd.SDF = EDMA_TCD_SDF_SSIZE_32BIT | EDMA_TCD_SDF_DSIZE_32BIT
+    | EDMA_TCD_SDF_SOFF(4);
+  tcd.NBYTES = CRC_DMA_MINOR_LOOP_SIZE;
+  tcd.SLAST = 0;
+  tcd.DADDR = (uint32_t) &regs->DATA;
+  tcd.CDF = EDMA_TCD_CDF_CITER(major) | EDMA_TCD_CDF_DOFF(0);
+  tcd.DLAST_SGA = 0;
+  tcd.BMF = EDMA_TCD_BMF_BITER(major) | EDMA_TCD_BMF_INT_MAJ
+    | EDMA_TCD_BMF_D_REQ;
+  fsl_edma_copy_and_enable_hardware_requests(ctx->edma.edma_tcd, &tcd);
+  rtems_binary_semaphore_wait(&ctx->done);
+
+  if (ctx->dma_error != 0) {
+    fsl_edma_disable_hardware_requests(ctx->edma.edma_tcd);
+    return false;
+  }
+
+  return true;
+}
+
+static bool crc_compute(
+  crc_context *ctx,
+  uint32_t *crc,
+  const uint8_t *p,
+  size_t len,
+  bool use_dma
+)
+{
+  CRC_Type *regs = CRC0;
+  const uint32_t *words;
+  size_t head;
+  size_t n;
+  uint32_t state;
+
+  head = (-(uintptr_t) p) & 3;
+  state = crc_update_bytes(*crc, p, head);
+  p += head;
+  len -= head;
+  words = (const uint32_t *) p;
+  n = len / 4;
+
+  crc_seed(regs, state);
+
+  if (use_dma) {
+    while (
+      n * 4 >= MK64F12_CRC_DMA_THRESHOLD
+        && n * 4 >= CRC_DMA_MINOR_LOOP_SIZE
+    ) {
+      size_t major;
+
+      major = (n * 4) / CRC_DMA_MINOR_LOOP_SIZE;
+      if (major > CRC_DMA_MAX_MAJOR_LOOP_COUNT) {
+        major = CRC_DMA_MAX_MAJOR_LOOP_COUNT;
+      }
+
+      if (!crc_dma_feed(ctx, regs, words, major)) {
+        return false;
+      }
+
+      words += major * (CRC_DMA_MINOR_LOOP_SIZE / 4);
+      n -= major * (CRC_DMA_MINOR_LOOP_SIZE / 4);
+    }
+  }
+
+  crc_cpu_feed(regs, words, n);
+  state = regs->DATA;
+  *crc = crc_update_bytes(state, (const uint8_t *) (words + n), len & 3);
+  return true;
+}
+
+bool mk64f12_crc32_backend(uint32_t *crc, const void *buf, size_t len)
+{
+  crc_context *ctx = &crc_instance;
+  bool ok;
+
+  if (
+    len < CRC_MIN_SIZE
+      || rtems_interrupt_is_in_progress()
+      || !_System_state_Is_up(_System_state_Get())
+  ) {
+    return false;
+  }
+
+  rtems_mutex_lock(&ctx->mutex);
+  ok = crc_compute(ctx, crc, buf, len, ctx->has_dma);
+  rtems_mutex_unlock(&ctx->mutex);
+
+  return ok;
+}
+
+static bool crc_self_test(crc_context *ctx)
+{
+  static const uint8_t data[] = "The quick brown fox jumps over the lazy dog";
+  uint32_t expected;
+  uint32_t actual;
+
+  /*
+   * Start with an asymmetric seed at an odd address, so that the seed
+   * transposition and the bytes before and after the words are covered.
+   */
+  expected = crc_update_bytes(0x12345678, &data[1], sizeof(data) - 2);
+  actual = 0x12345678;
+
+  return crc_compute(ctx, &actual, &data[1], sizeof(data) - 2, false)
+    && actual == expected;
+}
+
+static bool crc_dma_init(crc_context *ctx)
+{
+  rtems_status_code sc;
+  unsigned channel;
+
+  ctx->edma.done = crc_dma_done;
+  sc = fsl_edma_obtain_next_free_channel(&ctx->edma);
+  if (sc != RTEMS_SUCCESSFUL) {
+    return false;
+  }
+
+  channel = fsl_edma_channel_index_of_tcd(ctx->edma.edma_tcd);
+  DMAMUX->CHCFG[channel] = 0;
+  DMAMUX->CHCFG[channel] = DMAMUX_CHCFG_SOURCE(CRC_DMA_SOURCE)
+    | DMAMUX_CHCFG_ENBL_MASK;
+
+  return true;
+}
+
+void mk64f12_crc_initialize(void)
+{
+  crc_context *ctx = &crc_instance;
+
+  CLOCK_EnableClock(kCLOCK_Crc0);
+  CRC0->CTRL = CRC_CTRL_CRC32;
+  CRC0->GPOLY = CRC_POLY;
+
+  /*
+   * This runs before the multitasking starts, so the module is used without
+   * the mutex.
+   */
+  if (!crc_self_test(ctx)) {
+    CLOCK_DisableClock(kCLOCK_Crc0);
+    return;
+  }
+
+  ctx->has_dma = MK64F12_CRC_DMA_THRESHOLD > 0 && crc_dma_init(ctx);
+  rtems_crc32_set_backend(mk64f12_crc32_backend);
+}
@@ -0,0 +1,265 @@
+/*
+ * Copyright (c) 2026 Dave Rush.  All rights reserved.
+ *
+ * The license and distribution terms for this file may be
+ * found in the file LICENSE in this distribution or at
+ * http://www.rtems.org/license/LICENSE.
+ */
+
+/*
+ * Software block transforms tuned for the Cortex-M4.  Compared to the
+ * portable C transforms of libmd they
+ *
+ * - load the message words with a single LDR, which supports unaligned
+ *   addresses on the Cortex-M4, and REV instead of assembling them byte by
+ *   byte,
+ *
+ * - keep the SHA-256 message schedule in a window of 16 words instead of
+ *   64 words, so that it stays in the data cache lines of the stack,
+ *
+ * - are written so that the rotations fold into the shifter operand and the
+ *   MD5 round functions map to BIC and ORN.
+ */
+
+#include <bsp/mmcau.h>
+
+#include <string.h>
+
+static inline uint32_t load_word(const unsigned char *p)
+{
+  uint32_t v;
+
+  memcpy(&v, p, sizeof(v));
+  return v;
+}
+
+#define ROTL(x, n) (((x) << (n)) | ((x) >> (32 - (n))))
+
+#define ROTR(x, n) (((x) >> (n)) | ((x) << (32 - (n))))
+
+#define MD5_F(x, y, z) ((z) ^ ((x) & ((y) ^ (z))))
+
+#define MD5_G(x, y, z) (((x) & (z)) | ((y) & ~(z)))
+
+#define MD5_H(x, y, z) ((x) ^ (y) ^ (z))
+
+#define MD5_I(x, y, z) ((y) ^ ((x) | ~(z)))
+
+/* The message words are little-endian like the Cortex-M4 */
+#define X(i) load_word(&blocks[4 * (i)])
+
+#define MD5_STEP(f, a, b, c, d, x, s, t) \
+  do { \
+    a += f(b, c, d) + (x) + (t); \
+    a = ROTL(a, s) + b; \
+  } while (0)
+
+void mk64f12_armv7em_md5_transform(
+  uint32_t *state,
+  const unsigned char *blocks,
+  size_t count
+)
+{
+  while (count > 0) {
+    uint32_t a;
+    uint32_t b;
+    uint32_t c;
+    uint32_t d;
+
+    a = state[0];
+    b = state[1];
+    c = state[2];
+    d = state[3];
+
+    MD5_STEP(MD5_F, a, b, c, d, X(0), 7, 0xd76aa478);
+    MD5_STEP(MD5_F, d, a, b, c, X(1), 12, 0xe8c7b756);
+    MD5_STEP(MD5_F, c, d, a, b, X(2), 17, 0x242070db);
+    MD5_STEP(MD5_F, b, c, d, a, X(3), 22, 0xc1bdceee);
+    MD5_STEP(MD5_F, a, b, c, d, X(4), 7, 0xf57c0faf);
+    MD5_STEP(MD5_F, d, a, b, c, X(5), 12, 0x4787c62a);
+    MD5_STEP(MD5_F, c, d, a, b, X(6), 17, 0xa8304613);
+    MD5_STEP(MD5_F, b, c, d, a, X(7), 22, 0xfd469501);
+    MD5_STEP(MD5_F, a, b, c, d, X(8), 7, 0x698098d8);
+    MD5_STEP(MD5_F, d, a, b, c, X(9), 12, 0x8b44f7af);
+    MD5_STEP(MD5_F, c, d, a, b, X(10), 17, 0xffff5bb1);
+    MD5_STEP(MD5_F, b, c, d, a, X(11), 22, 0x895cd7be);
+    MD5_STEP(MD5_F, a, b, c, d, X(12), 7, 0x6b901122);
+    MD5_STEP(MD5_F, d, a, b, c, X(13), 12, 0xfd987193);
+    MD5_STEP(MD5_F, c, d, a, b, X(14), 17, 0xa679438e);
+    MD5_STEP(MD5_F, b, c, d, a, X(15), 22, 0x49b40821);
+
+    MD5_STEP(MD5_G, a, b, c, d, X(1), 5, 0xf61e2562);
+    MD5_STEP(MD5_G, d, a, b, c, X(6), 9, 0xc040b340);
+    MD5_STEP(MD5_G, c, d, a, b, X(11), 14, 0x265e5a51);
+    MD5_STEP(MD5_G, b, c, d, a, X(0), 20, 0xe9b6c7aa);
+    MD5_STEP(MD5_G, a, b, c, d, X(5), 5, 0xd62f105d);
+    MD5_STEP(MD5_G, d, a, b, c, X(10), 9, 0x02441453);
+    MD5_STEP(MD5_G, c, d, a, b, X(15), 14, 0xd8a1e681);
+    MD5_STEP(MD5_G, b, c, d, a, X(4), 20, 0xe7d3fbc8);
+    MD5_STEP(MD5_G, a, b, c, d, X(9), 5, 0x21e1cde6);
+    MD5_STEP(MD5_G, d, a, b, c, X(14), 9, 0xc33707d6);
+    MD5_STEP(MD5_G, c, d, a, b, X(3), 14, 0xf4d50d87);
+    MD5_STEP(MD5_G, b, c, d, a, X(8), 20, 0x455a14ed);
+    MD5_STEP(MD5_G, a, b, c, d, X(13), 5, 0xa9e3e905);
+    MD5_STEP(MD5_G, d, a, b, c, X(2), 9, 0xfcefa3f8);
+    MD5_STEP(MD5_G, c, d, a, b, X(7), 14, 0x676f02d9);
+    MD5_STEP(MD5_G, b, c, d, a, X(12), 20, 0x8d2a4c8a);
+
+    MD5_STEP(MD5_H, a, b, c, d, X(5), 4, 0xfffa3942);
+    MD5_STEP(MD5_H, d, a, b, c, X(8), 11, 0x8771f681);
+    MD5_STEP(MD5_H, c, d, a, b, X(11), 16, 0x6d9d6122);
+    MD5_STEP(MD5_H, b, c, d, a, X(14), 23, 0xfde5380c);
+    MD5_STEP(MD5_H, a, b, c, d, X(1), 4, 0xa4beea44);
+    MD5_STEP(MD5_H, d, a, b, c, X(4), 11, 0x4bdecfa9);
+    MD5_STEP(MD5_H, c, d, a, b, X(7), 16, 0xf6bb4b60);
+    MD5_STEP(MD5_H, b, c, d, a, X(10), 23, 0xbebfbc70);
+    MD5_STEP(MD5_H, a, b, c, d, X(13), 4, 0x289b7ec6);
+    MD5_STEP(MD5_H, d, a, b, c, X(0), 11, 0xeaa127fa);
+    MD5_STEP(MD5_H, c, d, a, b, X(3), 16, 0xd4ef3085);
+    MD5_STEP(MD5_H, b, c, d, a, X(6), 23, 0x04881d05);
+    MD5_STEP(MD5_H, a, b, c, d, X(9), 4, 0xd9d4d039);
+    MD5_STEP(MD5_H, d, a, b, c, X(12), 11, 0xe6db99e5);
+    MD5_STEP(MD5_H, c, d, a, b, X(15), 16, 0x1fa27cf8);
+    MD5_STEP(MD5_H, b, c, d, a, X(2), 23, 0xc4ac5665);
+
+    MD5_STEP(MD5_I, a, b, c, d, X(0), 6, 0xf4292244);
+    MD5_STEP(MD5_I, d, a, b, c, X(7), 10, 0x432aff97);
+    MD5_STEP(MD5_I, c, d, a, b, X(14), 15, 0xab9423a7);
+    MD5_STEP(MD5_I, b, c, d, a, X(5), 21, 0xfc93a039);
+    MD5_STEP(MD5_I, a, b, c, d, X(12), 6, 0x655b59c3);
+    MD5_STEP(MD5_I, d, a, b, c, X(3), 10, 0x8f0ccc92);
+    MD5_STEP(MD5_I, c, d, a, b, X(10), 15, 0xffeff47d);
+    MD5_STEP(MD5_I, b, c, d, a, X(1), 21, 0x85845dd1);
+    MD5_STEP(MD5_I, a, b, c, d, X(8), 6, 0x6fa87e4f);
+    MD5_STEP(MD5_I, d, a, b, c, X(15), 10, 0xfe2ce6e0);
+    MD5_STEP(MD5_I, c, d, a, b, X(6), 15, 0xa3014314);
+    MD5_STEP(MD5_I, b, c, d, a, X(13), 21, 0x4e0811a1);
+    MD5_STEP(MD5_I, a, b, c, d, X(4), 6, 0xf7537e82);
+    MD5_STEP(MD5_I, d, a, b, c, X(11), 10, 0xbd3af235);
+    MD5_STEP(MD5_I, c, d, a, b, X(2), 15, 0x2ad7d2bb);
+    MD5_STEP(MD5_I, b, c, d, a, X(9), 21, 0xeb86d391);
+
+    state[0] += a;
+    state[1] += b;
+    state[2] += c;
+    state[3] += d;
+
+    blocks += 64;
+    --count;
+  }
+}
+
+static const uint32_t sha256_k[64] = {
+  0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5,
+  0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+  0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3,
+  0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+  0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc,
+  0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+  0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7,
+  0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+  0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13,
+  0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+  0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3,
+  0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+  0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5,
+  0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+  0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208,
+  0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2
+};
+
+#define SHA256_CH(x, y, z) ((z) ^ ((x) & ((y) ^ (z))))
+
+#define SHA256_MAJ(x, y, z) (((x) & (y)) | ((z) & ((x) | (y))))
+
+#define SHA256_S0(x) (ROTR(x, 2) ^ ROTR(x, 13) ^ ROTR(x, 22))
+
+#define SHA256_S1(x) (ROTR(x, 6) ^ ROTR(x, 11) ^ ROTR(x, 25))
+
+#define SHA256_s0(x) (ROTR(x, 7) ^ ROTR(x, 18) ^ ((x) >> 3))
+
+#define SHA256_s1(x) (ROTR(x, 17) ^ ROTR(x, 19) ^ ((x) >> 10))
+
+/* Message word i >= 16 in the window of 16 words */
+#define SHA256_W(w, i) \
+  (w[(i) % 16] += SHA256_s1(w[((i) - 2) % 16]) + w[((i) - 7) % 16] \
+    + SHA256_s0(w[((i) - 15) % 16]))
+
+/*
+ * The working variables are not moved, instead the roles of the variables
+ * rotate from one round to the next.
+ */
+#define SHA256_ROUND(a, b, c, d, e, f, g, h, k, w) \
+  do { \
+    uint32_t t1; \
+    t1 = h + SHA256_S1(e) + SHA256_CH(e, f, g) + (k) + (w); \
+    d += t1; \
+    h = t1 + SHA256_S0(a) + SHA256_MAJ(a, b, c); \
+  } while (0)
+
+#define SHA256_EIGHT_ROUNDS(i, W) \
+  do { \
+    SHA256_ROUND(a, b, c, d, e, f, g, h, sha256_k[(i) + 0], W(w, (i) + 0)); \
+    SHA256_ROUND(h, a, b, c, d, e, f, g, sha256_k[(i) + 1], W(w, (i) + 1)); \
+    SHA256_ROUND(g, h, a, b, c, d, e, f, sha256_k[(i) + 2], W(w, (i) + 2)); \
+    SHA256_ROUND(f, g, h, a, b, c, d, e, sha256_k[(i) + 3], W(w, (i) + 3)); \
+    SHA256_ROUND(e, f, g, h, a, b, c, d, sha256_k[(i) + 4], W(w, (i) + 4)); \
+    SHA256_ROUND(d, e, f, g, h, a, b, c, sha256_k[(i) + 5], W(w, (i) + 5)); \
+    SHA256_ROUND(c, d, e, f, g, h, a, b, sha256_k[(i) + 6], W(w, (i) + 6)); \
+    SHA256_ROUND(b, c, d, e, f, g, h, a, sha256_k[(i) + 7], W(w, (i) + 7)); \
+  } while (0)
+
+#define SHA256_W_LOADED(w, i) (w[(i)])
+
+void mk64f12_armv7em_sha256_transform(
+  uint32_t *state,
+  const unsigned char *blocks,
+  size_t count
+)
+{
+  while (count > 0) {
+    uint32_t w[16];
+    uint32_t a;
+    uint32_t b;
+    uint32_t c;
+    uint32_t d;
+    uint32_t e;
+    uint32_t f;
+    uint32_t g;
+    uint32_t h;
+    int i;
+
+    for (i = 0; i < 16; ++i) {
+      w[i] = __builtin_bswap32(load_word(&blocks[4 * i]));
+    }
+
+    a = state[0];
+    b = state[1];
+    c = state[2];
+    d = state[3];
+    e = state[4];
+    f = state[5];
+    g = state[6];
+    h = state[7];
+
+    SHA256_EIGHT_ROUNDS(0, SHA256_W_LOADED);
+    SHA256_EIGHT_ROUNDS(8, SHA256_W_LOADED);
+
+    for (i = 16; i < 64; i += 16) {
+      SHA256_EIGHT_ROUNDS(i, SHA256_W);
+      SHA256_EIGHT_ROUNDS(i + 8, SHA256_W);
+    }
+
+    state[0] += a;
+    state[1] += b;
+    state[2] += c;
+    state[3] += d;
+    state[4] += e;
+    state[5] += f;
+    state[6] += g;
+    state[7] += h;
+
+    blocks += 64;
+    --count;
+  }
+}
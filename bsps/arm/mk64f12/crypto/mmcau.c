@@ -0,0 +1,391 @@
+/*
+ * Copyright (c) 2026 Dave Rush.  All rights reserved.
+ *
+ * The license and distribution terms for this file may be
+ * found in the file LICENSE in this distribution or at
+ * http://www.rtems.org/license/LICENSE.
+ */
+
+#include <bsp.h>
+#include <bsp/mmcau.h>
+
+#include <rtems/mdtransform.h>
+#include <rtems/score/sysstate.h>
+#include <rtems/thread.h>
+
+#include <string.h>
+
+#include <MK64F12.h>
+
+/*
+ * The MMCAU executes commands written to the direct access register, up to
+ * three per write.  A write to the indirect register of a command and
+ * register executes the command with the written value as operand.
+ */
+#define MMCAU_1_CMD(c1) (0x80000000U | ((c1) << 22))
+
+#define MMCAU_2_CMDS(c1, c2) \
+  (0x80100000U | ((c1) << 22) | ((c2) << 11))
+
+#define MMCAU_3_CMDS(c1, c2, c3) \
+  (0x80100200U | ((c1) << 22) | ((c2) << 11) | (c3))
+
+/* Registers */
+#define CAU_CA0 2
+#define CAU_CA1 3
+#define CAU_CA3 5
+#define CAU_CA7 9
+#define CAU_CA8 10
+
+/* Commands */
+#define CAU_ADRA 0x050
+#define CAU_MVRA 0x080
+#define CAU_MVAR 0x090
+#define CAU_HASH 0x120
+#define CAU_MDS 0x140
+#define CAU_SHS2 0x150
+
+/* Hash functions */
+#define CAU_HFF 0
+#define CAU_HFG 1
+#define CAU_HFH 2
+#define CAU_HFI 3
+#define CAU_HF2C 6
+#define CAU_HF2M 7
+#define CAU_HF2S 8
+#define CAU_HF2T 9
+
+#define ROTR(x, n) (((x) >> (n)) | ((x) << (32 - (n))))
+
+static rtems_mutex mmcau_mutex = RTEMS_MUTEX_INITIALIZER("MMCAU");
+
+static const uint32_t md5_t[64] = {
+  0xd76aa478, 0xe8c7b756, 0x242070db, 0xc1bdceee,
+  0xf57c0faf, 0x4787c62a, 0xa8304613, 0xfd469501,
+  0x698098d8, 0x8b44f7af, 0xffff5bb1, 0x895cd7be,
+  0x6b901122, 0xfd987193, 0xa679438e, 0x49b40821,
+  0xf61e2562, 0xc040b340, 0x265e5a51, 0xe9b6c7aa,
+  0xd62f105d, 0x02441453, 0xd8a1e681, 0xe7d3fbc8,
+  0x21e1cde6, 0xc33707d6, 0xf4d50d87, 0x455a14ed,
+  0xa9e3e905, 0xfcefa3f8, 0x676f02d9, 0x8d2a4c8a,
+  0xfffa3942, 0x8771f681, 0x6d9d6122, 0xfde5380c,
+  0xa4beea44, 0x4bdecfa9, 0xf6bb4b60, 0xbebfbc70,
+  0x289b7ec6, 0xeaa127fa, 0xd4ef3085, 0x04881d05,
+  0xd9d4d039, 0xe6db99e5, 0x1fa27cf8, 0xc4ac5665,
+  0xf4292244, 0x432aff97, 0xab9423a7, 0xfc93a039,
+  0x655b59c3, 0x8f0ccc92, 0xffeff47d, 0x85845dd1,
+  0x6fa87e4f, 0xfe2ce6e0, 0xa3014314, 0x4e0811a1,
+  0xf7537e82, 0xbd3af235, 0x2ad7d2bb, 0xeb86d391
+};
+
+static const uint8_t md5_x[64] = {
+  0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+  1, 6, 11, 0, 5, 10, 15, 4, 9, 14, 3, 8, 13, 2, 7, 12,
+  5, 8, 11, 14, 1, 4, 7, 10, 13, 0, 3, 6, 9, 12, 15, 2,
+  0, 7, 14, 5, 12, 3, 10, 1, 8, 15, 6, 13, 4, 11, 2, 9
+};
+
+static const uint8_t md5_s[16] = {
+  7, 12, 17, 22, 5, 9, 14, 20, 4, 11, 16, 23, 6, 10, 15, 21
+};
+
+static const uint32_t sha256_k[64] = {
+  0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5,
+  0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+  0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3,
+  0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+  0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc,
+  0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+  0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7,
+  0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+  0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13,
+  0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+  0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3,
+  0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+  0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5,
+  0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+  0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208,
+  0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2
+};
+
+/*
+ * One MD5 step with a in CA0, b in CA1, c in CA2 and d in CA3.  The MDS
+ * command rotates the registers for the next step.
+ */
+static inline void mmcau_md5_step(
+  volatile CAU_Type *cau,
+  uint32_t f,
+  uint32_t x,
+  uint32_t t,
+  uint32_t s
+)
+{
+  cau->DIRECT[0] = MMCAU_2_CMDS(CAU_MVRA + CAU_CA0, CAU_HASH + f);
+  cau->ADR_CAA = x;
+  cau->ADR_CAA = t;
+  cau->ROTL_CAA = s;
+  cau->DIRECT[0] = MMCAU_2_CMDS(CAU_ADRA + CAU_CA1, CAU_MDS);
+}
+
+static void mmcau_md5_blocks(
+  uint32_t *state,
+  const unsigned char *blocks,
+  size_t count
+)
+{
+  volatile CAU_Type *cau;
+  uint32_t h[4];
+  int i;
+
+  cau = CAU;
+
+  for (i = 0; i < 4; ++i) {
+    h[i] = state[i];
+    cau->LDR_CA[i] = h[i];
+  }
+
+  while (count > 0) {
+    uint32_t x[16];
+
+    memcpy(x, blocks, sizeof(x));
+
+    for (i = 0; i < 16; ++i) {
+      mmcau_md5_step(cau, CAU_HFF, x[md5_x[i]], md5_t[i], md5_s[i % 4]);
+    }
+
+    for (i = 16; i < 32; ++i) {
+      mmcau_md5_step(cau, CAU_HFG, x[md5_x[i]], md5_t[i], md5_s[4 + i % 4]);
+    }
+
+    for (i = 32; i < 48; ++i) {
+      mmcau_md5_step(cau, CAU_HFH, x[md5_x[i]], md5_t[i], md5_s[8 + i % 4]);
+    }
+
+    for (i = 48; i < 64; ++i) {
+      mmcau_md5_step(cau, CAU_HFI, x[md5_x[i]], md5_t[i], md5_s[12 + i % 4]);
+    }
+
+    /* After 64 steps the registers are back in their initial order */
+    for (i = 0; i < 4; ++i) {
+      cau->ADR_CA[i] = h[i];
+      h[i] = cau->STR_CA[i];
+    }
+
+    blocks += 64;
+    --count;
+  }
+
+  for (i = 0; i < 4; ++i) {
+    state[i] = h[i];
+  }
+}
+
+/*
+ * One SHA-256 round with a to h in CA0 to CA7.  The sum T1 of h, the message
+ * word, the constant, SIGMA1(e) and Ch(e, f, g) is saved in CA8 to update d
+ * and then to compute a.  The SHS2 command shifts the registers for the next
+ * round.
+ */
+static inline void mmcau_sha256_round(
+  volatile CAU_Type *cau,
+  uint32_t w,
+  uint32_t k
+)
+{
+  cau->DIRECT[0] = MMCAU_3_CMDS(
+    CAU_MVRA + CAU_CA7,
+    CAU_HASH + CAU_HF2T,
+    CAU_HASH + CAU_HF2C
+  );
+  cau->ADR_CAA = w;
+  cau->ADR_CAA = k;
+  cau->DIRECT[0] = MMCAU_3_CMDS(
+    CAU_MVAR + CAU_CA8,
+    CAU_ADRA + CAU_CA3,
+    CAU_MVAR + CAU_CA3
+  );
+  cau->DIRECT[0] = MMCAU_3_CMDS(
+    CAU_MVRA + CAU_CA8,
+    CAU_HASH + CAU_HF2S,
+    CAU_HASH + CAU_HF2M
+  );
+  cau->DIRECT[0] = MMCAU_1_CMD(CAU_SHS2);
+}
+
+static void mmcau_sha256_blocks(
+  uint32_t *state,
+  const unsigned char *blocks,
+  size_t count
+)
+{
+  volatile CAU_Type *cau;
+  uint32_t h[8];
+  int i;
+
+  cau = CAU;
+
+  for (i = 0; i < 8; ++i) {
+    h[i] = state[i];
+    cau->LDR_CA[i] = h[i];
+  }
+
+  while (count > 0) {
+    uint32_t w[16];
+
+    memcpy(w, blocks, sizeof(w));
+
+    for (i = 0; i < 16; ++i) {
+      w[i] = __builtin_bswap32(w[i]);
+      mmcau_sha256_round(cau, w[i], sha256_k[i]);
+    }
+
+    /*
+     * The CPU computes the message schedule, this overlaps with the
+     * execution of the previous round by the MMCAU.
+     */
+    for (i = 16; i < 64; ++i) {
+      uint32_t w2;
+      uint32_t w15;
+
+      w2 = w[(i - 2) % 16];
+      w15 = w[(i - 15) % 16];
+      w[i % 16] += (ROTR(w2, 17) ^ ROTR(w2, 19) ^ (w2 >> 10))
+        + w[(i - 7) % 16] + (ROTR(w15, 7) ^ ROTR(w15, 18) ^ (w15 >> 3));
+      mmcau_sha256_round(cau, w[i % 16], sha256_k[i]);
+    }
+
+    /* After 64 rounds the registers are back in their initial order */
+    for (i = 0; i < 8; ++i) {
+      cau->ADR_CA[i] = h[i];
+      h[i] = cau->STR_CA[i];
+    }
+
+    blocks += 64;
+    --count;
+  }
+
+  for (i = 0; i < 8; ++i) {
+    state[i] = h[i];
+  }
+}
+
+/*
+ * Before the multitasking starts, there is only one user of the MMCAU and the
+ * mutex must not be used.
+ */
+static void mmcau_lock(void)
+{
+  if (_System_state_Is_up(_System_state_Get())) {
+    rtems_mutex_lock(&mmcau_mutex);
+  }
+}
+
+static void mmcau_unlock(void)
+{
+  if (_System_state_Is_up(_System_state_Get())) {
+    rtems_mutex_unlock(&mmcau_mutex);
+  }
+}
+
+void mk64f12_mmcau_md5_transform(
+  uint32_t *state,
+  const unsigned char *blocks,
+  size_t count
+)
+{
+  if (rtems_interrupt_is_in_progress()) {
+    mk64f12_armv7em_md5_transform(state, blocks, count);
+    return;
+  }
+
+  mmcau_lock();
+  mmcau_md5_blocks(state, blocks, count);
+  mmcau_unlock();
+}
+
+void mk64f12_mmcau_sha256_transform(
+  uint32_t *state,
+  const unsigned char *blocks,
+  size_t count
+)
+{
+  if (rtems_interrupt_is_in_progress()) {
+    mk64f12_armv7em_sha256_transform(state, blocks, count);
+    return;
+  }
+
+  mmcau_lock();
+  mmcau_sha256_blocks(state, blocks, count);
+  mmcau_unlock();
+}
+
+#if MK64F12_MMCAU_HASH
+/* The padded single block message "abc" */
+static void mmcau_abc_block(unsigned char *block, size_t length_offset)
+{
+  memset(block, 0, 64);
+  block[0] = 'a';
+  block[1] = 'b';
+  block[2] = 'c';
+  block[3] = 0x80;
+  block[length_offset] = 3 * 8;
+}
+
+static bool mmcau_md5_self_test(void)
+{
+  static const uint32_t expected[4] = {
+    0x98500190, 0xb04fd23c, 0x7d3f96d6, 0x727fe128
+  };
+  uint32_t state[4] = {
+    0x67452301, 0xefcdab89, 0x98badcfe, 0x10325476
+  };
+  unsigned char block[64];
+
+  mmcau_abc_block(block, 56);
+  mmcau_md5_blocks(state, block, 1);
+  return memcmp(state, expected, sizeof(state)) == 0;
+}
+
+static bool mmcau_sha256_self_test(void)
+{
+  static const uint32_t expected[8] = {
+    0xba7816bf, 0x8f01cfea, 0x414140de, 0x5dae2223,
+    0xb00361a3, 0x96177a9c, 0xb410ff61, 0xf20015ad
+  };
+  uint32_t state[8] = {
+    0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a,
+    0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19
+  };
+  unsigned char block[64];
+
+  mmcau_abc_block(block, 63);
+  mmcau_sha256_blocks(state, block, 1);
+  return memcmp(state, expected, sizeof(state)) == 0;
+}
+#endif
+
+void mk64f12_md_initialize(void)
+{
+  rtems_md_transform md5;
+  rtems_md_transform sha256;
+
+  md5 = mk64f12_armv7em_md5_transform;
+  sha256 = mk64f12_armv7em_sha256_transform;
+
+#if MK64F12_MMCAU_HASH
+  /*
+   * This runs before the multitasking starts, so the MMCAU is used without
+   * the mutex.
+   */
+  if (mmcau_md5_self_test()) {
+    md5 = mk64f12_mmcau_md5_transform;
+  }
+
+  if (mmcau_sha256_self_test()) {
+    sha256 = mk64f12_mmcau_sha256_transform;
+  }
+#endif
+
+  rtems_md5_set_transform(md5);
+  rtems_sha256_set_transform(sha256);
+}
@@ -0,0 +1,321 @@
+/*
+ * Copyright (c) 2026 Dave Rush.  All rights reserved.
+ *
+ * The license and distribution terms for this file may be
+ * found in the file LICENSE in this distribution or at
+ * http://www.rtems.org/license/LICENSE.
+ */
+
+#include <errno.h>
+#include <string.h>
+
+#include <sys/param.h>
+
+#include <bsp/flash.h>
+
+/* Size of the stack buffer of the blank and verify checks */
+#define FLASH_FDISK_CHUNK_SIZE 64
+
+static mk64f12_flash_device *flash_fdisk_device = &mk64f12_flash_internal;
+
+static uint32_t flash_fdisk_page_size = MK64F12_FLASH_FDISK_PAGE_SIZE;
+
+void mk64f12_flash_fdisk_set_device(
+  mk64f12_flash_device *device,
+  uint32_t page_size
+)
+{
+  flash_fdisk_device = device;
+  flash_fdisk_page_size = page_size;
+}
+
+/*
+ * The flash disk sets the used flag of a page descriptor after the descriptor
+ * was written, which would program its phrase a second time.  Such updates
+ * go to the phrase of the page in the shadow area after the segment.  Reads
+ * of the page descriptors combine both phrases like a NOR flash would.
+ */
+static uint32_t flash_fdisk_shadow_size(const rtems_fdisk_segment_desc *sd)
+{
+  return (sd->size / flash_fdisk_page_size) * MK64F12_FLASH_PHRASE_SIZE;
+}
+
+static uint32_t flash_fdisk_stride(const rtems_fdisk_segment_desc *sd)
+{
+  return RTEMS_ALIGN_UP(
+    sd->size + flash_fdisk_shadow_size(sd),
+    MK64F12_FLASH_SECTOR_SIZE
+  );
+}
+
+static uint32_t flash_fdisk_offset(
+  const rtems_fdisk_segment_desc *sd,
+  uint32_t segment,
+  uint32_t offset
+)
+{
+  return sd->offset + (segment - sd->segment) * flash_fdisk_stride(sd) + offset;
+}
+
+static int flash_fdisk_read_raw(
+  const rtems_fdisk_segment_desc *sd,
+  uint32_t segment,
+  uint32_t offset,
+  void *buffer,
+  uint32_t size
+)
+{
+  rtems_status_code sc;
+
+  sc = mk64f12_flash_read(
+    flash_fdisk_device,
+    flash_fdisk_offset(sd, segment, offset),
+    buffer,
+    size
+  );
+  return sc == RTEMS_SUCCESSFUL ? 0 : EIO;
+}
+
+static int flash_fdisk_write_raw(
+  const rtems_fdisk_segment_desc *sd,
+  uint32_t segment,
+  uint32_t offset,
+  const void *buffer,
+  uint32_t size
+)
+{
+  rtems_status_code sc;
+
+  sc = mk64f12_flash_write(
+    flash_fdisk_device,
+    flash_fdisk_offset(sd, segment, offset),
+    buffer,
+    size
+  );
+  return sc == RTEMS_SUCCESSFUL ? 0 : EIO;
+}
+
+static int flash_fdisk_read(
+  const rtems_fdisk_segment_desc *sd,
+  uint32_t device,
+  uint32_t segment,
+  uint32_t offset,
+  void *buffer,
+  uint32_t size
+)
+{
+  uint8_t *out;
+  uint32_t shadow_size;
+  int eno;
+
+  (void) device;
+
+  eno = flash_fdisk_read_raw(sd, segment, offset, buffer, size);
+  out = buffer;
+  shadow_size = flash_fdisk_shadow_size(sd);
+
+  while (eno == 0 && size > 0 && offset < shadow_size) {
+    uint8_t chunk[FLASH_FDISK_CHUNK_SIZE];
+    uint32_t n;
+    uint32_t i;
+
+    n = MIN(MIN(size, shadow_size - offset), sizeof(chunk));
+    eno = flash_fdisk_read_raw(sd, segment, sd->size + offset, chunk, n);
+
+    for (i = 0; i < n; ++i) {
+      out[i] &= chunk[i];
+    }
+
+    out += n;
+    offset += n;
+    size -= n;
+  }
+
+  return eno;
+}
+
+static int flash_fdisk_verify(
+  const rtems_fdisk_segment_desc *sd,
+  uint32_t device,
+  uint32_t segment,
+  uint32_t offset,
+  const void *buffer,
+  uint32_t size
+)
+{
+  const uint8_t *expected;
+
+  expected = buffer;
+
+  while (size > 0) {
+    uint8_t chunk[FLASH_FDISK_CHUNK_SIZE];
+    uint32_t n;
+    int eno;
+
+    n = MIN(size, sizeof(chunk));
+    eno = flash_fdisk_read(sd, device, segment, offset, chunk, n);
+
+    if (eno != 0) {
+      return eno;
+    }
+
+    if (expected != NULL) {
+      if (memcmp(chunk, expected, n) != 0) {
+        return EIO;
+      }
+
+      expected += n;
+    } else {
+      uint32_t i;
+
+      for (i = 0; i < n; ++i) {
+        if (chunk[i] != 0xff) {
+          return EIO;
+        }
+      }
+    }
+
+    offset += n;
+    size -= n;
+  }
+
+  return 0;
+}
+
+static int flash_fdisk_blank(
+  const rtems_fdisk_segment_desc *sd,
+  uint32_t device,
+  uint32_t segment,
+  uint32_t offset,
+  uint32_t size
+)
+{
+  return flash_fdisk_verify(sd, device, segment, offset, NULL, size);
+}
+
+static int flash_fdisk_write(
+  const rtems_fdisk_segment_desc *sd,
+  uint32_t device,
+  uint32_t segment,
+  uint32_t offset,
+  const void *buffer,
+  uint32_t size
+)
+{
+  const uint8_t *in;
+  uint32_t shadow_size;
+  uint32_t begin;
+  int eno;
+
+  in = buffer;
+  begin = offset;
+  shadow_size = flash_fdisk_shadow_size(sd);
+  eno = 0;
+
+  while (eno == 0 && size > 0 && offset < shadow_size) {
+    uint8_t phrase[MK64F12_FLASH_PHRASE_SIZE];
+    uint32_t phrase_offset;
+    uint32_t n;
+    uint32_t i;
+
+    phrase_offset = RTEMS_ALIGN_DOWN(offset, MK64F12_FLASH_PHRASE_SIZE);
+    n = MIN(size, phrase_offset + MK64F12_FLASH_PHRASE_SIZE - offset);
+    eno = flash_fdisk_read_raw(
+      sd,
+      segment,
+      phrase_offset,
+      phrase,
+      sizeof(phrase)
+    );
+
+    for (i = 0; i < sizeof(phrase); ++i) {
+      if (phrase[i] != 0xff) {
+        break;
+      }
+    }
+
+    if (eno == 0) {
+      if (i == sizeof(phrase)) {
+        eno = flash_fdisk_write_raw(sd, segment, offset, in, n);
+      } else {
+        eno = flash_fdisk_write_raw(sd, segment, sd->size + offset, in, n);
+      }
+    }
+
+    in += n;
+    offset += n;
+    size -= n;
+  }
+
+  if (eno == 0 && size > 0) {
+    eno = flash_fdisk_write_raw(sd, segment, offset, in, size);
+  }
+
+  if (eno != 0) {
+    return eno;
+  }
+
+  return flash_fdisk_verify(
+    sd,
+    device,
+    segment,
+    begin,
+    buffer,
+    offset + size - begin
+  );
+}
+
+static int flash_fdisk_erase(
+  const rtems_fdisk_segment_desc *sd,
+  uint32_t device,
+  uint32_t segment
+)
+{
+  rtems_status_code sc;
+
+  (void) device;
+
+  sc = mk64f12_flash_erase(
+    flash_fdisk_device,
+    flash_fdisk_offset(sd, segment, 0),
+    flash_fdisk_stride(sd)
+  );
+  return sc == RTEMS_SUCCESSFUL ? 0 : EIO;
+}
+
+static int flash_fdisk_erase_device(
+  const rtems_fdisk_device_desc *dd,
+  uint32_t device
+)
+{
+  uint32_t i;
+
+  (void) device;
+
+  for (i = 0; i < dd->segment_count; ++i) {
+    const rtems_fdisk_segment_desc *sd;
+    rtems_status_code sc;
+
+    sd = &dd->segments[i];
+    sc = mk64f12_flash_erase(
+      flash_fdisk_device,
+      sd->offset,
+      (size_t) sd->count * flash_fdisk_stride(sd)
+    );
+
+    if (sc != RTEMS_SUCCESSFUL) {
+      return EIO;
+    }
+  }
+
+  return 0;
+}
+
+const rtems_fdisk_driver_handlers mk64f12_flash_fdisk_handlers = {
+  .read = flash_fdisk_read,
+  .write = flash_fdisk_write,
+  .blank = flash_fdisk_blank,
+  .verify = flash_fdisk_verify,
+  .erase = flash_fdisk_erase,
+  .erase_device = flash_fdisk_erase_device
+};
@@ -0,0 +1,256 @@
+/*
+ * Copyright (c) 2026 Dave Rush.  All rights reserved.
+ *
+ * The license and distribution terms for this file may be
+ * found in the file LICENSE in this distribution or at
+ * http://www.rtems.org/license/LICENSE.
+ */
+
+#include <errno.h>
+#include <string.h>
+
+#include <sys/param.h>
+
+#include <bsp/flash.h>
+
+#define FLASH_JFFS2_NO_PENDING UINT32_MAX
+
+static mk64f12_flash_jffs2_control *flash_jffs2_get_control(
+  rtems_jffs2_flash_control *super
+)
+{
+  return RTEMS_CONTAINER_OF(super, mk64f12_flash_jffs2_control, super);
+}
+
+static int flash_jffs2_flush(mk64f12_flash_jffs2_control *self)
+{
+  uint32_t pending;
+  rtems_status_code sc;
+
+  pending = self->pending;
+
+  if (pending == FLASH_JFFS2_NO_PENDING) {
+    return 0;
+  }
+
+  self->pending = FLASH_JFFS2_NO_PENDING;
+  sc = mk64f12_flash_write(
+    self->device,
+    self->offset + pending,
+    self->pending_data,
+    sizeof(self->pending_data)
+  );
+  return sc == RTEMS_SUCCESSFUL ? 0 : -EIO;
+}
+
+static int flash_jffs2_read(
+  rtems_jffs2_flash_control *super,
+  uint32_t offset,
+  unsigned char *buffer,
+  size_t size_of_buffer
+)
+{
+  mk64f12_flash_jffs2_control *self;
+  uint32_t pending;
+  rtems_status_code sc;
+
+  self = flash_jffs2_get_control(super);
+  sc = mk64f12_flash_read(
+    self->device,
+    self->offset + offset,
+    buffer,
+    size_of_buffer
+  );
+
+  if (sc != RTEMS_SUCCESSFUL) {
+    return -EIO;
+  }
+
+  pending = self->pending;
+
+  if (
+    pending != FLASH_JFFS2_NO_PENDING
+      && pending < offset + size_of_buffer
+      && offset < pending + MK64F12_FLASH_PHRASE_SIZE
+  ) {
+    uint32_t begin;
+    uint32_t end;
+
+    begin = MAX(offset, pending);
+    end = MIN(offset + size_of_buffer, pending + MK64F12_FLASH_PHRASE_SIZE);
+    memcpy(
+      &buffer[begin - offset],
+      &self->pending_data[begin - pending],
+      end - begin
+    );
+  }
+
+  return 0;
+}
+
+static int flash_jffs2_write_tail(
+  mk64f12_flash_jffs2_control *self,
+  uint32_t phrase,
+  uint32_t offset,
+  const unsigned char *buffer,
+  size_t size
+)
+{
+  uint8_t data[MK64F12_FLASH_PHRASE_SIZE];
+  rtems_status_code sc;
+  int eno;
+  size_t i;
+
+  eno = flash_jffs2_flush(self);
+
+  if (eno != 0) {
+    return eno;
+  }
+
+  sc = mk64f12_flash_read(
+    self->device,
+    self->offset + phrase,
+    data,
+    sizeof(data)
+  );
+
+  if (sc != RTEMS_SUCCESSFUL) {
+    return -EIO;
+  }
+
+  for (i = 0; i < sizeof(data); ++i) {
+    if (data[i] != 0xff) {
+      sc = mk64f12_flash_write(
+        self->device,
+        self->offset + offset,
+        buffer,
+        size
+      );
+      return sc == RTEMS_SUCCESSFUL ? 0 : -EIO;
+    }
+  }
+
+  memset(self->pending_data, 0xff, sizeof(self->pending_data));
+  memcpy(&self->pending_data[offset - phrase], buffer, size);
+  self->pending = phrase;
+  return 0;
+}
+
+static int flash_jffs2_write(
+  rtems_jffs2_flash_control *super,
+  uint32_t offset,
+  const unsigned char *buffer,
+  size_t size_of_buffer
+)
+{
+  mk64f12_flash_jffs2_control *self;
+
+  self = flash_jffs2_get_control(super);
+
+  /*
+   * A phrase may be programmed only once.  The JFFS2 writes the nodes one
+   * after another, so a write which ends within an erased phrase is buffered
+   * until the phrase is complete.
+   */
+  while (size_of_buffer > 0) {
+    uint32_t phrase;
+    size_t n;
+    int eno;
+
+    phrase = RTEMS_ALIGN_DOWN(offset, MK64F12_FLASH_PHRASE_SIZE);
+    n = phrase + MK64F12_FLASH_PHRASE_SIZE - offset;
+
+    if (phrase == self->pending) {
+      size_t i;
+
+      n = MIN(n, size_of_buffer);
+
+      for (i = 0; i < n; ++i) {
+        self->pending_data[offset - phrase + i] &= buffer[i];
+      }
+
+      if (offset + n == phrase + MK64F12_FLASH_PHRASE_SIZE) {
+        eno = flash_jffs2_flush(self);
+      } else {
+        eno = 0;
+      }
+    } else if (size_of_buffer >= n) {
+      rtems_status_code sc;
+
+      n = RTEMS_ALIGN_DOWN(offset + size_of_buffer, MK64F12_FLASH_PHRASE_SIZE)
+        - offset;
+
+      if (self->pending > phrase && self->pending < offset + n) {
+        n = self->pending - offset;
+      }
+
+      sc = mk64f12_flash_write(
+        self->device,
+        self->offset + offset,
+        buffer,
+        n
+      );
+      eno = sc == RTEMS_SUCCESSFUL ? 0 : -EIO;
+    } else {
+      n = size_of_buffer;
+      eno = flash_jffs2_write_tail(self, phrase, offset, buffer, n);
+    }
+
+    if (eno != 0) {
+      return eno;
+    }
+
+    offset += n;
+    buffer += n;
+    size_of_buffer -= n;
+  }
+
+  return 0;
+}
+
+static int flash_jffs2_erase(
+  rtems_jffs2_flash_control *super,
+  uint32_t offset
+)
+{
+  mk64f12_flash_jffs2_control *self;
+  rtems_status_code sc;
+
+  self = flash_jffs2_get_control(super);
+
+  if (self->pending - offset < super->block_size) {
+    self->pending = FLASH_JFFS2_NO_PENDING;
+  }
+
+  sc = mk64f12_flash_erase(
+    self->device,
+    self->offset + offset,
+    super->block_size
+  );
+  return sc == RTEMS_SUCCESSFUL ? 0 : -EIO;
+}
+
+static void flash_jffs2_destroy(rtems_jffs2_flash_control *super)
+{
+  (void) flash_jffs2_flush(flash_jffs2_get_control(super));
+}
+
+void mk64f12_flash_jffs2_initialize(
+  mk64f12_flash_jffs2_control *self,
+  mk64f12_flash_device *device,
+  uint32_t offset,
+  uint32_t size
+)
+{
+  memset(self, 0, sizeof(*self));
+  self->super.block_size = MK64F12_FLASH_SECTOR_SIZE;
+  self->super.flash_size = size;
+  self->super.read = flash_jffs2_read;
+  self->super.write = flash_jffs2_write;
+  self->super.erase = flash_jffs2_erase;
+  self->super.destroy = flash_jffs2_destroy;
+  self->super.write_size = MK64F12_FLASH_PHRASE_SIZE;
+  self->device = device;
+  self->offset = offset;
+  self->pending = FLASH_JFFS2_NO_PENDING;
+}
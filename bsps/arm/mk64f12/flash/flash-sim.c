@@ -0,0 +1,64 @@
+/*
+ * Copyright (c) 2026 Dave Rush.  All rights reserved.
+ *
+ * The license and distribution terms for this file may be
+ * found in the file LICENSE in this distribution or at
+ * http://www.rtems.org/license/LICENSE.
+ */
+
+#include <string.h>
+
+#include <bsp/flash.h>
+
+static rtems_status_code flash_sim_erase(
+  mk64f12_flash_device *self,
+  uint32_t offset,
+  uint32_t count
+)
+{
+  mk64f12_flash_sim *sim;
+
+  sim = RTEMS_CONTAINER_OF(self, mk64f12_flash_sim, device);
+  memset(&sim->memory[offset], 0xff, count * MK64F12_FLASH_SECTOR_SIZE);
+  return RTEMS_SUCCESSFUL;
+}
+
+static rtems_status_code flash_sim_program(
+  mk64f12_flash_device *self,
+  uint32_t offset,
+  const uint8_t *data,
+  uint32_t count
+)
+{
+  mk64f12_flash_sim *sim;
+  size_t i;
+
+  sim = RTEMS_CONTAINER_OF(self, mk64f12_flash_sim, device);
+
+  if ((offset % MK64F12_FLASH_PHRASE_SIZE) != 0) {
+    return RTEMS_IO_ERROR;
+  }
+
+  /* Programming can only clear bits */
+  for (i = 0; i < count * MK64F12_FLASH_PHRASE_SIZE; ++i) {
+    sim->memory[offset + i] &= data[i];
+  }
+
+  return RTEMS_SUCCESSFUL;
+}
+
+void mk64f12_flash_sim_initialize(
+  mk64f12_flash_sim *sim,
+  void *memory,
+  uint32_t size
+)
+{
+  memset(sim, 0, sizeof(*sim));
+  sim->memory = memory;
+  sim->device.erase = flash_sim_erase;
+  sim->device.program = flash_sim_program;
+  sim->device.memory = memory;
+  sim->device.size = size;
+  rtems_mutex_init(&sim->device.mutex, "Flash Sim");
+  memset(memory, 0xff, size);
+}
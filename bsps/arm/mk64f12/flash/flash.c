@@ -0,0 +1,506 @@
+/*
+ * Copyright (c) 2026 Dave Rush.  All rights reserved.
+ *
+ * The license and distribution terms for this file may be
+ * found in the file LICENSE in this distribution or at
+ * http://www.rtems.org/license/LICENSE.
+ */
+
+#include <string.h>
+
+#include <sys/param.h>
+
+#include <bsp.h>
+#include <bsp/flash.h>
+#include <bsp/fmc.h>
+#include <bsp/irq.h>
+#include <bsp/linker-symbols.h>
+#include <bsp/mk64f12.h>
+
+#include <MK64F12.h>
+
+#define FLASH_COMMAND_PROGRAM_PHRASE 0x07
+
+#define FLASH_COMMAND_ERASE_SECTOR 0x09
+
+#define FLASH_FSTAT_ERRORS \
+  (FTFE_FSTAT_RDCOLERR_MASK | FTFE_FSTAT_ACCERR_MASK | FTFE_FSTAT_FPVIOL_MASK \
+    | FTFE_FSTAT_MGSTAT0_MASK)
+
+/* Count of phrases merged on the stack by mk64f12_flash_write() */
+#define FLASH_CHUNK_PHRASES 32
+
+typedef struct {
+  uint8_t command;
+  uint8_t fstat;
+  bool initialized;
+  uint32_t address;
+  const uint8_t *data;
+  uint32_t todo;
+  rtems_binary_semaphore done;
+} flash_ftfe_context;
+
+static flash_ftfe_context flash_ftfe = {
+  .done = RTEMS_BINARY_SEMAPHORE_INITIALIZER("FTFE")
+};
+
+static void flash_ftfe_load(const flash_ftfe_context *ctx)
+{
+  uint32_t address;
+
+  address = ctx->address;
+
+  /* Errors of the previous command prevent the launch */
+  FTFE->FSTAT = FTFE_FSTAT_RDCOLERR_MASK | FTFE_FSTAT_ACCERR_MASK
+    | FTFE_FSTAT_FPVIOL_MASK;
+
+  FTFE->FCCOB0 = ctx->command;
+  FTFE->FCCOB1 = (uint8_t) (address >> 16);
+  FTFE->FCCOB2 = (uint8_t) (address >> 8);
+  FTFE->FCCOB3 = (uint8_t) address;
+
+  if (ctx->command == FLASH_COMMAND_PROGRAM_PHRASE) {
+    const uint8_t *data;
+
+    data = ctx->data;
+    FTFE->FCCOB4 = data[0];
+    FTFE->FCCOB5 = data[1];
+    FTFE->FCCOB6 = data[2];
+    FTFE->FCCOB7 = data[3];
+    FTFE->FCCOB8 = data[4];
+    FTFE->FCCOB9 = data[5];
+    FTFE->FCCOBA = data[6];
+    FTFE->FCCOBB = data[7];
+  }
+}
+
+static void flash_ftfe_advance(flash_ftfe_context *ctx)
+{
+  if (ctx->command == FLASH_COMMAND_PROGRAM_PHRASE) {
+    ctx->address += MK64F12_FLASH_PHRASE_SIZE;
+    ctx->data += MK64F12_FLASH_PHRASE_SIZE;
+  } else {
+    ctx->address += MK64F12_FLASH_SECTOR_SIZE;
+  }
+
+  --ctx->todo;
+}
+
+/*
+ * The flash is not readable while a command runs on its block, so this
+ * routine runs from RAM with interrupts disabled.
+ */
+BSP_FAST_TEXT_SECTION RTEMS_NO_INLINE static uint8_t flash_ftfe_execute(
+  void
+)
+{
+  FTFE->FSTAT = FTFE_FSTAT_CCIF_MASK;
+
+  while ((FTFE->FSTAT & FTFE_FSTAT_CCIF_MASK) == 0) {
+    /* Wait */
+  }
+
+  return FTFE->FSTAT;
+}
+
+/*
+ * In read while write mode, the interrupt launches the next command right
+ * after the previous one completed.
+ */
+static void flash_ftfe_interrupt(void *arg)
+{
+  flash_ftfe_context *ctx;
+  uint8_t fstat;
+
+  ctx = arg;
+  fstat = FTFE->FSTAT;
+
+  if ((fstat & FTFE_FSTAT_CCIF_MASK) == 0) {
+    return;
+  }
+
+  fstat &= FLASH_FSTAT_ERRORS;
+  flash_ftfe_advance(ctx);
+
+  if (fstat == 0 && ctx->todo > 0) {
+    flash_ftfe_load(ctx);
+    FTFE->FSTAT = FTFE_FSTAT_CCIF_MASK;
+  } else {
+    ctx->fstat = fstat;
+    FTFE->FCNFG &= ~FTFE_FCNFG_CCIE_MASK;
+    rtems_binary_semaphore_post(&ctx->done);
+  }
+}
+
+uint32_t mk64f12_flash_image_end(void)
+{
+  uintptr_t end;
+
+  end = (uintptr_t) bsp_section_text_load_end;
+  end = MAX(end, (uintptr_t) bsp_section_rodata_load_end);
+  end = MAX(end, (uintptr_t) bsp_section_fast_text_load_end);
+  end = MAX(end, (uintptr_t) bsp_section_fast_data_load_end);
+  end = MAX(end, (uintptr_t) bsp_section_data_load_end);
+
+  return RTEMS_ALIGN_UP(end, MK64F12_FLASH_SECTOR_SIZE);
+}
+
+/*
+ * The CPU may read from one program flash block while a command runs on the
+ * other block.  Use this only if the application image is in the first block,
+ * so that the code executed during the command cannot touch the second block.
+ */
+static bool flash_ftfe_can_read_while_write(
+  const flash_ftfe_context *ctx,
+  uint32_t address
+)
+{
+  return ctx->initialized
+    && address >= MK64F12_FLASH_BLOCK_SIZE
+    && mk64f12_flash_image_end() <= MK64F12_FLASH_BLOCK_SIZE
+    && !rtems_interrupt_is_in_progress();
+}
+
+static rtems_status_code flash_ftfe_run(
+  uint8_t command,
+  uint32_t address,
+  const uint8_t *data,
+  uint32_t count
+)
+{
+  flash_ftfe_context *ctx;
+  uint8_t fstat;
+
+  ctx = &flash_ftfe;
+  ctx->command = command;
+  ctx->address = address;
+  ctx->data = data;
+  ctx->todo = count;
+
+  if (flash_ftfe_can_read_while_write(ctx, address)) {
+    flash_ftfe_load(ctx);
+    FTFE->FSTAT = FTFE_FSTAT_CCIF_MASK;
+    FTFE->FCNFG |= FTFE_FCNFG_CCIE_MASK;
+    rtems_binary_semaphore_wait(&ctx->done);
+    fstat = ctx->fstat;
+  } else {
+    fstat = 0;
+
+    while (fstat == 0 && ctx->todo > 0) {
+      rtems_interrupt_level level;
+
+      flash_ftfe_load(ctx);
+      rtems_interrupt_local_disable(level);
+      fstat = flash_ftfe_execute();
+      rtems_interrupt_local_enable(level);
+      fstat &= FLASH_FSTAT_ERRORS;
+      flash_ftfe_advance(ctx);
+    }
+  }
+
+  /* Drop stale contents of the flash cache and the speculation buffers */
+  mk64f12_fmc_invalidate();
+
+  return fstat == 0 ? RTEMS_SUCCESSFUL : RTEMS_IO_ERROR;
+}
+
+static rtems_status_code flash_ftfe_erase(
+  mk64f12_flash_device *self,
+  uint32_t offset,
+  uint32_t count
+)
+{
+  (void) self;
+
+  if (offset < mk64f12_flash_image_end()) {
+    return RTEMS_INVALID_ADDRESS;
+  }
+
+  return flash_ftfe_run(FLASH_COMMAND_ERASE_SECTOR, offset, NULL, count);
+}
+
+static rtems_status_code flash_ftfe_program(
+  mk64f12_flash_device *self,
+  uint32_t offset,
+  const uint8_t *data,
+  uint32_t count
+)
+{
+  (void) self;
+
+  if (offset < mk64f12_flash_image_end()) {
+    return RTEMS_INVALID_ADDRESS;
+  }
+
+  return flash_ftfe_run(FLASH_COMMAND_PROGRAM_PHRASE, offset, data, count);
+}
+
+mk64f12_flash_device mk64f12_flash_internal = {
+  .erase = flash_ftfe_erase,
+  .program = flash_ftfe_program,
+  /* The program flash starts at address zero like the start section */
+  .memory = (const uint8_t *) bsp_section_start_begin,
+  .size = MK64F12_FLASH_SIZE,
+  .mutex = RTEMS_MUTEX_INITIALIZER("Flash")
+};
+
+rtems_status_code mk64f12_flash_initialize(void)
+{
+  flash_ftfe_context *ctx;
+  rtems_status_code sc;
+
+  ctx = &flash_ftfe;
+  sc = RTEMS_SUCCESSFUL;
+  rtems_mutex_lock(&mk64f12_flash_internal.mutex);
+
+  if (!ctx->initialized) {
+    sc = rtems_interrupt_handler_install(
+      FTFE_IRQn,
+      "FTFE",
+      RTEMS_INTERRUPT_UNIQUE,
+      flash_ftfe_interrupt,
+      ctx
+    );
+
+    if (sc == RTEMS_SUCCESSFUL) {
+      ctx->initialized = true;
+    }
+  }
+
+  rtems_mutex_unlock(&mk64f12_flash_internal.mutex);
+  return sc;
+}
+
+static bool flash_is_inside(
+  const mk64f12_flash_device *device,
+  uint32_t offset,
+  size_t size
+)
+{
+  return offset <= device->size && size <= device->size - offset;
+}
+
+rtems_status_code mk64f12_flash_read(
+  mk64f12_flash_device *device,
+  uint32_t offset,
+  void *buffer,
+  size_t size
+)
+{
+  if (!flash_is_inside(device, offset, size)) {
+    return RTEMS_INVALID_ADDRESS;
+  }
+
+  rtems_mutex_lock(&device->mutex);
+  memcpy(buffer, &device->memory[offset], size);
+  rtems_mutex_unlock(&device->mutex);
+  return RTEMS_SUCCESSFUL;
+}
+
+static bool flash_is_erased(const uint8_t *phrase)
+{
+  size_t i;
+
+  for (i = 0; i < MK64F12_FLASH_PHRASE_SIZE; ++i) {
+    if (phrase[i] != 0xff) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+/*
+ * A phrase must not be programmed a second time without an erase of its
+ * sector.  Check this for the whole area before the first program operation,
+ * so that a refused write leaves the flash unchanged.
+ */
+static bool flash_needs_erase(
+  const mk64f12_flash_device *device,
+  uint32_t offset,
+  const uint8_t *in,
+  size_t size
+)
+{
+  size_t i;
+
+  for (i = 0; i < size; ++i) {
+    uint8_t current;
+
+    current = device->memory[offset + i];
+
+    if (
+      (current & in[i]) != current
+        && !flash_is_erased(
+          &device->memory[
+            RTEMS_ALIGN_DOWN(offset + i, MK64F12_FLASH_PHRASE_SIZE)
+          ]
+        )
+    ) {
+      return true;
+    }
+  }
+
+  return false;
+}
+
+/*
+ * Programs the phrases of the chunk which differ from the flash contents.
+ * Each run of changed phrases is one program operation.
+ */
+static rtems_status_code flash_program_changes(
+  mk64f12_flash_device *device,
+  uint32_t offset,
+  const uint8_t *chunk,
+  uint32_t count
+)
+{
+  uint32_t i;
+
+  i = 0;
+
+  while (i < count) {
+    uint32_t begin;
+    rtems_status_code sc;
+
+    while (
+      i < count
+        && memcmp(
+          &chunk[i * MK64F12_FLASH_PHRASE_SIZE],
+          &device->memory[offset + i * MK64F12_FLASH_PHRASE_SIZE],
+          MK64F12_FLASH_PHRASE_SIZE
+        ) == 0
+    ) {
+      ++i;
+    }
+
+    begin = i;
+
+    while (
+      i < count
+        && memcmp(
+          &chunk[i * MK64F12_FLASH_PHRASE_SIZE],
+          &device->memory[offset + i * MK64F12_FLASH_PHRASE_SIZE],
+          MK64F12_FLASH_PHRASE_SIZE
+        ) != 0
+    ) {
+      ++i;
+    }
+
+    if (begin == i) {
+      break;
+    }
+
+    sc = (*device->program)(
+      device,
+      offset + begin * MK64F12_FLASH_PHRASE_SIZE,
+      &chunk[begin * MK64F12_FLASH_PHRASE_SIZE],
+      i - begin
+    );
+
+    if (sc != RTEMS_SUCCESSFUL) {
+      ++device->stats.errors;
+      return sc;
+    }
+
+    device->stats.programmed_phrases += i - begin;
+  }
+
+  return RTEMS_SUCCESSFUL;
+}
+
+rtems_status_code mk64f12_flash_write(
+  mk64f12_flash_device *device,
+  uint32_t offset,
+  const void *buffer,
+  size_t size
+)
+{
+  const uint8_t *in;
+  rtems_status_code sc;
+
+  if (!flash_is_inside(device, offset, size)) {
+    return RTEMS_INVALID_ADDRESS;
+  }
+
+  in = buffer;
+  sc = RTEMS_SUCCESSFUL;
+  rtems_mutex_lock(&device->mutex);
+
+  if (flash_needs_erase(device, offset, in, size)) {
+    ++device->stats.refused_writes;
+    size = 0;
+    sc = RTEMS_IO_ERROR;
+  }
+
+  while (size > 0 && sc == RTEMS_SUCCESSFUL) {
+    uint8_t chunk[FLASH_CHUNK_PHRASES * MK64F12_FLASH_PHRASE_SIZE];
+    uint32_t begin;
+    uint32_t head;
+    uint32_t count;
+    size_t n;
+    size_t i;
+
+    begin = RTEMS_ALIGN_DOWN(offset, MK64F12_FLASH_PHRASE_SIZE);
+    head = offset - begin;
+    n = MIN(size, sizeof(chunk) - head);
+    count = RTEMS_ALIGN_UP(head + n, MK64F12_FLASH_PHRASE_SIZE)
+      / MK64F12_FLASH_PHRASE_SIZE;
+    memcpy(chunk, &device->memory[begin], count * MK64F12_FLASH_PHRASE_SIZE);
+
+    for (i = 0; i < n; ++i) {
+      chunk[head + i] &= in[i];
+    }
+
+    sc = flash_program_changes(device, begin, chunk, count);
+    offset += n;
+    in += n;
+    size -= n;
+  }
+
+  rtems_mutex_unlock(&device->mutex);
+  return sc;
+}
+
+rtems_status_code mk64f12_flash_erase(
+  mk64f12_flash_device *device,
+  uint32_t offset,
+  size_t size
+)
+{
+  rtems_status_code sc;
+
+  if (
+    !flash_is_inside(device, offset, size)
+      || (offset % MK64F12_FLASH_SECTOR_SIZE) != 0
+      || (size % MK64F12_FLASH_SECTOR_SIZE) != 0
+  ) {
+    return RTEMS_INVALID_ADDRESS;
+  }
+
+  if (size == 0) {
+    return RTEMS_SUCCESSFUL;
+  }
+
+  rtems_mutex_lock(&device->mutex);
+  sc = (*device->erase)(device, offset, size / MK64F12_FLASH_SECTOR_SIZE);
+
+  if (sc == RTEMS_SUCCESSFUL) {
+    device->stats.erased_sectors += size / MK64F12_FLASH_SECTOR_SIZE;
+  } else {
+    ++device->stats.errors;
+  }
+
+  rtems_mutex_unlock(&device->mutex);
+  return sc;
+}
+
+void mk64f12_flash_get_statistics(
+  mk64f12_flash_device *device,
+  mk64f12_flash_statistics *stats
+)
+{
+  rtems_mutex_lock(&device->mutex);
+  *stats = device->stats;
+  rtems_mutex_unlock(&device->mutex);
+}
@@ -37,7 +37,63 @@ extern "C" {
 #define BSP_FEATURE_IRQ_EXTENSION
 #define BSP_ARMV7M_IRQ_PRIORITY_DEFAULT (13 << 4)
 #define BSP_ARMV7M_SYSTICK_PRIORITY (14 << 4)
-#define BSP_ARMV7M_SYSTICK_FREQUENCY 120000000
+#define BSP_ARMV7M_SYSTICK_FREQUENCY SystemCoreClock
+
+/*
+ * The processor clock frequency in Hz, see also
+ * mk64f12_clock_set_mode().
+ */
+extern uint32_t SystemCoreClock;
+
+/*
+ * Waits for an interrupt and afterwards adds the time the processor clock was
+ * gated off to the CPU counter.  Call it with interrupts masked by the
+ * PRIMASK, since the BASEPRI prevents the wake up.
+ */
+void mk64f12_wait_for_interrupt(void);
+
+#define BSP_ARMV7M_WAIT_FOR_INTERRUPT() mk64f12_wait_for_interrupt()
+
+#if MK64F12_PRINTK_BUFFER_SIZE > 0 || defined(MK64F12_DEFERRED_INIT)
+/*
+ * The idle thread drains the printk() buffer, see <bsp/printk-buffer.h>, and
+ * calls the deferred initialization handlers, see <bsp/deferred-init.h>.
+ */
+void mk64f12_idle_work(void);
+
+#define BSP_ARMV7M_IDLE_WORK() mk64f12_idle_work()
+#endif
+
+#if MK64F12_PRINTK_BUFFER_SIZE > 0
+void mk64f12_printk_flush(void);
+
+/*
+ * The fatal error extension drains the printk() buffer and makes the following
+ * output synchronous, then calls bsp_fatal_extension().
+ */
+void mk64f12_printk_fatal_extension(
+  rtems_fatal_source source,
+  bool always_set_to_false,
+  rtems_fatal_code code
+);
+
+#undef BSP_INITIAL_EXTENSION
+#define BSP_INITIAL_EXTENSION \
+  { NULL, NULL, NULL, NULL, NULL, NULL, NULL, \
+    mk64f12_printk_fatal_extension, NULL }
+#endif
+
+#ifdef MK64F12_TICKLESS_IDLE
+#define BSP_ARMV7M_SYSTICK_TICKLESS_IDLE
+
+#define BSP_IDLE_TASK_BODY _ARMV7M_Clock_tickless_idle_body
+
+void *_ARMV7M_Clock_tickless_idle_body(uintptr_t ignored);
+#else
+#define BSP_IDLE_TASK_BODY mk64f12_idle_thread_body
+
+void *mk64f12_idle_thread_body(uintptr_t ignored);
+#endif
 
 #ifdef __cplusplus
 }
@@ -0,0 +1,127 @@
+/**
+ * @file
+ * @ingroup mk64f12_boot_profile
+ * @brief Boot profile support.
+ */
+
+/*
+ * Copyright (c) 2026 Dave Rush.  All rights reserved.
+ *
+ * The license and distribution terms for this file may be
+ * found in the file LICENSE in this distribution or at
+ * http://www.rtems.org/license/LICENSE.
+ */
+
+#ifndef LIBBSP_ARM_MK64F12_BOOT_PROFILE_H
+#define LIBBSP_ARM_MK64F12_BOOT_PROFILE_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <rtems/printer.h>
+#include <rtems/sysinit.h>
+
+/**
+ * @defgroup mk64f12_boot_profile Boot Profile Support
+ * @ingroup RTEMSBSPsARMMK64F12
+ * @brief Boot Profile Support
+ *
+ * If the BSP option MK64F12_BOOT_PROFILE is enabled, then the DWT cycle
+ * counter is started in bsp_start_hook_0() and the duration of each step of
+ * the system start is recorded.  The first steps are the section copy and the
+ * BSS clearing in bsp_start_hook_1(), followed by one step for each system
+ * initialization handler and for each deferred initialization handler, see
+ * <bsp/deferred-init.h>.
+ *
+ * The cycles of a step are converted to nanoseconds with the core clock
+ * frequency at the end of the step, so the step which changes the clock
+ * configuration in bsp_start() is not exact.
+ *
+ * @{
+ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/**
+ * @brief Maximum count of recorded steps.
+ */
+#define MK64F12_BOOT_PROFILE_STEP_COUNT 96
+
+/**
+ * @brief Boot profile step.
+ */
+typedef struct {
+  /**
+   * @brief The name of a BSP start step, otherwise NULL.
+   */
+  const char *name;
+
+  /**
+   * @brief The handler of a system initialization step, otherwise NULL.
+   */
+  rtems_sysinit_handler handler;
+
+  /**
+   * @brief Duration of the step in nanoseconds.
+   */
+  uint32_t duration_ns;
+
+  /**
+   * @brief Time since the start of the cycle counter at the end of the step
+   * in nanoseconds.
+   */
+  uint32_t end_ns;
+
+  /**
+   * @brief True, if this is a deferred initialization step.
+   */
+  bool deferred;
+} mk64f12_boot_profile_step;
+
+/**
+ * @brief Starts the boot profile in bsp_start_hook_1().
+ *
+ * @param copy_begin The cycle counter value before the section copy.
+ * @param copy_end The cycle counter value after the section copy.
+ */
+void mk64f12_boot_profile_start(uint32_t copy_begin, uint32_t copy_end);
+
+/**
+ * @brief Records a deferred initialization step.
+ *
+ * @param item The deferred initialization item.
+ * @param cycles The duration of the step in cycles.
+ */
+void mk64f12_boot_profile_record_deferred(
+  const rtems_sysinit_item *item,
+  uint32_t cycles
+);
+
+/**
+ * @brief Gets the recorded steps.
+ *
+ * @param[out] steps The recorded steps.
+ *
+ * @return The count of recorded steps.
+ */
+size_t mk64f12_boot_profile_get_steps(
+  const mk64f12_boot_profile_step **steps
+);
+
+/**
+ * @brief Prints the boot profile.
+ *
+ * A system initialization step is printed with the address of its handler.
+ */
+void mk64f12_boot_profile_print(const rtems_printer *printer);
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* LIBBSP_ARM_MK64F12_BOOT_PROFILE_H */
@@ -0,0 +1,192 @@
+/**
+ * @file
+ * @ingroup mk64f12_clock_scaling
+ * @brief Run-time processor clock scaling support.
+ */
+
+/*
+ * Copyright (c) 2026 Dave Rush.  All rights reserved.
+ *
+ * The license and distribution terms for this file may be
+ * found in the file LICENSE in this distribution or at
+ * http://www.rtems.org/license/LICENSE.
+ */
+
+#ifndef LIBBSP_ARM_MK64F12_CLOCK_SCALING_H
+#define LIBBSP_ARM_MK64F12_CLOCK_SCALING_H
+
+#include <stdint.h>
+
+#include <rtems.h>
+#include <rtems/chain.h>
+#include <rtems/shell.h>
+
+/**
+ * @defgroup mk64f12_clock_scaling Clock Scaling Support
+ * @ingroup RTEMSBSPsARMMK64F12
+ * @brief Clock Scaling Support
+ *
+ * The system starts in the MK64F12_CLOCK_MODE_RUN_120MHZ mode.  A mode
+ * change reprograms the MCG, the SIM clock dividers and the SMC run mode.
+ * The SysTick, the PIT timecounter, the CPU counter, the UARTs and the DSPI
+ * buses follow the change.
+ *
+ * Drivers which depend on a clock register a listener.  For a mode change,
+ * the prepare handlers of all listeners are called in task context, then
+ * interrupts are disabled, the clocks change and the update handlers are
+ * called.  Finally, interrupts are enabled and the complete handlers are
+ * called in task context.  So, a prepare handler may wait for the end of a
+ * transfer and block new ones until the complete handler runs.
+ *
+ * The time spent with the clock change in the interrupt disabled section is
+ * accounted by the timecounter with the previous frequency.
+ *
+ * In the VLPR mode, the flash memory cannot be programmed or erased, the
+ * Ethernet MDC divider is out of range, and the DSPI bit rate is limited to
+ * 2 MHz.
+ *
+ * @{
+ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/**
+ * @brief Clock modes.
+ */
+typedef enum {
+  /**
+   * @brief PEE mode with a core clock of 120 MHz and a bus clock of 60 MHz.
+   */
+  MK64F12_CLOCK_MODE_RUN_120MHZ,
+
+  /**
+   * @brief PEE mode with a core clock of 60 MHz and a bus clock of 60 MHz.
+   *
+   * Only the core clock divider changes, so this is the fastest mode change.
+   */
+  MK64F12_CLOCK_MODE_RUN_60MHZ,
+
+  /**
+   * @brief BLPI mode with a core clock of 4 MHz and a bus clock of 4 MHz in
+   * the VLPR power mode.
+   */
+  MK64F12_CLOCK_MODE_VLPR_4MHZ,
+
+  MK64F12_CLOCK_MODE_COUNT
+} mk64f12_clock_mode;
+
+typedef struct mk64f12_clock_listener mk64f12_clock_listener;
+
+/**
+ * @brief Clock change listener.
+ *
+ * Each handler is optional and may be NULL.
+ */
+struct mk64f12_clock_listener {
+  /**
+   * @brief This member is used by the clock scaling support.
+   */
+  rtems_chain_node node;
+
+  /**
+   * @brief Called in task context before the clock change.
+   */
+  void (*prepare)(mk64f12_clock_listener *listener);
+
+  /**
+   * @brief Called with interrupts disabled after the clock change.
+   */
+  void (*update)(mk64f12_clock_listener *listener);
+
+  /**
+   * @brief Called in task context after the clock change.
+   */
+  void (*complete)(mk64f12_clock_listener *listener);
+};
+
+/**
+ * @brief Clock scaling statistics.
+ */
+typedef struct {
+  /**
+   * @brief Count of successful mode changes.
+   */
+  uint32_t switches;
+
+  /**
+   * @brief Count of mode changes which failed and fell back to the previous
+   * mode.
+   */
+  uint32_t failures;
+
+  /**
+   * @brief Duration of the last mode change in nanoseconds.
+   */
+  uint32_t last_switch_ns;
+
+  /**
+   * @brief Maximum duration of a mode change in nanoseconds.
+   */
+  uint32_t max_switch_ns;
+
+  /**
+   * @brief Duration of the interrupt disabled section of the last mode change
+   * in nanoseconds.
+   */
+  uint32_t last_disabled_ns;
+
+  /**
+   * @brief Maximum duration of the interrupt disabled section of a mode
+   * change in nanoseconds.
+   */
+  uint32_t max_disabled_ns;
+} mk64f12_clock_statistics;
+
+/**
+ * @brief Adds the clock change listener.
+ *
+ * The listener is called for each following mode change until it is removed.
+ */
+void mk64f12_clock_add_listener(mk64f12_clock_listener *listener);
+
+/**
+ * @brief Removes the clock change listener.
+ */
+void mk64f12_clock_remove_listener(mk64f12_clock_listener *listener);
+
+/**
+ * @brief Changes the clock mode.
+ *
+ * @retval RTEMS_SUCCESSFUL Successful operation.
+ * @retval RTEMS_INVALID_NUMBER Invalid mode.
+ * @retval RTEMS_CALLED_FROM_ISR Called from interrupt context.
+ * @retval RTEMS_INCORRECT_STATE The multitasking did not start yet.
+ * @retval RTEMS_IO_ERROR The MCG or SMC did not reach the mode, the previous
+ *   mode was restored.
+ */
+rtems_status_code mk64f12_clock_set_mode(mk64f12_clock_mode mode);
+
+/**
+ * @brief Returns the current clock mode.
+ */
+mk64f12_clock_mode mk64f12_clock_get_mode(void);
+
+/**
+ * @brief Gets the clock scaling statistics.
+ */
+void mk64f12_clock_get_statistics(mk64f12_clock_statistics *stats);
+
+/**
+ * @brief Shell command to show and change the clock mode.
+ */
+extern struct rtems_shell_cmd_tt mk64f12_clock_shell_command;
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* LIBBSP_ARM_MK64F12_CLOCK_SCALING_H */
@@ -0,0 +1,66 @@
+/**
+ * @file
+ * @ingroup mk64f12_crc
+ * @brief CRC module support.
+ */
+
+/*
+ * Copyright (c) 2026 Dave Rush.  All rights reserved.
+ *
+ * The license and distribution terms for this file may be
+ * found in the file LICENSE in this distribution or at
+ * http://www.rtems.org/license/LICENSE.
+ */
+
+#ifndef LIBBSP_ARM_MK64F12_CRC_H
+#define LIBBSP_ARM_MK64F12_CRC_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * @defgroup mk64f12_crc CRC Support
+ * @ingroup RTEMSBSPsARMMK64F12
+ * @brief CRC Support
+ *
+ * The CRC module computes the CRC-32 of <rtems/crc32.h> for the JFFS2 file
+ * system, zlib and the XZ decompressor.  During the device driver
+ * initialization, the module is installed as the CRC-32 backend if it passes
+ * a known answer test.  Buffers of at least MK64F12_CRC_DMA_THRESHOLD bytes
+ * are fed to the module by the eDMA, smaller ones by the processor.
+ *
+ * The module has a single CRC engine, so the users are serialized by a
+ * mutex.  Requests in interrupt context, before the multitasking start and
+ * of less than 64 bytes are declined, so that the portable implementation
+ * is used for them.
+ *
+ * @{
+ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/**
+ * @brief CRC-32 backend using the CRC module.
+ *
+ * It has the signature of a rtems_crc32_backend.
+ */
+bool mk64f12_crc32_backend(uint32_t *crc, const void *buf, size_t len);
+
+/**
+ * @brief Installs the CRC module as the CRC-32 backend.
+ *
+ * This is done by a system initialization step after the eDMA
+ * initialization.
+ */
+void mk64f12_crc_initialize(void);
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* LIBBSP_ARM_MK64F12_CRC_H */
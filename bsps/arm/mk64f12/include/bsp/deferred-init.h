@@ -0,0 +1,95 @@
+/**
+ * @file
+ * @ingroup mk64f12_deferred_init
+ * @brief Deferred initialization support.
+ */
+
+/*
+ * Copyright (c) 2026 Dave Rush.  All rights reserved.
+ *
+ * The license and distribution terms for this file may be
+ * found in the file LICENSE in this distribution or at
+ * http://www.rtems.org/license/LICENSE.
+ */
+
+#ifndef LIBBSP_ARM_MK64F12_DEFERRED_INIT_H
+#define LIBBSP_ARM_MK64F12_DEFERRED_INIT_H
+
+#include <stdbool.h>
+
+#include <bspopts.h>
+
+#include <rtems/linkersets.h>
+#include <rtems/sysinit.h>
+
+/**
+ * @defgroup mk64f12_deferred_init Deferred Initialization Support
+ * @ingroup RTEMSBSPsARMMK64F12
+ * @brief Deferred Initialization Support
+ *
+ * A system initialization handler which is not needed to start the Init task
+ * may be registered with MK64F12_DEFERRED_INIT_ITEM() instead of
+ * RTEMS_SYSINIT_ITEM().  If the BSP option MK64F12_DEFERRED_INIT is enabled,
+ * then these handlers are called in the module and order sequence by the idle
+ * thread when it runs for the first time, so no task object of the
+ * application is used.  The handler must not block, must tolerate concurrent
+ * use of its module and must not depend on other deferred handlers of a
+ * different module.  The handlers do not run while the processor is fully
+ * loaded.
+ *
+ * If the BSP option is disabled, then MK64F12_DEFERRED_INIT_ITEM() is
+ * RTEMS_SYSINIT_ITEM().
+ *
+ * @{
+ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+#ifdef MK64F12_DEFERRED_INIT
+
+/**
+ * @brief Calls the deferred handlers, if this was not done before.
+ *
+ * This function is called by the idle thread, see BSP_ARMV7M_IDLE_WORK().
+ */
+void mk64f12_deferred_init_run(void);
+
+#define _MK64F12_DEFERRED_INIT_INDEX_ITEM(handler, index) \
+  enum { _Mk64f12_Deferred_init_##handler = index }; \
+  RTEMS_LINKER_ROSET_ITEM_ORDERED( \
+    _Mk64f12_Deferred_init, \
+    rtems_sysinit_item, \
+    handler, \
+    index \
+  ) = { handler }
+
+#define _MK64F12_DEFERRED_INIT_ITEM(handler, module, order) \
+  _MK64F12_DEFERRED_INIT_INDEX_ITEM(handler, 0x##module##order)
+
+/**
+ * @brief Registers a deferred system initialization handler.
+ */
+#define MK64F12_DEFERRED_INIT_ITEM(handler, module, order) \
+  _MK64F12_DEFERRED_INIT_ITEM(handler, module, order)
+
+/**
+ * @brief Returns true, if all deferred handlers returned, otherwise false.
+ */
+bool mk64f12_deferred_init_is_done(void);
+
+#else /* MK64F12_DEFERRED_INIT */
+
+#define MK64F12_DEFERRED_INIT_ITEM(handler, module, order) \
+  RTEMS_SYSINIT_ITEM(handler, module, order)
+
+#endif /* MK64F12_DEFERRED_INIT */
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* LIBBSP_ARM_MK64F12_DEFERRED_INIT_H */
@@ -0,0 +1,100 @@
+/**
+ * @file
+ * @ingroup mk64f12_dspi
+ * @brief DSPI (deserial serial peripheral interface) bus driver.
+ */
+
+/*
+ * Copyright (c) 2026 Dave Rush.  All rights reserved.
+ *
+ * The license and distribution terms for this file may be
+ * found in the file LICENSE in this distribution or at
+ * http://www.rtems.org/license/LICENSE.
+ */
+
+#ifndef LIBBSP_ARM_MK64F12_DSPI_H
+#define LIBBSP_ARM_MK64F12_DSPI_H
+
+#include <stdint.h>
+
+#include <sys/ioccom.h>
+
+/**
+ * @defgroup mk64f12_dspi DSPI Support
+ * @ingroup RTEMSBSPsARMMK64F12
+ * @brief DSPI Support
+ *
+ * The DSPI modules are driven as SPI bus masters through the generic SPI bus
+ * framework.  Each frame is pushed to the TX FIFO together with its command
+ * word, which selects the chip select and keeps it asserted within a message.
+ * Messages with at least MK64F12_DSPI_DMA_THRESHOLD bytes use the eDMA on
+ * SPI0, the other modules have a one entry FIFO and a shared DMA request and
+ * always use the FIFO interrupts.
+ *
+ * Only 8 bits per word are supported.  The chip selects PCS0 to PCS5 are the
+ * cs values 0 to 5.
+ *
+ * @{
+ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/**
+ * @brief DSPI bus statistics.
+ */
+typedef struct {
+  /**
+   * @brief Count of DSPI interrupts.
+   */
+  uint32_t interrupts;
+
+  /**
+   * @brief Count of eDMA channel interrupts.
+   */
+  uint32_t dma_interrupts;
+
+  /**
+   * @brief Count of messages transferred through the FIFO.
+   */
+  uint32_t fifo_messages;
+
+  /**
+   * @brief Count of messages transferred by the eDMA.
+   */
+  uint32_t dma_messages;
+
+  /**
+   * @brief Count of transferred bytes.
+   */
+  uint32_t bytes;
+} mk64f12_dspi_statistics;
+
+#define MK64F12_DSPI_IOC_MAGIC 's'
+
+/**
+ * @brief Gets the bus statistics, the argument is a pointer to a
+ * mk64f12_dspi_statistics object.
+ */
+#define MK64F12_DSPI_GET_STATISTICS \
+  _IOR(MK64F12_DSPI_IOC_MAGIC, 0, mk64f12_dspi_statistics)
+
+/**
+ * @brief Registers the DSPI module @a instance (0, 1 or 2) as SPI bus at
+ * @a bus_path, e.g. "/dev/spi-0".
+ *
+ * The pins must be routed to the module by the board setup.
+ *
+ * @retval 0 Successful operation.
+ * @retval -1 An error occurred.  The errno is set to indicate the error.
+ */
+int mk64f12_dspi_register(unsigned int instance, const char *bus_path);
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* LIBBSP_ARM_MK64F12_DSPI_H */
@@ -0,0 +1,327 @@
+/**
+ * @file
+ * @ingroup mk64f12_enet
+ * @brief ENET (Ethernet MAC) raw frame driver.
+ */
+
+/*
+ * Copyright (c) 2026 Dave Rush.  All rights reserved.
+ *
+ * The license and distribution terms for this file may be
+ * found in the file LICENSE in this distribution or at
+ * http://www.rtems.org/license/LICENSE.
+ */
+
+#ifndef LIBBSP_ARM_MK64F12_ENET_H
+#define LIBBSP_ARM_MK64F12_ENET_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <rtems.h>
+
+/**
+ * @defgroup mk64f12_enet ENET Support
+ * @ingroup RTEMSBSPsARMMK64F12
+ * @brief ENET Support
+ *
+ * The driver works on rings of enhanced buffer descriptors and does not copy
+ * frame data.  Received frames are loaned to the user in the buffer the MAC
+ * wrote them to, the receive ring is refilled from a pool of spare buffers.
+ * Frames to transmit are sent directly from the buffer of the user.  The
+ * driver is not bound to a network stack, a stack binds to it through the
+ * functions below.
+ *
+ * @{
+ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/**
+ * @brief Size of a receive buffer in bytes.
+ *
+ * This is enough for a maximum length frame with a VLAN tag and the CRC.
+ */
+#define MK64F12_ENET_BUFFER_SIZE 1536
+
+/**
+ * @brief Count of receive buffer descriptors.
+ */
+#define MK64F12_ENET_RX_RING_SIZE 8
+
+/**
+ * @brief Count of spare receive buffers available for loans.
+ */
+#define MK64F12_ENET_RX_SPARE_COUNT 8
+
+/**
+ * @brief Count of transmit buffer descriptors.
+ */
+#define MK64F12_ENET_TX_RING_SIZE 8
+
+/**
+ * @brief Transmit flag to insert the IPv4 header checksum.
+ */
+#define MK64F12_ENET_TX_INSERT_IP_CHECKSUM 0x1U
+
+/**
+ * @brief Transmit flag to insert the TCP, UDP or ICMP checksum.
+ *
+ * The checksum field of the frame must be zero.
+ */
+#define MK64F12_ENET_TX_INSERT_PROTOCOL_CHECKSUM 0x2U
+
+/**
+ * @brief Receive flag indicating an IPv4 frame.
+ */
+#define MK64F12_ENET_RX_IPV4 0x1U
+
+/**
+ * @brief Receive flag indicating an IPv6 frame.
+ */
+#define MK64F12_ENET_RX_IPV6 0x2U
+
+/**
+ * @brief Receive flag indicating that the IP header checksum was checked by
+ * the MAC and is valid.
+ */
+#define MK64F12_ENET_RX_IP_CHECKSUM_OK 0x4U
+
+/**
+ * @brief Receive flag indicating that the protocol checksum was checked by
+ * the MAC and is valid.
+ */
+#define MK64F12_ENET_RX_PROTOCOL_CHECKSUM_OK 0x8U
+
+/**
+ * @brief Receive flag indicating a broadcast frame.
+ */
+#define MK64F12_ENET_RX_BROADCAST 0x10U
+
+/**
+ * @brief Receive flag indicating a multicast frame.
+ */
+#define MK64F12_ENET_RX_MULTICAST 0x20U
+
+/**
+ * @brief Handler called in interrupt context if frames are available to
+ * receive.
+ */
+typedef void (*mk64f12_enet_rx_notify)(void *arg);
+
+/**
+ * @brief Handler called once the MAC is done with a frame to transmit.
+ *
+ * It may be called in interrupt context.  The @a error parameter is true, if
+ * the frame was not transmitted successfully.
+ */
+typedef void (*mk64f12_enet_tx_done)(void *arg, const void *frame, bool error);
+
+/**
+ * @brief ENET configuration.
+ */
+typedef struct {
+  /**
+   * @brief The MAC address.
+   */
+  uint8_t mac_address[6];
+
+  /**
+   * @brief If true, then all frames are received.
+   */
+  bool promiscuous;
+
+  /**
+   * @brief If true, then the transmit and receive checksum accelerators are
+   * enabled.
+   */
+  bool checksum_offload;
+
+  /**
+   * @brief If true, then the MAC transmit path is internally connected to the
+   * receive path and the PHY is not used.
+   *
+   * This is intended for self tests.
+   */
+  bool loopback;
+
+  /**
+   * @brief If true, then the RMII runs at 10Mbps, otherwise at 100Mbps.
+   */
+  bool speed_10m;
+
+  /**
+   * @brief If true, then the MAC operates in half-duplex mode.
+   */
+  bool half_duplex;
+
+  /**
+   * @brief Handler for the receive notification, may be NULL.
+   */
+  mk64f12_enet_rx_notify rx_notify;
+
+  /**
+   * @brief Argument for the receive notification handler.
+   */
+  void *rx_notify_arg;
+} mk64f12_enet_config;
+
+/**
+ * @brief ENET driver statistics.
+ */
+typedef struct {
+  /**
+   * @brief Count of receive, transmit and error interrupts.
+   */
+  uint32_t interrupts;
+
+  /**
+   * @brief Count of frames passed to the user.
+   */
+  uint32_t rx_frames;
+
+  /**
+   * @brief Count of bytes passed to the user.
+   */
+  uint32_t rx_bytes;
+
+  /**
+   * @brief Count of frames dropped due to receive errors.
+   */
+  uint32_t rx_errors;
+
+  /**
+   * @brief Count of frames with a bad IP header or protocol checksum.
+   */
+  uint32_t rx_checksum_errors;
+
+  /**
+   * @brief Count of receive ring refills which ran out of spare buffers.
+   *
+   * The MAC drops frames while receive buffer descriptors are left without
+   * buffer, so return loaned buffers early.
+   */
+  uint32_t rx_no_buffer;
+
+  /**
+   * @brief Count of frames transmitted successfully.
+   */
+  uint32_t tx_frames;
+
+  /**
+   * @brief Count of bytes transmitted successfully.
+   */
+  uint32_t tx_bytes;
+
+  /**
+   * @brief Count of frames with a transmit error.
+   */
+  uint32_t tx_errors;
+
+  /**
+   * @brief Count of bus errors and babbling receive or transmit errors.
+   */
+  uint32_t mac_errors;
+} mk64f12_enet_statistics;
+
+/**
+ * @brief Initializes and enables the ENET.
+ *
+ * @retval RTEMS_SUCCESSFUL Successful operation.
+ * @retval RTEMS_INCORRECT_STATE The ENET is already initialized.
+ * @retval RTEMS_INVALID_ADDRESS The @a config pointer is NULL.
+ * @retval other The interrupt handler installation failed.
+ */
+rtems_status_code mk64f12_enet_initialize(const mk64f12_enet_config *config);
+
+/**
+ * @brief Disables the ENET.
+ *
+ * All frames queued for transmission are completed with an error.  Loaned
+ * receive buffers remain valid until they are returned.
+ */
+void mk64f12_enet_shutdown(void);
+
+/**
+ * @brief Queues a frame for transmission without copying it.
+ *
+ * The @a frame must stay valid until the @a done handler is called.  The
+ * frame includes the Ethernet header but not the CRC, it is appended by the
+ * MAC.
+ *
+ * @param frame The frame to transmit.
+ * @param size The frame size in bytes.
+ * @param flags The transmit flags, see MK64F12_ENET_TX_INSERT_IP_CHECKSUM and
+ *   MK64F12_ENET_TX_INSERT_PROTOCOL_CHECKSUM.
+ * @param done The handler called once the frame is transmitted, may be NULL.
+ * @param arg The argument for the @a done handler.
+ *
+ * @retval RTEMS_SUCCESSFUL Successful operation.
+ * @retval RTEMS_INCORRECT_STATE The ENET is not initialized.
+ * @retval RTEMS_INVALID_SIZE The frame size is zero or too large.
+ * @retval RTEMS_TOO_MANY The transmit ring is full.
+ */
+rtems_status_code mk64f12_enet_transmit(
+  const void *frame,
+  size_t size,
+  uint32_t flags,
+  mk64f12_enet_tx_done done,
+  void *arg
+);
+
+/**
+ * @brief Reclaims the completed transmit buffer descriptors and calls their
+ * done handlers.
+ *
+ * This is done by the transmit interrupt as well, so a call is only necessary
+ * for a polled operation.
+ */
+void mk64f12_enet_tx_reclaim(void);
+
+/**
+ * @brief Loans the next received frame to the caller.
+ *
+ * The frame must be given back with mk64f12_enet_rx_buffer_return().  The
+ * frame includes the Ethernet header but not the CRC.
+ *
+ * @param[out] size The frame size in bytes.
+ * @param[out] flags The receive flags of the frame, see MK64F12_ENET_RX_IPV4
+ *   and the following.
+ *
+ * @return The frame or NULL if no frame is available.
+ */
+void *mk64f12_enet_receive(size_t *size, uint32_t *flags);
+
+/**
+ * @brief Returns a frame loaned by mk64f12_enet_receive().
+ */
+void mk64f12_enet_rx_buffer_return(void *frame);
+
+/**
+ * @brief Reads the @a reg register of the PHY at MDIO address @a phy.
+ *
+ * The MDIO clock is set up by mk64f12_enet_initialize().
+ */
+uint16_t mk64f12_enet_mdio_read(uint32_t phy, uint32_t reg);
+
+/**
+ * @brief Writes @a value to the @a reg register of the PHY at MDIO address
+ * @a phy.
+ */
+void mk64f12_enet_mdio_write(uint32_t phy, uint32_t reg, uint16_t value);
+
+/**
+ * @brief Gets the driver statistics.
+ */
+void mk64f12_enet_get_statistics(mk64f12_enet_statistics *stats);
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* LIBBSP_ARM_MK64F12_ENET_H */
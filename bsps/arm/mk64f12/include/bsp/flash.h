@@ -0,0 +1,348 @@
+/**
+ * @file
+ * @ingroup mk64f12_flash
+ * @brief FTFE (program flash) driver with JFFS2 and flash disk backends.
+ */
+
+/*
+ * Copyright (c) 2026 Dave Rush.  All rights reserved.
+ *
+ * The license and distribution terms for this file may be
+ * found in the file LICENSE in this distribution or at
+ * http://www.rtems.org/license/LICENSE.
+ */
+
+#ifndef LIBBSP_ARM_MK64F12_FLASH_H
+#define LIBBSP_ARM_MK64F12_FLASH_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <rtems.h>
+#include <rtems/flashdisk.h>
+#include <rtems/jffs2.h>
+#include <rtems/thread.h>
+
+/**
+ * @defgroup mk64f12_flash Flash Support
+ * @ingroup RTEMSBSPsARMMK64F12
+ * @brief Flash Support
+ *
+ * The program flash consists of two blocks of 512KiB.  It is erased in
+ * sectors of 4KiB and programmed in phrases of 8 bytes.  The FTFE commands of
+ * an erase or write are launched back to back: for a range in the second
+ * block while the application image fits into the first block, by the command
+ * complete interrupt, so that the CPU continues to execute from the first
+ * block; otherwise one by one by a routine in the .fast_text section with
+ * interrupts disabled until the command completed.
+ *
+ * The flash is accessed through a flash device.  The flash device of the
+ * FTFE is mk64f12_flash_internal, a simulated flash device in RAM is provided
+ * for tests of flash file systems.  The JFFS2 and the flash disk backends use
+ * a region of a flash device.
+ *
+ * A phrase may be programmed only once after the erase of its sector.  The
+ * JFFS2 backend tells the JFFS2 the phrase size as the write size, so that
+ * nodes are not marked obsolete on the flash, and buffers the last partially
+ * written phrase.  The flash disk backend writes the page descriptor flag
+ * updates to a shadow area after each segment.
+ *
+ * @{
+ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/**
+ * @brief Size of the program flash in bytes.
+ */
+#define MK64F12_FLASH_SIZE 0x100000U
+
+/**
+ * @brief Size of a program flash block in bytes.
+ */
+#define MK64F12_FLASH_BLOCK_SIZE 0x80000U
+
+/**
+ * @brief Size of the erasable unit in bytes.
+ */
+#define MK64F12_FLASH_SECTOR_SIZE 4096U
+
+/**
+ * @brief Size of the programmable unit in bytes.
+ */
+#define MK64F12_FLASH_PHRASE_SIZE 8U
+
+/**
+ * @brief Flash device statistics.
+ */
+typedef struct {
+  /**
+   * @brief Count of erased sectors.
+   */
+  uint32_t erased_sectors;
+
+  /**
+   * @brief Count of programmed phrases.
+   */
+  uint32_t programmed_phrases;
+
+  /**
+   * @brief Count of writes refused since they would program a phrase a
+   *   second time.
+   */
+  uint32_t refused_writes;
+
+  /**
+   * @brief Count of failed erase and program operations.
+   */
+  uint32_t errors;
+} mk64f12_flash_statistics;
+
+typedef struct mk64f12_flash_device mk64f12_flash_device;
+
+/**
+ * @brief Flash device.
+ *
+ * The operations are called with the device mutex locked.
+ */
+struct mk64f12_flash_device {
+  /**
+   * @brief Erases @a count sectors starting at @a offset.
+   */
+  rtems_status_code (*erase)(
+    mk64f12_flash_device *self,
+    uint32_t offset,
+    uint32_t count
+  );
+
+  /**
+   * @brief Programs @a count phrases of @a data starting at @a offset.
+   */
+  rtems_status_code (*program)(
+    mk64f12_flash_device *self,
+    uint32_t offset,
+    const uint8_t *data,
+    uint32_t count
+  );
+
+  /**
+   * @brief The flash contents, readable through the system bus.
+   */
+  const uint8_t *memory;
+
+  /**
+   * @brief The flash size in bytes.
+   */
+  uint32_t size;
+
+  /**
+   * @brief The device mutex.
+   */
+  rtems_mutex mutex;
+
+  /**
+   * @brief The device statistics.
+   */
+  mk64f12_flash_statistics stats;
+};
+
+/**
+ * @brief The flash device of the program flash.
+ *
+ * The offsets are the flash addresses.  Sectors occupied by the application
+ * image cannot be erased or programmed, see mk64f12_flash_image_end().
+ */
+extern mk64f12_flash_device mk64f12_flash_internal;
+
+/**
+ * @brief Initializes the program flash device.
+ *
+ * It installs the command complete interrupt handler.  It may be called more
+ * than once.
+ *
+ * @retval RTEMS_SUCCESSFUL Successful operation.
+ * @retval other The interrupt handler installation failed.
+ */
+rtems_status_code mk64f12_flash_initialize(void);
+
+/**
+ * @brief Returns the begin of the first sector of the program flash after
+ * the application image.
+ */
+uint32_t mk64f12_flash_image_end(void);
+
+/**
+ * @brief Reads @a size bytes at @a offset of the flash device.
+ *
+ * @retval RTEMS_SUCCESSFUL Successful operation.
+ * @retval RTEMS_INVALID_ADDRESS The area is outside the flash device.
+ */
+rtems_status_code mk64f12_flash_read(
+  mk64f12_flash_device *device,
+  uint32_t offset,
+  void *buffer,
+  size_t size
+);
+
+/**
+ * @brief Writes @a size bytes at @a offset of the flash device.
+ *
+ * The offset and size have no alignment restrictions.  Like for a NOR flash,
+ * the written bits are AND combined with the bits in the flash.  Phrases which
+ * would not change are not programmed.  The write is refused if it would
+ * change a phrase which is not erased.
+ *
+ * @retval RTEMS_SUCCESSFUL Successful operation.
+ * @retval RTEMS_INVALID_ADDRESS The area is outside the flash device or
+ *   overlaps with the application image.
+ * @retval RTEMS_IO_ERROR The write would change a phrase which is not erased,
+ *   the flash is unchanged.  Alternatively, the program command failed.
+ */
+rtems_status_code mk64f12_flash_write(
+  mk64f12_flash_device *device,
+  uint32_t offset,
+  const void *buffer,
+  size_t size
+);
+
+/**
+ * @brief Erases the sectors of the area at @a offset with @a size bytes of
+ * the flash device.
+ *
+ * The offset and size must be integral multiples of the sector size.
+ *
+ * @retval RTEMS_SUCCESSFUL Successful operation.
+ * @retval RTEMS_INVALID_ADDRESS The area is not sector aligned, outside the
+ *   flash device or overlaps with the application image.
+ * @retval RTEMS_IO_ERROR The erase command failed.
+ */
+rtems_status_code mk64f12_flash_erase(
+  mk64f12_flash_device *device,
+  uint32_t offset,
+  size_t size
+);
+
+/**
+ * @brief Gets the flash device statistics.
+ */
+void mk64f12_flash_get_statistics(
+  mk64f12_flash_device *device,
+  mk64f12_flash_statistics *stats
+);
+
+/**
+ * @brief Simulated flash device.
+ *
+ * The flash contents are in RAM.  The device has the sector and phrase sizes,
+ * the alignment restrictions and the NOR semantics of the program flash.  It
+ * has no hardware dependencies.
+ */
+typedef struct {
+  mk64f12_flash_device device;
+  uint8_t *memory;
+} mk64f12_flash_sim;
+
+/**
+ * @brief Initializes a simulated flash device with @a size bytes at
+ * @a memory.
+ *
+ * The size must be an integral multiple of the sector size.  All sectors are
+ * erased.
+ */
+void mk64f12_flash_sim_initialize(
+  mk64f12_flash_sim *sim,
+  void *memory,
+  uint32_t size
+);
+
+/**
+ * @brief JFFS2 flash control for a region of a flash device.
+ */
+typedef struct {
+  rtems_jffs2_flash_control super;
+  mk64f12_flash_device *device;
+  uint32_t offset;
+
+  /**
+   * @brief The offset of the buffered phrase in the region or UINT32_MAX.
+   */
+  uint32_t pending;
+
+  /**
+   * @brief The buffered phrase.
+   *
+   * A write which ends within an erased phrase is buffered here.  The phrase
+   * is programmed once a write fills it, a write ends in another phrase, or
+   * the file system is unmounted.
+   */
+  uint8_t pending_data[MK64F12_FLASH_PHRASE_SIZE];
+} mk64f12_flash_jffs2_control;
+
+/**
+ * @brief Initializes a JFFS2 flash control for the region of the flash
+ * device at @a offset with @a size bytes.
+ *
+ * The offset and size must be integral multiples of the sector size, the
+ * JFFS2 block size is the sector size and the write size is the phrase size.
+ * Use @c &self->super as the flash control of the JFFS2 mount data.
+ *
+ * A power loss may lose the buffered phrase.  The JFFS2 detects the
+ * incomplete node by its CRC.
+ */
+void mk64f12_flash_jffs2_initialize(
+  mk64f12_flash_jffs2_control *self,
+  mk64f12_flash_device *device,
+  uint32_t offset,
+  uint32_t size
+);
+
+/**
+ * @brief Default page size of the flash disk driver handlers.
+ */
+#define MK64F12_FLASH_FDISK_PAGE_SIZE 512U
+
+/**
+ * @brief Size of a flash disk segment which fits into @a sectors sectors
+ * for the page size @a page_size.
+ *
+ * A segment is followed by a shadow area with a phrase for each page, which
+ * takes the page descriptor flag updates.
+ */
+#define MK64F12_FLASH_FDISK_SEGMENT_SIZE(sectors, page_size) \
+  (((sectors) * MK64F12_FLASH_SECTOR_SIZE / \
+    ((page_size) + MK64F12_FLASH_PHRASE_SIZE)) * (page_size))
+
+/**
+ * @brief Flash disk driver handlers.
+ *
+ * The segment offsets are the offsets in the flash device selected by
+ * mk64f12_flash_fdisk_set_device(), by default mk64f12_flash_internal.  The
+ * offset of the first segment of a segment descriptor must be an integral
+ * multiple of the sector size.  The segment sizes must be integral multiples
+ * of the page size, see MK64F12_FLASH_FDISK_SEGMENT_SIZE().  Each segment
+ * occupies the sectors of its size plus the size of its shadow area.
+ */
+extern const rtems_fdisk_driver_handlers mk64f12_flash_fdisk_handlers;
+
+/**
+ * @brief Selects the flash device of the flash disk driver handlers and the
+ * page size of the flash disk.
+ *
+ * The page size is the block size of the flash disk configuration.  It must
+ * be an integral multiple of the phrase size.  The default is
+ * MK64F12_FLASH_FDISK_PAGE_SIZE.
+ */
+void mk64f12_flash_fdisk_set_device(
+  mk64f12_flash_device *device,
+  uint32_t page_size
+);
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* LIBBSP_ARM_MK64F12_FLASH_H */
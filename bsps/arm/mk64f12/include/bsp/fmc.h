@@ -0,0 +1,176 @@
+/**
+ * @file
+ * @ingroup mk64f12_fmc
+ * @brief FMC (flash memory controller) support.
+ */
+
+/*
+ * Copyright (c) 2026 Dave Rush.  All rights reserved.
+ *
+ * The license and distribution terms for this file may be
+ * found in the file LICENSE in this distribution or at
+ * http://www.rtems.org/license/LICENSE.
+ */
+
+#ifndef LIBBSP_ARM_MK64F12_FMC_H
+#define LIBBSP_ARM_MK64F12_FMC_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/**
+ * @defgroup mk64f12_fmc FMC Support
+ * @ingroup RTEMSBSPsARMMK64F12
+ * @brief FMC Support
+ *
+ * The FMC sits between the crossbar masters and the two program flash banks.
+ * Each bank has a single entry speculation buffer with instruction and data
+ * prefetch.  A four way cache of 256 bytes per way is shared by the banks.
+ * The BSP start applies MK64F12_FMC_PREFETCH_MASTERS and
+ * MK64F12_FMC_CACHE_REPLACEMENT, the banks are left in their reset
+ * configuration with all speculation and caching enabled.
+ *
+ * @{
+ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/**
+ * @brief Count of program flash banks.
+ */
+#define MK64F12_FMC_BANK_COUNT 2
+
+/**
+ * @brief Crossbar master of the ARM core code bus.
+ */
+#define MK64F12_FMC_MASTER_CORE_CODE 0x1U
+
+/**
+ * @brief Crossbar master of the ARM core system bus.
+ */
+#define MK64F12_FMC_MASTER_CORE_SYSTEM 0x2U
+
+/**
+ * @brief Crossbar master of the eDMA and the EzPort.
+ */
+#define MK64F12_FMC_MASTER_DMA 0x4U
+
+/**
+ * @brief Crossbar master of the ENET.
+ */
+#define MK64F12_FMC_MASTER_ENET 0x8U
+
+/**
+ * @brief Cache replacement control.
+ */
+typedef enum {
+  /**
+   * @brief LRU replacement on all four ways for instruction fetches and data.
+   */
+  MK64F12_FMC_CACHE_LRU_ALL = 0,
+
+  /**
+   * @brief Ways 0 and 1 for instruction fetches, ways 2 and 3 for data.
+   */
+  MK64F12_FMC_CACHE_LRU_IFETCH_2_DATA_2 = 2,
+
+  /**
+   * @brief Ways 0 to 2 for instruction fetches, way 3 for data.
+   */
+  MK64F12_FMC_CACHE_LRU_IFETCH_3_DATA_1 = 3
+} mk64f12_fmc_cache_replacement;
+
+/**
+ * @brief Configuration of a program flash bank.
+ */
+typedef struct {
+  /**
+   * @brief If true, then the single entry speculation buffer is enabled.
+   */
+  bool single_entry_buffer;
+
+  /**
+   * @brief If true, then instruction fetches are prefetched.
+   */
+  bool instruction_prefetch;
+
+  /**
+   * @brief If true, then data references are prefetched.
+   */
+  bool data_prefetch;
+
+  /**
+   * @brief If true, then instruction fetches are cached.
+   */
+  bool instruction_cache;
+
+  /**
+   * @brief If true, then data references are cached.
+   */
+  bool data_cache;
+} mk64f12_fmc_bank_config;
+
+/**
+ * @brief FMC configuration.
+ */
+typedef struct {
+  /**
+   * @brief The bank configurations.
+   */
+  mk64f12_fmc_bank_config banks[MK64F12_FMC_BANK_COUNT];
+
+  /**
+   * @brief The cache replacement control.
+   */
+  mk64f12_fmc_cache_replacement replacement;
+
+  /**
+   * @brief Set of cache ways which are locked, bit n is way n.
+   *
+   * The contents of a locked way stay in the cache until the way is
+   * unlocked.
+   */
+  uint8_t locked_ways;
+
+  /**
+   * @brief Set of crossbar masters which may trigger prefetches, see
+   * MK64F12_FMC_MASTER_CORE_CODE and the following.
+   */
+  uint8_t prefetch_masters;
+} mk64f12_fmc_config;
+
+/**
+ * @brief Gets the FMC configuration.
+ */
+void mk64f12_fmc_get_config(mk64f12_fmc_config *config);
+
+/**
+ * @brief Sets the FMC configuration.
+ *
+ * The cache and the speculation buffers are invalidated, unless a way is
+ * locked.  The registers are written by a routine executing from RAM.
+ */
+void mk64f12_fmc_set_config(const mk64f12_fmc_config *config);
+
+/**
+ * @brief Invalidates the cache ways which are not locked and the speculation
+ * buffers.
+ */
+void mk64f12_fmc_invalidate(void);
+
+/**
+ * @brief Applies the FMC configuration BSP options.
+ *
+ * This is done by bsp_start().
+ */
+void mk64f12_fmc_initialize(void);
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* LIBBSP_ARM_MK64F12_FMC_H */
@@ -0,0 +1,92 @@
+/**
+ * @file
+ * @ingroup mk64f12_mmcau
+ * @brief MMCAU (crypto acceleration unit) message digest support.
+ */
+
+/*
+ * Copyright (c) 2026 Dave Rush.  All rights reserved.
+ *
+ * The license and distribution terms for this file may be
+ * found in the file LICENSE in this distribution or at
+ * http://www.rtems.org/license/LICENSE.
+ */
+
+#ifndef LIBBSP_ARM_MK64F12_MMCAU_H
+#define LIBBSP_ARM_MK64F12_MMCAU_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * @defgroup mk64f12_mmcau MMCAU Support
+ * @ingroup RTEMSBSPsARMMK64F12
+ * @brief MMCAU Support
+ *
+ * The BSP start installs block transforms for the MD5 and SHA-256
+ * implementations of libmd, see <rtems/mdtransform.h>.  If
+ * MK64F12_MMCAU_HASH is enabled and the MMCAU passes a known answer test,
+ * then the MMCAU transforms are installed, otherwise the ARMv7E-M optimized
+ * software transforms.
+ *
+ * The MMCAU has a single register set, so the MMCAU transforms serialize the
+ * users by a mutex.  In interrupt context, they use the software transforms.
+ * The transforms have the signature of a rtems_md_transform.
+ *
+ * @{
+ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/**
+ * @brief MD5 block transform using the MMCAU.
+ */
+void mk64f12_mmcau_md5_transform(
+  uint32_t *state,
+  const unsigned char *blocks,
+  size_t count
+);
+
+/**
+ * @brief SHA-256 block transform using the MMCAU.
+ */
+void mk64f12_mmcau_sha256_transform(
+  uint32_t *state,
+  const unsigned char *blocks,
+  size_t count
+);
+
+/**
+ * @brief MD5 block transform optimized for the ARMv7E-M architecture.
+ */
+void mk64f12_armv7em_md5_transform(
+  uint32_t *state,
+  const unsigned char *blocks,
+  size_t count
+);
+
+/**
+ * @brief SHA-256 block transform optimized for the ARMv7E-M architecture.
+ */
+void mk64f12_armv7em_sha256_transform(
+  uint32_t *state,
+  const unsigned char *blocks,
+  size_t count
+);
+
+/**
+ * @brief Installs the message digest block transforms.
+ *
+ * This is done by bsp_start().
+ */
+void mk64f12_md_initialize(void);
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* LIBBSP_ARM_MK64F12_MMCAU_H */
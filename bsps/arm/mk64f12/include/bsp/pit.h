@@ -0,0 +1,53 @@
+/**
+ * @file
+ * @ingroup mk64f12_pit
+ * @brief PIT (periodic interrupt timer) timecounter support.
+ */
+
+/*
+ * Copyright (c) 2026 Dave Rush.  All rights reserved.
+ *
+ * The license and distribution terms for this file may be
+ * found in the file LICENSE in this distribution or at
+ * http://www.rtems.org/license/LICENSE.
+ */
+
+#ifndef LIBBSP_ARM_MK64F12_PIT_H
+#define LIBBSP_ARM_MK64F12_PIT_H
+
+#include <stdint.h>
+
+/**
+ * @defgroup mk64f12_pit PIT Support
+ * @ingroup RTEMSBSPsARMMK64F12
+ * @brief PIT Support
+ *
+ * The PIT channels 0 and 1 are chained to a free running 64-bit counter
+ * clocked by the bus clock.  The lower 32 bits are the timecounter of the
+ * system.  Channel 2 is the one-shot comparator of the high resolution
+ * watchdogs.  Channel 3 is the wake up timer of the tickless idle mode.
+ *
+ * @{
+ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/**
+ * @brief Returns the count of bus clock cycles since the PIT initialization.
+ */
+uint64_t mk64f12_pit_read(void);
+
+/**
+ * @brief Returns the frequency of the free running PIT counter in Hz.
+ */
+uint32_t mk64f12_pit_frequency(void);
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* LIBBSP_ARM_MK64F12_PIT_H */
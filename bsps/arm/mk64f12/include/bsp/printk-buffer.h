@@ -0,0 +1,109 @@
+/**
+ * @file
+ * @ingroup mk64f12_printk
+ * @brief Buffered printk() support.
+ */
+
+/*
+ * Copyright (c) 2026 Dave Rush.  All rights reserved.
+ *
+ * The license and distribution terms for this file may be
+ * found in the file LICENSE in this distribution or at
+ * http://www.rtems.org/license/LICENSE.
+ */
+
+#ifndef LIBBSP_ARM_MK64F12_PRINTK_BUFFER_H
+#define LIBBSP_ARM_MK64F12_PRINTK_BUFFER_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include <rtems.h>
+
+/**
+ * @defgroup mk64f12_printk Buffered printk() Support
+ * @ingroup RTEMSBSPsARMMK64F12
+ * @brief Buffered printk() Support
+ *
+ * If the BSP option MK64F12_PRINTK_BUFFER_SIZE is not zero, then the
+ * characters of printk() and the other users of BSP_output_char are stored in
+ * a buffer instead of waiting for the UART.  The buffer is a lock-free
+ * multiple producer ring, so it may be used in any context including
+ * interrupts.  If the buffer is full, then the character is dropped and
+ * counted.
+ *
+ * The idle thread drains the buffer with polled writes to the console UART.
+ * The idle thread does not sleep while the buffer contains characters.
+ * Before the multitasking start, after the system termination and in the
+ * fatal error extension of the BSP, the buffer is drained and the characters
+ * are written directly.
+ *
+ * @{
+ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/**
+ * @brief Buffered printk() statistics.
+ */
+typedef struct {
+  /**
+   * @brief Count of characters stored in the buffer.
+   */
+  uint32_t chars;
+
+  /**
+   * @brief Count of characters dropped since the buffer was full.
+   */
+  uint32_t dropped;
+
+  /**
+   * @brief Maximum count of characters in the buffer seen by a drain.
+   */
+  uint32_t max_fill;
+} mk64f12_printk_statistics;
+
+/**
+ * @brief Stores the character in the buffer.
+ *
+ * This is the BSP_output_char handler if the buffer is enabled.
+ */
+void mk64f12_printk_output_char(char c);
+
+/**
+ * @brief Writes the characters of the buffer to the console UART.
+ *
+ * The write is polled.  Characters which are not completely stored by a
+ * preempted producer stop the drain.
+ */
+void mk64f12_printk_flush(void);
+
+/**
+ * @brief Returns true, if the buffer contains no characters, otherwise false.
+ */
+bool mk64f12_printk_is_empty(void);
+
+/**
+ * @brief Gets the buffered printk() statistics.
+ */
+void mk64f12_printk_get_statistics(mk64f12_printk_statistics *stats);
+
+/**
+ * @brief Drains the buffer and makes the following output synchronous, then
+ * calls bsp_fatal_extension().
+ */
+void mk64f12_printk_fatal_extension(
+  rtems_fatal_source source,
+  bool always_set_to_false,
+  rtems_fatal_code code
+);
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* LIBBSP_ARM_MK64F12_PRINTK_BUFFER_H */
@@ -0,0 +1,90 @@
+/**
+ * @file
+ * @ingroup mk64f12_rng
+ * @brief RNGA (random number generator accelerator) entropy pool support.
+ */
+
+/*
+ * Copyright (c) 2026 Dave Rush.  All rights reserved.
+ *
+ * The license and distribution terms for this file may be
+ * found in the file LICENSE in this distribution or at
+ * http://www.rtems.org/license/LICENSE.
+ */
+
+#ifndef LIBBSP_ARM_MK64F12_RNG_H
+#define LIBBSP_ARM_MK64F12_RNG_H
+
+#include <stdint.h>
+
+/**
+ * @defgroup mk64f12_rng RNG Support
+ * @ingroup RTEMSBSPsARMMK64F12
+ * @brief RNG Support
+ *
+ * The getentropy() implementation copies from a pool of ChaCha20 keystream
+ * bytes.  The ChaCha20 key is seeded from the RNGA during the device driver
+ * initialization, see also <bsp/deferred-init.h>, or by the first
+ * getentropy() call before it.  The key is replaced by the first keystream
+ * block of each pool refill, so that consumed output cannot be
+ * reconstructed.  The RNGA generates words in the background.  Each
+ * getentropy() call collects at most one word without waiting, after
+ * MK64F12_RNG_RESEED_INTERVAL bytes of output the collected words are mixed
+ * into the key.
+ *
+ * Each RNGA word is health checked.  Words with a security violation or
+ * error status and words which repeat the previous word are discarded and
+ * counted.
+ *
+ * In interrupt context, the getentropy() function fails with errno set to
+ * EIO.
+ *
+ * @{
+ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/**
+ * @brief Entropy pool statistics.
+ */
+typedef struct {
+  /**
+   * @brief Count of bytes returned by getentropy().
+   */
+  uint64_t bytes;
+
+  /**
+   * @brief Count of pool refills.
+   */
+  uint32_t refills;
+
+  /**
+   * @brief Count of reseeds from the RNGA, excluding the initial seed.
+   */
+  uint32_t reseeds;
+
+  /**
+   * @brief Count of RNGA words which passed the health check.
+   */
+  uint32_t rnga_words;
+
+  /**
+   * @brief Count of RNGA words which failed the health check.
+   */
+  uint32_t health_failures;
+} mk64f12_rng_statistics;
+
+/**
+ * @brief Gets the entropy pool statistics.
+ */
+void mk64f12_rng_get_statistics(mk64f12_rng_statistics *stats);
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* LIBBSP_ARM_MK64F12_RNG_H */
@@ -15,6 +15,9 @@
 #ifndef LIBBSP_ARM_MK64FN_USART_H
 #define LIBBSP_ARM_MK64FN_USART_H
 
+#include <stdbool.h>
+#include <stdint.h>
+
 #include <libchip/serial.h>
 
 /**
@@ -28,9 +31,76 @@
 extern "C" {
 #endif /* __cplusplus */
 
-/* TODO: implement the console driver */
+/**
+ * @brief Console driver functions.
+ *
+ * The driver uses the TX/RX FIFO watermark interrupts if the BSP option
+ * CONSOLE_USE_INTERRUPTS is enabled, otherwise it is fully polled.  In
+ * interrupt mode the BSP option MK64F12_USART_USE_DMA moves the data transfer
+ * to the eDMA, UART0 to UART3 are supported.
+ */
 extern const console_fns mk64f12_usart_fns;
 
+/**
+ * @brief Returns the next received character or -1 if the RX FIFO is empty.
+ *
+ * This function does not depend on the driver mode and may be used for
+ * polled input, e.g. by the debug console.
+ */
+int mk64f12_usart_read_polled(int minor);
+
+/**
+ * @brief Writes the character polled to the console UART.
+ */
+void mk64f12_console_output_char(char c);
+
+/**
+ * @brief USART driver statistics.
+ */
+typedef struct {
+  /**
+   * @brief Count of UART interrupts.
+   */
+  uint32_t interrupts;
+
+  /**
+   * @brief Count of eDMA channel interrupts.
+   */
+  uint32_t dma_interrupts;
+
+  /**
+   * @brief Count of overrun, framing and parity errors.
+   */
+  uint32_t rx_errors;
+
+  /**
+   * @brief Count of characters passed to Termios.
+   */
+  uint32_t rx_bytes;
+
+  /**
+   * @brief Count of transmitted characters.
+   */
+  uint32_t tx_bytes;
+} mk64f12_usart_statistics;
+
+/**
+ * @brief Gets the statistics of the USART with the console @a minor number.
+ */
+void mk64f12_usart_get_statistics(
+  int minor,
+  mk64f12_usart_statistics *stats
+);
+
+/**
+ * @brief Enables or disables the internal loop back of the USART with the
+ * console @a minor number.
+ *
+ * In loop back mode the transmitter output is internally connected to the
+ * receiver input and the RX pin is not used.
+ */
+void mk64f12_usart_set_loopback(int minor, bool enable);
+
 /** @} */
 
 #ifdef __cplusplus
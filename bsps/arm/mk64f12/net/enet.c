@@ -0,0 +1,735 @@
+/*
+ * Copyright (c) 2026 Dave Rush.  All rights reserved.
+ *
+ * The license and distribution terms for this file may be
+ * found in the file LICENSE in this distribution or at
+ * http://www.rtems.org/license/LICENSE.
+ */
+
+#include <string.h>
+
+#include <bsp.h>
+#include <bsp/enet.h>
+#include <bsp/irq.h>
+#include <bsp/mk64f12.h>
+
+#include <MK64F12.h>
+
+#define ENET_ENHANCEDBUFFERDESCRIPTOR_MODE
+#include <fsl_enet.h>
+
+/*
+ * The ENET DMA requires 16 byte aligned buffer descriptors and receive
+ * buffers.  They are aligned to the cache line size, so that the driver stays
+ * correct on a chip with a data cache.
+ */
+#define ENET_ALIGNMENT CPU_CACHE_LINE_BYTES
+
+/* Maximum frame length including a VLAN tag and the CRC */
+#define ENET_MAX_FRAME_LENGTH 1522
+
+#define ENET_MAX_TX_FRAME_SIZE (ENET_MAX_FRAME_LENGTH - 4)
+
+#define ENET_MDC_FREQUENCY 2500000
+
+#define ENET_PAUSE_TYPE 0x8808
+
+#define ENET_PROTOCOL_ICMP 1
+
+#define ENET_PROTOCOL_TCP 6
+
+#define ENET_PROTOCOL_UDP 17
+
+#define ENET_RX_BUFFER_COUNT \
+  (MK64F12_ENET_RX_RING_SIZE + MK64F12_ENET_RX_SPARE_COUNT)
+
+#define ENET_MAC_ERRORS \
+  (ENET_EIR_EBERR_MASK | ENET_EIR_BABR_MASK | ENET_EIR_BABT_MASK)
+
+/*
+ * Enhanced buffer descriptor in the little-endian layout selected by
+ * ECR[DBSWP].  The receive and transmit descriptors share this layout, the
+ * meaning of the extended control words differs.
+ */
+typedef struct {
+  volatile uint16_t length;
+  volatile uint16_t control;
+  volatile uint32_t buffer;
+  volatile uint16_t ext0;
+  volatile uint16_t ext1;
+  volatile uint16_t checksum;
+  volatile uint8_t header_length;
+  volatile uint8_t protocol;
+  volatile uint16_t reserved_0;
+  volatile uint16_t ext2;
+  volatile uint32_t timestamp;
+  volatile uint16_t reserved_1[4];
+} enet_bd;
+
+RTEMS_STATIC_ASSERT(sizeof(enet_bd) == 32, enet_bd_size);
+
+RTEMS_STATIC_ASSERT(ENET_ALIGNMENT % 16 == 0, enet_alignment);
+
+RTEMS_STATIC_ASSERT(
+  MK64F12_ENET_BUFFER_SIZE % 16 == 0
+    && MK64F12_ENET_BUFFER_SIZE >= ENET_MAX_FRAME_LENGTH,
+  enet_buffer_size
+);
+
+typedef struct {
+  const void *frame;
+  mk64f12_enet_tx_done done;
+  void *arg;
+  size_t size;
+} enet_tx_job;
+
+/*
+ * The receive buffer descriptors starting at rx_refill, rx_unfilled in count,
+ * have no buffer and are owned by the driver.  They end right before rx_next.
+ * The MAC stops at rx_refill until a buffer is available for it.
+ */
+typedef struct {
+  rtems_interrupt_lock lock;
+  bool initialized;
+  bool pool_initialized;
+  bool checksum_offload;
+  mk64f12_enet_rx_notify rx_notify;
+  void *rx_notify_arg;
+  size_t rx_next;
+  size_t rx_refill;
+  size_t rx_unfilled;
+  size_t rx_pool_count;
+  void *rx_pool[ENET_RX_BUFFER_COUNT];
+  size_t tx_head;
+  size_t tx_tail;
+  size_t tx_used;
+  enet_tx_job tx_jobs[MK64F12_ENET_TX_RING_SIZE];
+  mk64f12_enet_statistics stats;
+} enet_context;
+
+static enet_context enet_instance = {
+  .lock = RTEMS_INTERRUPT_LOCK_INITIALIZER("ENET")
+};
+
+static enet_bd enet_rx_ring[MK64F12_ENET_RX_RING_SIZE]
+  RTEMS_ALIGNED(ENET_ALIGNMENT);
+
+static enet_bd enet_tx_ring[MK64F12_ENET_TX_RING_SIZE]
+  RTEMS_ALIGNED(ENET_ALIGNMENT);
+
+static uint8_t enet_rx_buffers[ENET_RX_BUFFER_COUNT][MK64F12_ENET_BUFFER_SIZE]
+  RTEMS_ALIGNED(ENET_ALIGNMENT);
+
+static size_t enet_rx_next_index(size_t index)
+{
+  ++index;
+  return index < MK64F12_ENET_RX_RING_SIZE ? index : 0;
+}
+
+static size_t enet_tx_next_index(size_t index)
+{
+  ++index;
+  return index < MK64F12_ENET_TX_RING_SIZE ? index : 0;
+}
+
+static void enet_rx_arm(size_t index, void *buffer)
+{
+  enet_bd *bd = &enet_rx_ring[index];
+  uint16_t control;
+
+  control = ENET_BUFFDESCRIPTOR_RX_EMPTY_MASK;
+
+  if (index == MK64F12_ENET_RX_RING_SIZE - 1) {
+    control |= ENET_BUFFDESCRIPTOR_RX_WRAP_MASK;
+  }
+
+  rtems_cache_invalidate_multiple_data_lines(
+    buffer,
+    MK64F12_ENET_BUFFER_SIZE
+  );
+
+  bd->buffer = (uint32_t) buffer;
+  bd->length = 0;
+  bd->ext0 = 0;
+  bd->ext1 = ENET_BUFFDESCRIPTOR_RX_INTERRUPT_MASK;
+  _ARM_Data_memory_barrier();
+  bd->control = control;
+}
+
+/* The caller must own the lock */
+static bool enet_rx_give_buffer(enet_context *ctx, void *buffer)
+{
+  if (ctx->rx_unfilled > 0) {
+    enet_rx_arm(ctx->rx_refill, buffer);
+    ctx->rx_refill = enet_rx_next_index(ctx->rx_refill);
+    --ctx->rx_unfilled;
+    return true;
+  }
+
+  ctx->rx_pool[ctx->rx_pool_count] = buffer;
+  ++ctx->rx_pool_count;
+  return false;
+}
+
+/* The caller must own the lock */
+static bool enet_rx_refill(enet_context *ctx)
+{
+  bool armed;
+
+  armed = false;
+
+  while (ctx->rx_unfilled > 0 && ctx->rx_pool_count > 0) {
+    --ctx->rx_pool_count;
+    armed = enet_rx_give_buffer(ctx, ctx->rx_pool[ctx->rx_pool_count]);
+  }
+
+  if (ctx->rx_unfilled > 0) {
+    ++ctx->stats.rx_no_buffer;
+  }
+
+  return armed;
+}
+
+static uint32_t enet_rx_get_flags(const enet_context *ctx, const enet_bd *bd)
+{
+  uint16_t control;
+  uint16_t ext0;
+  uint32_t flags;
+
+  control = bd->control;
+  ext0 = bd->ext0;
+  flags = 0;
+
+  if ((control & ENET_BUFFDESCRIPTOR_RX_BROADCAST_MASK) != 0) {
+    flags |= MK64F12_ENET_RX_BROADCAST;
+  }
+
+  if ((control & ENET_BUFFDESCRIPTOR_RX_MULTICAST_MASK) != 0) {
+    flags |= MK64F12_ENET_RX_MULTICAST;
+  }
+
+  if ((ext0 & ENET_BUFFDESCRIPTOR_RX_IPV4_MASK) != 0) {
+    flags |= MK64F12_ENET_RX_IPV4;
+
+    if (
+      ctx->checksum_offload
+        && (ext0 & ENET_BUFFDESCRIPTOR_RX_IPHEADCHECKSUM_MASK) == 0
+    ) {
+      flags |= MK64F12_ENET_RX_IP_CHECKSUM_OK;
+    }
+  }
+
+  if ((ext0 & ENET_BUFFDESCRIPTOR_RX_IPV6_MASK) != 0) {
+    flags |= MK64F12_ENET_RX_IPV6;
+  }
+
+  if (
+    ctx->checksum_offload
+      && (flags & (MK64F12_ENET_RX_IPV4 | MK64F12_ENET_RX_IPV6)) != 0
+      && (ext0 & ENET_BUFFDESCRIPTOR_RX_PROTOCOLCHECKSUM_MASK) == 0
+  ) {
+    switch (bd->protocol) {
+      case ENET_PROTOCOL_ICMP:
+      case ENET_PROTOCOL_TCP:
+      case ENET_PROTOCOL_UDP:
+        flags |= MK64F12_ENET_RX_PROTOCOL_CHECKSUM_OK;
+        break;
+      default:
+        break;
+    }
+  }
+
+  return flags;
+}
+
+void *mk64f12_enet_receive(size_t *size, uint32_t *flags)
+{
+  enet_context *ctx = &enet_instance;
+  rtems_interrupt_lock_context lock_context;
+  void *frame;
+  bool armed;
+
+  frame = NULL;
+  armed = false;
+
+  rtems_interrupt_lock_acquire(&ctx->lock, &lock_context);
+
+  while (ctx->initialized && ctx->rx_unfilled < MK64F12_ENET_RX_RING_SIZE) {
+    enet_bd *bd = &enet_rx_ring[ctx->rx_next];
+    uint16_t control;
+    void *buffer;
+
+    control = bd->control;
+
+    if ((control & ENET_BUFFDESCRIPTOR_RX_EMPTY_MASK) != 0) {
+      break;
+    }
+
+    buffer = (void *) bd->buffer;
+    bd->buffer = 0;
+    ctx->rx_next = enet_rx_next_index(ctx->rx_next);
+    ++ctx->rx_unfilled;
+
+    /* Frames spanning more than one buffer are too long and dropped */
+    if (
+      (control & ENET_BUFFDESCRIPTOR_RX_ERR_MASK) != 0
+        || (control & ENET_BUFFDESCRIPTOR_RX_LAST_MASK) == 0
+        || (bd->ext1 & ENET_BUFFDESCRIPTOR_RX_EXT_ERR_MASK) != 0
+    ) {
+      ++ctx->stats.rx_errors;
+      armed |= enet_rx_give_buffer(ctx, buffer);
+      continue;
+    }
+
+    if (
+      ctx->checksum_offload
+        && (bd->ext0 & (ENET_BUFFDESCRIPTOR_RX_IPHEADCHECKSUM_MASK
+          | ENET_BUFFDESCRIPTOR_RX_PROTOCOLCHECKSUM_MASK)) != 0
+    ) {
+      ++ctx->stats.rx_checksum_errors;
+    }
+
+    frame = buffer;
+    *size = bd->length;
+    *flags = enet_rx_get_flags(ctx, bd);
+    ++ctx->stats.rx_frames;
+    ctx->stats.rx_bytes += bd->length;
+    armed |= enet_rx_refill(ctx);
+    break;
+  }
+
+  rtems_interrupt_lock_release(&ctx->lock, &lock_context);
+
+  if (armed) {
+    ENET->RDAR = ENET_RDAR_RDAR_MASK;
+  }
+
+  return frame;
+}
+
+void mk64f12_enet_rx_buffer_return(void *frame)
+{
+  enet_context *ctx = &enet_instance;
+  rtems_interrupt_lock_context lock_context;
+  bool armed;
+
+  rtems_interrupt_lock_acquire(&ctx->lock, &lock_context);
+  armed = enet_rx_give_buffer(ctx, frame);
+  rtems_interrupt_lock_release(&ctx->lock, &lock_context);
+
+  if (armed) {
+    ENET->RDAR = ENET_RDAR_RDAR_MASK;
+  }
+}
+
+rtems_status_code mk64f12_enet_transmit(
+  const void *frame,
+  size_t size,
+  uint32_t flags,
+  mk64f12_enet_tx_done done,
+  void *arg
+)
+{
+  enet_context *ctx = &enet_instance;
+  rtems_interrupt_lock_context lock_context;
+  enet_tx_job *job;
+  enet_bd *bd;
+  uint16_t control;
+  uint16_t ext1;
+  size_t index;
+
+  if (size == 0 || size > ENET_MAX_TX_FRAME_SIZE) {
+    return RTEMS_INVALID_SIZE;
+  }
+
+  rtems_cache_flush_multiple_data_lines(frame, size);
+
+  rtems_interrupt_lock_acquire(&ctx->lock, &lock_context);
+
+  if (!ctx->initialized) {
+    rtems_interrupt_lock_release(&ctx->lock, &lock_context);
+    return RTEMS_INCORRECT_STATE;
+  }
+
+  if (ctx->tx_used == MK64F12_ENET_TX_RING_SIZE) {
+    rtems_interrupt_lock_release(&ctx->lock, &lock_context);
+    return RTEMS_TOO_MANY;
+  }
+
+  index = ctx->tx_head;
+  ctx->tx_head = enet_tx_next_index(index);
+  ++ctx->tx_used;
+
+  job = &ctx->tx_jobs[index];
+  job->frame = frame;
+  job->done = done;
+  job->arg = arg;
+  job->size = size;
+
+  control = ENET_BUFFDESCRIPTOR_TX_READY_MASK
+    | ENET_BUFFDESCRIPTOR_TX_LAST_MASK
+    | ENET_BUFFDESCRIPTOR_TX_TRANMITCRC_MASK;
+
+  if (index == MK64F12_ENET_TX_RING_SIZE - 1) {
+    control |= ENET_BUFFDESCRIPTOR_TX_WRAP_MASK;
+  }
+
+  ext1 = ENET_BUFFDESCRIPTOR_TX_INTERRUPT_MASK;
+
+  if (ctx->checksum_offload) {
+    if ((flags & MK64F12_ENET_TX_INSERT_IP_CHECKSUM) != 0) {
+      ext1 |= ENET_BUFFDESCRIPTOR_TX_IPCHECKSUM_MASK;
+    }
+
+    if ((flags & MK64F12_ENET_TX_INSERT_PROTOCOL_CHECKSUM) != 0) {
+      ext1 |= ENET_BUFFDESCRIPTOR_TX_PROTOCHECKSUM_MASK;
+    }
+  }
+
+  bd = &enet_tx_ring[index];
+  bd->buffer = (uint32_t) frame;
+  bd->length = (uint16_t) size;
+  bd->ext0 = 0;
+  bd->ext1 = ext1;
+  _ARM_Data_memory_barrier();
+  bd->control = control;
+
+  rtems_interrupt_lock_release(&ctx->lock, &lock_context);
+
+  ENET->TDAR = ENET_TDAR_TDAR_MASK;
+  return RTEMS_SUCCESSFUL;
+}
+
+/*
+ * Completes the transmit jobs one by one, the done handlers are called
+ * without the lock, so that they may queue the next frame.
+ */
+static void enet_tx_complete(enet_context *ctx, bool force)
+{
+  while (true) {
+    rtems_interrupt_lock_context lock_context;
+    enet_tx_job job;
+    enet_bd *bd;
+    bool error;
+
+    rtems_interrupt_lock_acquire(&ctx->lock, &lock_context);
+
+    if (ctx->tx_used == 0) {
+      rtems_interrupt_lock_release(&ctx->lock, &lock_context);
+      break;
+    }
+
+    bd = &enet_tx_ring[ctx->tx_tail];
+
+    if (force) {
+      bd->control &= ~ENET_BUFFDESCRIPTOR_TX_READY_MASK;
+      error = true;
+    } else if ((bd->control & ENET_BUFFDESCRIPTOR_TX_READY_MASK) != 0) {
+      rtems_interrupt_lock_release(&ctx->lock, &lock_context);
+      break;
+    } else {
+      error = (bd->ext0 & ENET_BUFFDESCRIPTOR_TX_ERR_MASK) != 0;
+    }
+
+    job = ctx->tx_jobs[ctx->tx_tail];
+    ctx->tx_tail = enet_tx_next_index(ctx->tx_tail);
+    --ctx->tx_used;
+
+    if (error) {
+      ++ctx->stats.tx_errors;
+    } else {
+      ++ctx->stats.tx_frames;
+      ctx->stats.tx_bytes += job.size;
+    }
+
+    rtems_interrupt_lock_release(&ctx->lock, &lock_context);
+
+    if (job.done != NULL) {
+      (*job.done)(job.arg, job.frame, error);
+    }
+  }
+}
+
+void mk64f12_enet_tx_reclaim(void)
+{
+  enet_tx_complete(&enet_instance, false);
+}
+
+static void enet_tx_interrupt(void *arg)
+{
+  enet_context *ctx = arg;
+
+  ENET->EIR = ENET_EIR_TXF_MASK | ENET_EIR_TXB_MASK;
+  ++ctx->stats.interrupts;
+  enet_tx_complete(ctx, false);
+}
+
+static void enet_rx_interrupt(void *arg)
+{
+  enet_context *ctx = arg;
+
+  ENET->EIR = ENET_EIR_RXF_MASK | ENET_EIR_RXB_MASK;
+  ++ctx->stats.interrupts;
+
+  if (ctx->rx_notify != NULL) {
+    (*ctx->rx_notify)(ctx->rx_notify_arg);
+  }
+}
+
+static void enet_error_interrupt(void *arg)
+{
+  enet_context *ctx = arg;
+  uint32_t eir;
+
+  eir = ENET->EIR & ENET_MAC_ERRORS;
+  ENET->EIR = eir;
+  ++ctx->stats.interrupts;
+
+  if (eir != 0) {
+    ++ctx->stats.mac_errors;
+  }
+}
+
+typedef struct {
+  rtems_vector_number vector;
+  const char *info;
+  rtems_interrupt_handler handler;
+} enet_interrupt;
+
+static const enet_interrupt enet_interrupts[] = {
+  { ENET_Transmit_IRQn, "ENET TX", enet_tx_interrupt },
+  { ENET_Receive_IRQn, "ENET RX", enet_rx_interrupt },
+  { ENET_Error_IRQn, "ENET ERR", enet_error_interrupt }
+};
+
+static void enet_remove_interrupts(enet_context *ctx, size_t count)
+{
+  size_t i;
+
+  for (i = 0; i < count; ++i) {
+    (void) rtems_interrupt_handler_remove(
+      enet_interrupts[i].vector,
+      enet_interrupts[i].handler,
+      ctx
+    );
+  }
+}
+
+static void enet_rings_initialize(enet_context *ctx)
+{
+  size_t i;
+
+  if (!ctx->pool_initialized) {
+    ctx->pool_initialized = true;
+
+    for (i = 0; i < ENET_RX_BUFFER_COUNT; ++i) {
+      ctx->rx_pool[i] = &enet_rx_buffers[i][0];
+    }
+
+    ctx->rx_pool_count = ENET_RX_BUFFER_COUNT;
+  }
+
+  memset(enet_rx_ring, 0, sizeof(enet_rx_ring));
+  memset(enet_tx_ring, 0, sizeof(enet_tx_ring));
+  enet_tx_ring[MK64F12_ENET_TX_RING_SIZE - 1].control =
+    ENET_BUFFDESCRIPTOR_TX_WRAP_MASK;
+
+  /*
+   * Descriptors left without buffer are owned by the driver and follow the
+   * armed ones, so the MAC stops in front of them.
+   */
+  enet_rx_ring[MK64F12_ENET_RX_RING_SIZE - 1].control =
+    ENET_BUFFDESCRIPTOR_RX_WRAP_MASK;
+  ctx->rx_next = 0;
+  ctx->rx_refill = 0;
+  ctx->rx_unfilled = MK64F12_ENET_RX_RING_SIZE;
+  (void) enet_rx_refill(ctx);
+
+  ctx->tx_head = 0;
+  ctx->tx_tail = 0;
+  ctx->tx_used = 0;
+}
+
+rtems_status_code mk64f12_enet_initialize(const mk64f12_enet_config *config)
+{
+  enet_context *ctx = &enet_instance;
+  const uint8_t *mac;
+  rtems_status_code sc;
+  uint32_t rcr;
+  uint32_t tcr;
+  size_t i;
+
+  if (config == NULL) {
+    return RTEMS_INVALID_ADDRESS;
+  }
+
+  if (ctx->initialized) {
+    return RTEMS_INCORRECT_STATE;
+  }
+
+  CLOCK_EnableClock(kCLOCK_Enet0);
+
+  ENET->ECR = ENET_ECR_RESET_MASK;
+  while ((ENET->ECR & ENET_ECR_RESET_MASK) != 0) {
+    /* Wait */
+  }
+
+  ENET->EIMR = 0;
+  ENET->EIR = 0xffffffff;
+  ENET->MSCR = ENET_MSCR_MII_SPEED(
+    CLOCK_GetCoreSysClkFreq() / (2 * ENET_MDC_FREQUENCY)
+  );
+
+  rcr = ENET_RCR_MAX_FL(ENET_MAX_FRAME_LENGTH)
+    | ENET_RCR_CRCFWD_MASK
+    | ENET_RCR_FCE_MASK
+    | ENET_RCR_MII_MODE_MASK;
+  tcr = 0;
+
+  if (config->loopback) {
+    rcr |= ENET_RCR_LOOP_MASK;
+    tcr |= ENET_TCR_FDEN_MASK;
+  } else {
+    rcr |= ENET_RCR_RMII_MODE_MASK;
+
+    if (config->speed_10m) {
+      rcr |= ENET_RCR_RMII_10T_MASK;
+    }
+
+    if (config->half_duplex) {
+      rcr |= ENET_RCR_DRT_MASK;
+    } else {
+      tcr |= ENET_TCR_FDEN_MASK;
+    }
+  }
+
+  if (config->promiscuous) {
+    rcr |= ENET_RCR_PROM_MASK;
+  }
+
+  ENET->RCR = rcr;
+  ENET->TCR = tcr;
+
+  mac = config->mac_address;
+  ENET->PALR = ((uint32_t) mac[0] << 24) | ((uint32_t) mac[1] << 16)
+    | ((uint32_t) mac[2] << 8) | mac[3];
+  ENET->PAUR = ENET_PAUR_PADDR2(((uint32_t) mac[4] << 8) | mac[5])
+    | ENET_PAUR_TYPE(ENET_PAUSE_TYPE);
+  ENET->IAUR = 0;
+  ENET->IALR = 0;
+  ENET->GAUR = 0;
+  ENET->GALR = 0;
+
+  /* The checksum accelerators need store and forward in both directions */
+  ENET->TFWR = ENET_TFWR_STRFWD_MASK;
+  ENET->RSFL = 0;
+  ENET->MRBR = MK64F12_ENET_BUFFER_SIZE & ENET_MRBR_R_BUF_SIZE_MASK;
+
+  ctx->checksum_offload = config->checksum_offload;
+
+  if (ctx->checksum_offload) {
+    ENET->TACC = ENET_TACC_IPCHK_MASK | ENET_TACC_PROCHK_MASK;
+  } else {
+    ENET->TACC = 0;
+  }
+
+  ENET->RACC = ENET_RACC_LINEDIS_MASK;
+
+  ctx->rx_notify = config->rx_notify;
+  ctx->rx_notify_arg = config->rx_notify_arg;
+  enet_rings_initialize(ctx);
+  ENET->RDSR = (uint32_t) &enet_rx_ring[0];
+  ENET->TDSR = (uint32_t) &enet_tx_ring[0];
+
+  for (i = 0; i < RTEMS_ARRAY_SIZE(enet_interrupts); ++i) {
+    sc = rtems_interrupt_handler_install(
+      enet_interrupts[i].vector,
+      enet_interrupts[i].info,
+      RTEMS_INTERRUPT_UNIQUE,
+      enet_interrupts[i].handler,
+      ctx
+    );
+    if (sc != RTEMS_SUCCESSFUL) {
+      enet_remove_interrupts(ctx, i);
+      return sc;
+    }
+  }
+
+  ctx->initialized = true;
+  ENET->EIMR = ENET_EIR_TXF_MASK | ENET_EIR_RXF_MASK | ENET_MAC_ERRORS;
+  ENET->ECR = ENET_ECR_ETHEREN_MASK | ENET_ECR_EN1588_MASK
+    | ENET_ECR_DBSWP_MASK;
+  ENET->RDAR = ENET_RDAR_RDAR_MASK;
+
+  return RTEMS_SUCCESSFUL;
+}
+
+void mk64f12_enet_shutdown(void)
+{
+  enet_context *ctx = &enet_instance;
+  rtems_interrupt_lock_context lock_context;
+  size_t i;
+
+  if (!ctx->initialized) {
+    return;
+  }
+
+  ENET->EIMR = 0;
+  ENET->ECR = ENET_ECR_RESET_MASK;
+  enet_remove_interrupts(ctx, RTEMS_ARRAY_SIZE(enet_interrupts));
+
+  enet_tx_complete(ctx, true);
+
+  rtems_interrupt_lock_acquire(&ctx->lock, &lock_context);
+  ctx->initialized = false;
+
+  /* Received frames not yet passed to the user are dropped */
+  for (i = ctx->rx_unfilled; i < MK64F12_ENET_RX_RING_SIZE; ++i) {
+    enet_bd *bd = &enet_rx_ring[ctx->rx_next];
+
+    ctx->rx_pool[ctx->rx_pool_count] = (void *) bd->buffer;
+    ++ctx->rx_pool_count;
+    bd->buffer = 0;
+    ctx->rx_next = enet_rx_next_index(ctx->rx_next);
+  }
+
+  ctx->rx_unfilled = 0;
+  rtems_interrupt_lock_release(&ctx->lock, &lock_context);
+}
+
+uint16_t mk64f12_enet_mdio_read(uint32_t phy, uint32_t reg)
+{
+  ENET->EIR = ENET_EIR_MII_MASK;
+  ENET->MMFR = ENET_MMFR_ST(1) | ENET_MMFR_OP(2) | ENET_MMFR_PA(phy)
+    | ENET_MMFR_RA(reg) | ENET_MMFR_TA(2);
+
+  while ((ENET->EIR & ENET_EIR_MII_MASK) == 0) {
+    /* Wait */
+  }
+
+  ENET->EIR = ENET_EIR_MII_MASK;
+  return (uint16_t) (ENET->MMFR & ENET_MMFR_DATA_MASK);
+}
+
+void mk64f12_enet_mdio_write(uint32_t phy, uint32_t reg, uint16_t value)
+{
+  ENET->EIR = ENET_EIR_MII_MASK;
+  ENET->MMFR = ENET_MMFR_ST(1) | ENET_MMFR_OP(1) | ENET_MMFR_PA(phy)
+    | ENET_MMFR_RA(reg) | ENET_MMFR_TA(2) | ENET_MMFR_DATA(value);
+
+  while ((ENET->EIR & ENET_EIR_MII_MASK) == 0) {
+    /* Wait */
+  }
+
+  ENET->EIR = ENET_EIR_MII_MASK;
+}
+
+void mk64f12_enet_get_statistics(mk64f12_enet_statistics *stats)
+{
+  enet_context *ctx = &enet_instance;
+  rtems_interrupt_lock_context lock_context;
+
+  rtems_interrupt_lock_acquire(&ctx->lock, &lock_context);
+  *stats = ctx->stats;
+  rtems_interrupt_lock_release(&ctx->lock, &lock_context);
+}
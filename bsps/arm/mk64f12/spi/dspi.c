@@ -0,0 +1,673 @@
+/*
+ * Copyright (c) 2026 Dave Rush.  All rights reserved.
+ *
+ * The license and distribution terms for this file may be
+ * found in the file LICENSE in this distribution or at
+ * http://www.rtems.org/license/LICENSE.
+ */
+
+#include <errno.h>
+
+#include <bsp.h>
+#include <bsp/clock-scaling.h>
+#include <bsp/dspi.h>
+#include <bsp/irq.h>
+#include <bsp/mk64f12.h>
+
+#include <dev/spi/spi.h>
+#include <fsl/edma.h>
+#include <rtems/thread.h>
+
+#include <MK64F12.h>
+
+#define DSPI_WORD_SIZE 8
+
+#define DSPI_CS_COUNT FSL_FEATURE_DSPI_CHIP_SELECT_COUNT
+
+#define DSPI_SR_FLAGS \
+  (SPI_SR_TCF_MASK | SPI_SR_EOQF_MASK | SPI_SR_TFUF_MASK | SPI_SR_TFFF_MASK \
+    | SPI_SR_RFOF_MASK | SPI_SR_RFDF_MASK)
+
+/*
+ * The first and the last frame of a DMA message are pushed as full command
+ * words, the frames in between by the transmit channel, see
+ * dspi_dma_start().  The receive channel moves all frames, so its major loop
+ * count limits the DMA message size.
+ */
+#define DSPI_DMA_MIN_SIZE 3
+
+#define DSPI_DMA_MAX_SIZE 0x7fff
+
+typedef struct {
+  spi_bus base;
+  SPI_Type *regs;
+  rtems_vector_number irq;
+  clock_ip_name_t clock_ip;
+  uint32_t src_clock_hz;
+  size_t fifo_size;
+  rtems_binary_semaphore sem;
+  int error;
+  const spi_ioc_transfer *msg;
+  uint32_t msg_todo;
+  uint32_t command;
+  uint32_t last_command;
+  const uint8_t *tx_buf;
+  size_t tx_todo;
+  uint8_t *rx_buf;
+  size_t rx_todo;
+  size_t in_flight;
+  mk64f12_dspi_statistics stats;
+  bool has_dma;
+  fsl_edma_channel_context tx_edma;
+  fsl_edma_channel_context rx_edma;
+  uint32_t dma_last_word;
+  uint8_t dma_rx_sink;
+  mk64f12_clock_listener clock_listener;
+} dspi_bus;
+
+/* Only SPI0 uses the eDMA, scatter/gather TCDs must be 32 byte aligned */
+static struct fsl_edma_tcd dspi_dma_last_tcd RTEMS_ALIGNED(32);
+
+static const uint8_t dspi_tx_zero;
+
+static const uint8_t dspi_pbr_values[] = { 2, 3, 5, 7 };
+
+static const uint16_t dspi_br_values[] = {
+  2, 4, 6, 8, 16, 32, 64, 128, 256, 512, 1024, 2048, 4096, 8192, 16384,
+  32768
+};
+
+/* DMAMUX request sources of SPI0, only SPI0 has separate RX and TX requests */
+static const uint8_t dspi_dma_sources[2] = {
+  kDmaRequestMux0SPI0Rx & 0xff,
+  kDmaRequestMux0SPI0Tx & 0xff
+};
+
+static uint32_t dspi_ctar(const dspi_bus *bus, const spi_ioc_transfer *msg)
+{
+  uint32_t best_hz;
+  size_t best_pbr;
+  size_t best_br;
+  size_t pbr;
+  size_t delay;
+  uint32_t ctar;
+
+  /* Start with the slowest possible */
+  best_pbr = RTEMS_ARRAY_SIZE(dspi_pbr_values) - 1;
+  best_br = RTEMS_ARRAY_SIZE(dspi_br_values) - 1;
+  best_hz = 0;
+
+  for (pbr = 0; pbr < RTEMS_ARRAY_SIZE(dspi_pbr_values); ++pbr) {
+    size_t br;
+
+    for (br = 0; br < RTEMS_ARRAY_SIZE(dspi_br_values); ++br) {
+      uint32_t hz;
+
+      hz = bus->src_clock_hz / (dspi_pbr_values[pbr] * dspi_br_values[br]);
+
+      if (hz <= msg->speed_hz) {
+        if (hz > best_hz) {
+          best_hz = hz;
+          best_pbr = pbr;
+          best_br = br;
+        }
+
+        break;
+      }
+    }
+  }
+
+  /*
+   * Use about half a clock period for the chip select to clock, after clock
+   * and after transfer delays.  Their scaler is 2^(delay + 1).
+   */
+  delay = 0;
+  while ((2U << (delay + 1)) <= dspi_br_values[best_br]) {
+    ++delay;
+  }
+
+  ctar = SPI_CTAR_FMSZ(DSPI_WORD_SIZE - 1)
+    | SPI_CTAR_PBR(best_pbr) | SPI_CTAR_BR(best_br)
+    | SPI_CTAR_PCSSCK(best_pbr) | SPI_CTAR_CSSCK(delay)
+    | SPI_CTAR_PASC(best_pbr) | SPI_CTAR_ASC(delay)
+    | SPI_CTAR_PDT(best_pbr) | SPI_CTAR_DT(delay);
+
+  if ((msg->mode & SPI_CPOL) != 0) {
+    ctar |= SPI_CTAR_CPOL_MASK;
+  }
+
+  if ((msg->mode & SPI_CPHA) != 0) {
+    ctar |= SPI_CTAR_CPHA_MASK;
+  }
+
+  if ((msg->mode & SPI_LSB_FIRST) != 0) {
+    ctar |= SPI_CTAR_LSBFE_MASK;
+  }
+
+  return ctar;
+}
+
+static void dspi_config(dspi_bus *bus, const spi_ioc_transfer *msg)
+{
+  SPI_Type *regs = bus->regs;
+  uint32_t ctar;
+  uint32_t pcs;
+
+  ctar = dspi_ctar(bus, msg);
+
+  if (regs->CTAR[0] != ctar) {
+    regs->MCR |= SPI_MCR_HALT_MASK;
+    regs->CTAR[0] = ctar;
+    regs->MCR &= ~SPI_MCR_HALT_MASK;
+  }
+
+  if ((msg->mode & SPI_NO_CS) != 0) {
+    pcs = 0;
+  } else {
+    pcs = SPI_PUSHR_PCS(1U << msg->cs);
+  }
+
+  /* The chip select stays asserted between frames with CONT set */
+  bus->command = SPI_PUSHR_CTAS(0) | pcs | SPI_PUSHR_CONT_MASK;
+  bus->last_command = SPI_PUSHR_CTAS(0) | pcs;
+
+  if (!msg->cs_change) {
+    bus->last_command |= SPI_PUSHR_CONT_MASK;
+  }
+}
+
+static void dspi_next_msg(dspi_bus *bus);
+
+static void dspi_fifo_push(dspi_bus *bus)
+{
+  SPI_Type *regs = bus->regs;
+
+  while (bus->tx_todo > 0 && bus->in_flight < bus->fifo_size) {
+    uint32_t data;
+    uint32_t command;
+
+    if (bus->tx_buf != NULL) {
+      data = *bus->tx_buf;
+      ++bus->tx_buf;
+    } else {
+      data = 0;
+    }
+
+    command = bus->tx_todo == 1 ? bus->last_command : bus->command;
+    regs->PUSHR = command | SPI_PUSHR_TXDATA(data);
+    --bus->tx_todo;
+    ++bus->in_flight;
+  }
+}
+
+static void dspi_fifo_pop(dspi_bus *bus)
+{
+  SPI_Type *regs = bus->regs;
+
+  while (
+    bus->rx_todo > 0
+      && ((regs->SR & SPI_SR_RXCTR_MASK) >> SPI_SR_RXCTR_SHIFT) > 0
+  ) {
+    uint32_t data;
+
+    data = regs->POPR;
+    regs->SR = SPI_SR_RFDF_MASK;
+
+    if (bus->rx_buf != NULL) {
+      *bus->rx_buf = (uint8_t) data;
+      ++bus->rx_buf;
+    }
+
+    --bus->rx_todo;
+    --bus->in_flight;
+  }
+}
+
+static void dspi_fifo_start(dspi_bus *bus, const spi_ioc_transfer *msg)
+{
+  SPI_Type *regs = bus->regs;
+
+  ++bus->stats.fifo_messages;
+  bus->tx_buf = msg->tx_buf;
+  bus->tx_todo = msg->len;
+  bus->rx_buf = msg->rx_buf;
+  bus->rx_todo = msg->len;
+  bus->in_flight = 0;
+
+  dspi_fifo_push(bus);
+  regs->RSER = SPI_RSER_RFDF_RE_MASK;
+}
+
+static void dspi_msg_done(dspi_bus *bus)
+{
+  bus->stats.bytes += bus->msg->len;
+  ++bus->msg;
+  --bus->msg_todo;
+  dspi_next_msg(bus);
+}
+
+static void dspi_interrupt(void *arg)
+{
+  dspi_bus *bus = arg;
+
+  ++bus->stats.interrupts;
+  dspi_fifo_pop(bus);
+
+  if (bus->rx_todo == 0) {
+    bus->regs->RSER = 0;
+    dspi_msg_done(bus);
+  } else {
+    dspi_fifo_push(bus);
+  }
+}
+
+static void dspi_dma_start(dspi_bus *bus, const spi_ioc_transfer *msg)
+{
+  SPI_Type *regs = bus->regs;
+  const uint8_t *tx = msg->tx_buf;
+  uint8_t *rx = msg->rx_buf;
+  size_t n = msg->len;
+  struct fsl_edma_tcd tcd;
+  uint32_t first_data;
+  uint32_t last_data;
+
+  ++bus->stats.dma_messages;
+
+  if (tx != NULL) {
+    rtems_cache_flush_multiple_data_lines(tx, n);
+    first_data = tx[0];
+    last_data = tx[n - 1];
+  } else {
+    first_data = 0;
+    last_data = 0;
+  }
+
+  if (rx != NULL) {
+    rtems_cache_invalidate_multiple_data_lines(rx, n);
+  }
+
+  bus->dma_last_word = bus->last_command | SPI_PUSHR_TXDATA(last_data);
+  dspi_dma_last_tcd.SADDR = (uint32_t) &bus->dma_last_word;
+  dspi_dma_last_tcd.SDF = EDMA_TCD_SDF_SSIZE_32BIT | EDMA_TCD_SDF_DSIZE_32BIT
+    | EDMA_TCD_SDF_SOFF(0);
+  dspi_dma_last_tcd.NBYTES = 4;
+  dspi_dma_last_tcd.SLAST = 0;
+  dspi_dma_last_tcd.DADDR = (uint32_t) &regs->PUSHR;
+  dspi_dma_last_tcd.CDF = EDMA_TCD_CDF_CITER(1) | EDMA_TCD_CDF_DOFF(0);
+  dspi_dma_last_tcd.DLAST_SGA = 0;
+  dspi_dma_last_tcd.BMF = EDMA_TCD_BMF_BITER(1) | EDMA_TCD_BMF_D_REQ;
+  rtems_cache_flush_multiple_data_lines(
+    &dspi_dma_last_tcd,
+    sizeof(dspi_dma_last_tcd)
+  );
+
+  tcd.SADDR = (uint32_t) &regs->POPR;
+  tcd.SDF = EDMA_TCD_SDF_SSIZE_8BIT | EDMA_TCD_SDF_DSIZE_8BIT
+    | EDMA_TCD_SDF_SOFF(0);
+  tcd.NBYTES = 1;
+  tcd.SLAST = 0;
+
+  if (rx != NULL) {
+    tcd.DADDR = (uint32_t) rx;
+    tcd.CDF = EDMA_TCD_CDF_CITER(n) | EDMA_TCD_CDF_DOFF(1);
+  } else {
+    tcd.DADDR = (uint32_t) &bus->dma_rx_sink;
+    tcd.CDF = EDMA_TCD_CDF_CITER(n) | EDMA_TCD_CDF_DOFF(0);
+  }
+
+  tcd.DLAST_SGA = 0;
+  tcd.BMF = EDMA_TCD_BMF_BITER(n) | EDMA_TCD_BMF_INT_MAJ | EDMA_TCD_BMF_D_REQ;
+  fsl_edma_copy_and_enable_hardware_requests(bus->rx_edma.edma_tcd, &tcd);
+
+  /*
+   * An 8-bit write to the PUSHR pushes the data together with the command
+   * of the last 32-bit write to the TX FIFO.  So only the first and the last
+   * frame need a full command word.
+   */
+  regs->PUSHR = bus->command | SPI_PUSHR_TXDATA(first_data);
+
+  if (tx != NULL) {
+    tcd.SADDR = (uint32_t) &tx[1];
+    tcd.SDF = EDMA_TCD_SDF_SSIZE_8BIT | EDMA_TCD_SDF_DSIZE_8BIT
+      | EDMA_TCD_SDF_SOFF(1);
+  } else {
+    tcd.SADDR = (uint32_t) &dspi_tx_zero;
+    tcd.SDF = EDMA_TCD_SDF_SSIZE_8BIT | EDMA_TCD_SDF_DSIZE_8BIT
+      | EDMA_TCD_SDF_SOFF(0);
+  }
+
+  tcd.NBYTES = 1;
+  tcd.SLAST = 0;
+  tcd.DADDR = (uint32_t) &regs->PUSHR;
+  tcd.CDF = EDMA_TCD_CDF_CITER(n - 2) | EDMA_TCD_CDF_DOFF(0);
+  tcd.DLAST_SGA = (int32_t) &dspi_dma_last_tcd;
+  tcd.BMF = EDMA_TCD_BMF_BITER(n - 2) | EDMA_TCD_BMF_E_SG;
+  fsl_edma_copy_and_enable_hardware_requests(bus->tx_edma.edma_tcd, &tcd);
+
+  regs->RSER = SPI_RSER_RFDF_RE_MASK | SPI_RSER_RFDF_DIRS_MASK
+    | SPI_RSER_TFFF_RE_MASK | SPI_RSER_TFFF_DIRS_MASK;
+}
+
+static void dspi_dma_abort(dspi_bus *bus)
+{
+  SPI_Type *regs = bus->regs;
+
+  regs->RSER = 0;
+  fsl_edma_disable_hardware_requests(bus->tx_edma.edma_tcd);
+  fsl_edma_disable_hardware_requests(bus->rx_edma.edma_tcd);
+  regs->MCR |= SPI_MCR_HALT_MASK;
+  regs->MCR |= SPI_MCR_CLR_TXF_MASK | SPI_MCR_CLR_RXF_MASK;
+  regs->SR = DSPI_SR_FLAGS;
+  regs->MCR &= ~SPI_MCR_HALT_MASK;
+
+  bus->error = -EIO;
+  bus->msg_todo = 0;
+  rtems_binary_semaphore_post(&bus->sem);
+}
+
+static void dspi_dma_rx_done(fsl_edma_channel_context *edma, uint32_t error)
+{
+  dspi_bus *bus = RTEMS_CONTAINER_OF(edma, dspi_bus, rx_edma);
+
+  ++bus->stats.dma_interrupts;
+
+  if (error != 0) {
+    dspi_dma_abort(bus);
+    return;
+  }
+
+  bus->regs->RSER = 0;
+  dspi_msg_done(bus);
+}
+
+static void dspi_dma_tx_done(fsl_edma_channel_context *edma, uint32_t error)
+{
+  dspi_bus *bus = RTEMS_CONTAINER_OF(edma, dspi_bus, tx_edma);
+
+  ++bus->stats.dma_interrupts;
+
+  /* The transmit channel has only the error interrupt enabled */
+  if (error != 0) {
+    dspi_dma_abort(bus);
+  }
+}
+
+static void dspi_next_msg(dspi_bus *bus)
+{
+  while (bus->msg_todo > 0) {
+    const spi_ioc_transfer *msg = bus->msg;
+
+    if (msg->len == 0) {
+      ++bus->msg;
+      --bus->msg_todo;
+      continue;
+    }
+
+    dspi_config(bus, msg);
+    bus->regs->SR = DSPI_SR_FLAGS;
+
+    if (
+      bus->has_dma
+        && msg->len >= MK64F12_DSPI_DMA_THRESHOLD
+        && msg->len >= DSPI_DMA_MIN_SIZE
+        && msg->len <= DSPI_DMA_MAX_SIZE
+    ) {
+      dspi_dma_start(bus, msg);
+    } else {
+      dspi_fifo_start(bus, msg);
+    }
+
+    return;
+  }
+
+  rtems_binary_semaphore_post(&bus->sem);
+}
+
+static int dspi_check_msg(
+  const dspi_bus *bus,
+  const spi_ioc_transfer *msg,
+  const spi_ioc_transfer *prev_msg
+)
+{
+  if (
+    ((msg->mode & SPI_NO_CS) == 0 && msg->cs >= DSPI_CS_COUNT)
+      || msg->speed_hz > bus->base.max_speed_hz
+      || msg->delay_usecs != 0
+      || (msg->mode & ~(SPI_CPHA | SPI_CPOL | SPI_LSB_FIRST | SPI_NO_CS)) != 0
+      || msg->bits_per_word != DSPI_WORD_SIZE
+  ) {
+    return -EINVAL;
+  }
+
+  /*
+   * The clock and transfer attributes cannot change while the chip select
+   * stays asserted.
+   */
+  if (
+    prev_msg != NULL
+      && !prev_msg->cs_change
+      && (prev_msg->cs != msg->cs
+        || prev_msg->speed_hz != msg->speed_hz
+        || prev_msg->mode != msg->mode)
+  ) {
+    return -EINVAL;
+  }
+
+  return 0;
+}
+
+static int dspi_transfer(
+  spi_bus *base,
+  const spi_ioc_transfer *msgs,
+  uint32_t n
+)
+{
+  dspi_bus *bus = (dspi_bus *) base;
+  uint32_t i;
+
+  for (i = 0; i < n; ++i) {
+    int rv;
+
+    rv = dspi_check_msg(bus, &msgs[i], i > 0 ? &msgs[i - 1] : NULL);
+    if (rv != 0) {
+      return rv;
+    }
+  }
+
+  bus->error = 0;
+  bus->msg = msgs;
+  bus->msg_todo = n;
+  dspi_next_msg(bus);
+  rtems_binary_semaphore_wait(&bus->sem);
+
+  return bus->error;
+}
+
+static int dspi_setup(spi_bus *base)
+{
+  dspi_bus *bus = (dspi_bus *) base;
+  spi_ioc_transfer msg = {
+    .cs_change = base->cs_change,
+    .cs = base->cs,
+    .bits_per_word = base->bits_per_word,
+    .mode = base->mode,
+    .speed_hz = base->speed_hz,
+    .delay_usecs = base->delay_usecs
+  };
+
+  /* Each transfer configures the module according to its messages */
+  return dspi_check_msg(bus, &msg, NULL);
+}
+
+static int dspi_ioctl(spi_bus *base, ioctl_command_t command, void *arg)
+{
+  dspi_bus *bus = (dspi_bus *) base;
+  rtems_interrupt_level level;
+
+  switch (command) {
+    case MK64F12_DSPI_GET_STATISTICS:
+      rtems_interrupt_disable(level);
+      *(mk64f12_dspi_statistics *) arg = bus->stats;
+      rtems_interrupt_enable(level);
+      return 0;
+    default:
+      return -EINVAL;
+  }
+}
+
+static void dspi_dma_route(fsl_edma_channel_context *edma, uint8_t source)
+{
+  unsigned channel = fsl_edma_channel_index_of_tcd(edma->edma_tcd);
+
+  DMAMUX->CHCFG[channel] = 0;
+  DMAMUX->CHCFG[channel] = DMAMUX_CHCFG_SOURCE(source)
+    | DMAMUX_CHCFG_ENBL_MASK;
+}
+
+static bool dspi_dma_init(dspi_bus *bus)
+{
+  rtems_status_code sc;
+
+  bus->rx_edma.done = dspi_dma_rx_done;
+  sc = fsl_edma_obtain_next_free_channel(&bus->rx_edma);
+  if (sc != RTEMS_SUCCESSFUL) {
+    return false;
+  }
+
+  bus->tx_edma.done = dspi_dma_tx_done;
+  sc = fsl_edma_obtain_next_free_channel(&bus->tx_edma);
+  if (sc != RTEMS_SUCCESSFUL) {
+    fsl_edma_release_channel(&bus->rx_edma);
+    return false;
+  }
+
+  dspi_dma_route(&bus->rx_edma, dspi_dma_sources[0]);
+  dspi_dma_route(&bus->tx_edma, dspi_dma_sources[1]);
+
+  return true;
+}
+
+/*
+ * The bus mutex is held across the clock change, so that no transfer uses a
+ * clock and transfer attributes register computed for the previous bus
+ * clock.
+ */
+static void dspi_clock_prepare(mk64f12_clock_listener *listener)
+{
+  dspi_bus *bus = RTEMS_CONTAINER_OF(listener, dspi_bus, clock_listener);
+
+  rtems_recursive_mutex_lock(&bus->base.mutex);
+}
+
+static void dspi_clock_update(mk64f12_clock_listener *listener)
+{
+  dspi_bus *bus = RTEMS_CONTAINER_OF(listener, dspi_bus, clock_listener);
+
+  bus->src_clock_hz = CLOCK_GetBusClkFreq();
+  bus->base.max_speed_hz = bus->src_clock_hz / 2;
+}
+
+static void dspi_clock_complete(mk64f12_clock_listener *listener)
+{
+  dspi_bus *bus = RTEMS_CONTAINER_OF(listener, dspi_bus, clock_listener);
+
+  rtems_recursive_mutex_unlock(&bus->base.mutex);
+}
+
+static void dspi_destroy(spi_bus *base)
+{
+  dspi_bus *bus = (dspi_bus *) base;
+  SPI_Type *regs = bus->regs;
+
+  mk64f12_clock_remove_listener(&bus->clock_listener);
+  regs->RSER = 0;
+  regs->MCR = SPI_MCR_MDIS_MASK | SPI_MCR_HALT_MASK;
+
+  if (bus->has_dma) {
+    fsl_edma_release_channel(&bus->tx_edma);
+    fsl_edma_release_channel(&bus->rx_edma);
+  }
+
+  (void) rtems_interrupt_handler_remove(bus->irq, dspi_interrupt, bus);
+  CLOCK_DisableClock(bus->clock_ip);
+  rtems_binary_semaphore_destroy(&bus->sem);
+  spi_bus_destroy_and_free(&bus->base);
+}
+
+int mk64f12_dspi_register(unsigned int instance, const char *bus_path)
+{
+  static SPI_Type *const regs_table[] = SPI_BASE_PTRS;
+  static const clock_ip_name_t clock_table[] = DSPI_CLOCKS;
+  static const IRQn_Type irq_table[] = SPI_IRQS;
+  dspi_bus *bus;
+  SPI_Type *regs;
+  rtems_status_code sc;
+
+  if (instance >= RTEMS_ARRAY_SIZE(regs_table)) {
+    errno = EINVAL;
+    return -1;
+  }
+
+  bus = (dspi_bus *) spi_bus_alloc_and_init(sizeof(*bus));
+  if (bus == NULL) {
+    return -1;
+  }
+
+  regs = regs_table[instance];
+  bus->regs = regs;
+  bus->irq = irq_table[instance];
+  bus->clock_ip = clock_table[instance];
+  bus->src_clock_hz = CLOCK_GetBusClkFreq();
+  bus->fifo_size = FSL_FEATURE_DSPI_FIFO_SIZEn(regs);
+  bus->base.max_speed_hz = bus->src_clock_hz / 2;
+  bus->base.bits_per_word = DSPI_WORD_SIZE;
+  bus->base.delay_usecs = 0;
+  rtems_binary_semaphore_init(&bus->sem, "DSPI");
+
+  CLOCK_EnableClock(bus->clock_ip);
+  regs->MCR = SPI_MCR_MSTR_MASK | SPI_MCR_PCSIS(0x3f) | SPI_MCR_HALT_MASK
+    | SPI_MCR_CLR_TXF_MASK | SPI_MCR_CLR_RXF_MASK;
+  regs->RSER = 0;
+  regs->SR = DSPI_SR_FLAGS;
+  regs->MCR &= ~SPI_MCR_HALT_MASK;
+
+  if (
+    MK64F12_DSPI_DMA_THRESHOLD > 0
+      && FSL_FEATURE_DSPI_HAS_SEPARATE_DMA_RX_TX_REQn(regs) == 1
+  ) {
+    bus->has_dma = dspi_dma_init(bus);
+  }
+
+  sc = rtems_interrupt_handler_install(
+    bus->irq,
+    "DSPI",
+    RTEMS_INTERRUPT_UNIQUE,
+    dspi_interrupt,
+    bus
+  );
+  if (sc != RTEMS_SUCCESSFUL) {
+    if (bus->has_dma) {
+      fsl_edma_release_channel(&bus->tx_edma);
+      fsl_edma_release_channel(&bus->rx_edma);
+    }
+
+    regs->MCR = SPI_MCR_MDIS_MASK | SPI_MCR_HALT_MASK;
+    CLOCK_DisableClock(bus->clock_ip);
+    rtems_binary_semaphore_destroy(&bus->sem);
+    spi_bus_destroy_and_free(&bus->base);
+    errno = EAGAIN;
+    return -1;
+  }
+
+  bus->base.transfer = dspi_transfer;
+  bus->base.setup = dspi_setup;
+  bus->base.destroy = dspi_destroy;
+  bus->base.ioctl = dspi_ioctl;
+
+  bus->clock_listener.prepare = dspi_clock_prepare;
+  bus->clock_listener.update = dspi_clock_update;
+  bus->clock_listener.complete = dspi_clock_complete;
+  mk64f12_clock_add_listener(&bus->clock_listener);
+
+  return spi_bus_register(&bus->base, bus_path);
+}
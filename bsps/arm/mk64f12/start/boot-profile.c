@@ -0,0 +1,159 @@
+/*
+ * Copyright (c) 2026 Dave Rush.  All rights reserved.
+ *
+ * The license and distribution terms for this file may be
+ * found in the file LICENSE in this distribution or at
+ * http://www.rtems.org/license/LICENSE.
+ */
+
+#include <bsp.h>
+#include <bsp/boot-profile.h>
+#include <bsp/mk64f12.h>
+
+#include <rtems/score/armv7m.h>
+
+#include <inttypes.h>
+
+#ifdef MK64F12_BOOT_PROFILE
+
+typedef struct {
+  uint32_t last;
+  uint64_t elapsed_ns;
+  uint32_t sysinit_ns;
+  size_t count;
+  size_t lost;
+  mk64f12_boot_profile_step steps[MK64F12_BOOT_PROFILE_STEP_COUNT];
+} boot_profile_context;
+
+static boot_profile_context boot_profile_instance;
+
+static uint32_t boot_profile_cycles_to_ns(uint32_t cycles)
+{
+  return (uint32_t) (((uint64_t) cycles * 1000000000)
+    / CLOCK_GetCoreSysClkFreq());
+}
+
+static void boot_profile_add(
+  boot_profile_context *ctx,
+  const char *name,
+  rtems_sysinit_handler handler,
+  uint32_t cycles,
+  bool deferred
+)
+{
+  mk64f12_boot_profile_step *step;
+  uint32_t ns;
+
+  ns = boot_profile_cycles_to_ns(cycles);
+
+  if (!deferred) {
+    ctx->elapsed_ns += ns;
+  }
+
+  if (ctx->count >= RTEMS_ARRAY_SIZE(ctx->steps)) {
+    ++ctx->lost;
+    return;
+  }
+
+  step = &ctx->steps[ctx->count];
+  step->name = name;
+  step->handler = handler;
+  step->duration_ns = ns;
+  step->end_ns = (uint32_t) ctx->elapsed_ns;
+
+  if (deferred) {
+    step->end_ns += boot_profile_cycles_to_ns(_ARMV7M_DWT->cyccnt - ctx->last);
+  }
+
+  step->deferred = deferred;
+  ++ctx->count;
+}
+
+static void boot_profile_sysinit_step(const rtems_sysinit_item *item)
+{
+  boot_profile_context *ctx = &boot_profile_instance;
+  uint32_t now;
+
+  now = _ARMV7M_DWT->cyccnt;
+  boot_profile_add(ctx, NULL, item->handler, now - ctx->last, false);
+  ctx->sysinit_ns = (uint32_t) ctx->elapsed_ns;
+
+  /* Do not account the time spent here */
+  ctx->last = _ARMV7M_DWT->cyccnt;
+}
+
+void mk64f12_boot_profile_start(uint32_t copy_begin, uint32_t copy_end)
+{
+  boot_profile_context *ctx = &boot_profile_instance;
+  uint32_t now;
+
+  now = _ARMV7M_DWT->cyccnt;
+  boot_profile_add(ctx, "start", NULL, copy_begin, false);
+  boot_profile_add(ctx, "copy sections", NULL, copy_end - copy_begin, false);
+  boot_profile_add(ctx, "clear bss", NULL, now - copy_end, false);
+  ctx->last = _ARMV7M_DWT->cyccnt;
+  _Sysinit_Step_handler = boot_profile_sysinit_step;
+}
+
+void mk64f12_boot_profile_record_deferred(
+  const rtems_sysinit_item *item,
+  uint32_t cycles
+)
+{
+  boot_profile_context *ctx = &boot_profile_instance;
+  rtems_interrupt_level level;
+
+  rtems_interrupt_local_disable(level);
+  boot_profile_add(ctx, NULL, item->handler, cycles, true);
+  rtems_interrupt_local_enable(level);
+}
+
+size_t mk64f12_boot_profile_get_steps(
+  const mk64f12_boot_profile_step **steps
+)
+{
+  boot_profile_context *ctx = &boot_profile_instance;
+
+  *steps = ctx->steps;
+  return ctx->count;
+}
+
+void mk64f12_boot_profile_print(const rtems_printer *printer)
+{
+  boot_profile_context *ctx = &boot_profile_instance;
+  size_t i;
+
+  rtems_printf(
+    printer,
+    "boot profile: %zu steps, %zu lost, %" PRIu32 " ns until multitasking\n"
+    "    duration          end  step\n",
+    ctx->count,
+    ctx->lost,
+    ctx->sysinit_ns
+  );
+
+  for (i = 0; i < ctx->count; ++i) {
+    const mk64f12_boot_profile_step *step = &ctx->steps[i];
+
+    if (step->name != NULL) {
+      rtems_printf(
+        printer,
+        "%9" PRIu32 " ns %9" PRIu32 " ns  %s\n",
+        step->duration_ns,
+        step->end_ns,
+        step->name
+      );
+    } else {
+      rtems_printf(
+        printer,
+        "%9" PRIu32 " ns %9" PRIu32 " ns  %s %p\n",
+        step->duration_ns,
+        step->end_ns,
+        step->deferred ? "deferred" : "sysinit",
+        (void *) step->handler
+      );
+    }
+  }
+}
+
+#endif /* MK64F12_BOOT_PROFILE */
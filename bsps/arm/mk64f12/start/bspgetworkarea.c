@@ -0,0 +1,79 @@
+/*
+ * Copyright (c) 2026 Dave Rush.  All rights reserved.
+ *
+ * The license and distribution terms for this file may be
+ * found in the file LICENSE in this distribution or at
+ * http://www.rtems.org/license/LICENSE.
+ */
+
+#include <bsp.h>
+#include <bsp/bootcard.h>
+#include <bsp/linker-symbols.h>
+
+#ifdef MK64F12_MEMORY_REPORT
+#include <inttypes.h>
+#include <rtems/bspIo.h>
+#include <rtems/sysinit.h>
+#endif
+
+LINKER_SYMBOL(mk64f12_memory_sram_l_work_begin);
+LINKER_SYMBOL(mk64f12_memory_sram_l_work_end);
+
+/*
+ * The main work area is the rest of the SRAM_U and the upper part of the
+ * SRAM_L is the second one.  The SRAM_L and the SRAM_U are adjacent, however,
+ * the lower part of the SRAM_L holds the .fast_text and .fast_data sections
+ * and the lower part of the SRAM_U the .data and .bss sections.  So the free
+ * space is registered as two areas and the fast sections stay out of the
+ * heap.
+ */
+static Memory_Area _Memory_Areas[] = {
+  MEMORY_INITIALIZER(bsp_section_work_begin, bsp_section_work_end),
+  MEMORY_INITIALIZER(
+    mk64f12_memory_sram_l_work_begin,
+    mk64f12_memory_sram_l_work_end
+  )
+};
+
+static const Memory_Information _Memory_Information =
+  MEMORY_INFORMATION_INITIALIZER(_Memory_Areas);
+
+const Memory_Information *_Memory_Get(void)
+{
+  return &_Memory_Information;
+}
+
+#ifdef MK64F12_MEMORY_REPORT
+static void mk64f12_memory_report(void)
+{
+  size_t i;
+
+  printk(
+    "SRAM_L: fast text %" PRIuPTR " bytes, fast data %" PRIuPTR " bytes, "
+    "reserved %" PRIuPTR " bytes\n",
+    (uintptr_t) bsp_section_fast_text_size,
+    (uintptr_t) bsp_section_fast_data_size,
+    (uintptr_t) MK64F12_MEMORY_SRAM_L_FAST_SIZE
+  );
+
+  for (i = 0; i < RTEMS_ARRAY_SIZE(_Memory_Areas); ++i) {
+    const Memory_Area *area = &_Memory_Areas[i];
+
+    printk(
+      "work area %zu: [%p, %p) %" PRIuPTR " bytes, "
+      "%" PRIuPTR " bytes free\n",
+      i,
+      _Memory_Get_begin(area),
+      _Memory_Get_end(area),
+      _Memory_Get_size(area),
+      _Memory_Get_free_size(area)
+    );
+  }
+}
+
+RTEMS_SYSINIT_ITEM(
+  mk64f12_memory_report,
+  RTEMS_SYSINIT_MALLOC,
+  RTEMS_SYSINIT_ORDER_LAST
+);
+#endif
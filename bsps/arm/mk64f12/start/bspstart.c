@@ -10,10 +10,15 @@
 #include <bsp/irq.h>
 #include <bsp/bootcard.h>
 #include <bsp/irq-generic.h>
+#include <rtems/sysinit.h>
 #include <assert.h>
 #include <MK64F12.h>
 #include <bsp/mk64f12.h>
+#include <bsp/crc.h>
 #include <bsp/flashconfig.h>
+#include <bsp/fmc.h>
+#include <bsp/mmcau.h>
+#include <fsl/edma.h>
 __attribute__((used)) static const void *mkflash_cfg = &FlashConfig;
 
 void BOARD_InitBootPins(void);
@@ -40,6 +45,26 @@ void bsp_start(void)
 {
   BOARD_InitBootPins();
   BOARD_InitBootClocks();
+  mk64f12_fmc_initialize();
+  mk64f12_md_initialize();
   bsp_earlycon();
   bsp_interrupt_initialize();
 }
+
+/*
+ * The eDMA and the DMAMUX clocks are gated off after reset, enable them
+ * before the shared eDMA driver touches the registers.
+ */
+static void mk64f12_edma_init(void)
+{
+  CLOCK_EnableClock(kCLOCK_Dmamux0);
+  CLOCK_EnableClock(kCLOCK_Dma0);
+  fsl_edma_init();
+}
+
+RTEMS_SYSINIT_ITEM(mk64f12_edma_init, RTEMS_SYSINIT_DEVICE_DRIVERS,
+    RTEMS_SYSINIT_ORDER_FIRST);
+
+/* The CRC module uses an eDMA channel for large buffers */
+RTEMS_SYSINIT_ITEM(mk64f12_crc_initialize, RTEMS_SYSINIT_DEVICE_DRIVERS,
+    RTEMS_SYSINIT_ORDER_SECOND);
@@ -7,8 +7,18 @@
  */
 
 #include <bsp.h>
+#include <bsp/linker-symbols.h>
 #include <bsp/start.h>
 
+#ifdef MK64F12_BOOT_PROFILE
+#include <bsp/boot-profile.h>
+#include <rtems/score/armv7m.h>
+#endif
+
+LINKER_SYMBOL(mk64f12_section_fast_text_hot_begin)
+LINKER_SYMBOL(mk64f12_section_fast_text_hot_size)
+LINKER_SYMBOL(mk64f12_section_fast_text_hot_load_begin)
+
 /*
  * There is a very short window after power on to reconfigure or disable the
  * watchdog. This code is how the kinetis sdk does it.
@@ -21,12 +31,44 @@ void BSP_START_TEXT_SECTION bsp_start_hook_0(void)
     *((volatile unsigned short *)0x4005200E) = 0xD928;
     /* Now disable watchdog via STCTRLH register */
     *((volatile unsigned short *)0x40052000) = 0x01D2u;
+
+#ifdef MK64F12_BOOT_PROFILE
+  /* The boot profile counts the cycles from here on */
+  _ARMV7M_DWT_Enable_CYCCNT();
+  _ARMV7M_DWT->cyccnt = 0;
+#endif
 }
 
 void BSP_START_TEXT_SECTION bsp_start_hook_1(void)
 {
+#ifdef MK64F12_BOOT_PROFILE
+  uint32_t copy_begin;
+  uint32_t copy_end;
+
+  copy_begin = _ARMV7M_DWT->cyccnt;
+#endif
+
+  /*
+   * Copy .fast_text_hot section, the .fast_text section behind it is copied
+   * afterwards since the copy is done in words.
+   */
+  bsp_start_memcpy(
+    (int *) mk64f12_section_fast_text_hot_begin,
+    (const int *) mk64f12_section_fast_text_hot_load_begin,
+    (size_t) mk64f12_section_fast_text_hot_size
+  );
+
   bsp_start_copy_sections();
+
+#ifdef MK64F12_BOOT_PROFILE
+  copy_end = _ARMV7M_DWT->cyccnt;
+#endif
+
   bsp_start_clear_bss();
 
   /* At this point we can use objects outside the .start section */
+
+#ifdef MK64F12_BOOT_PROFILE
+  mk64f12_boot_profile_start(copy_begin, copy_end);
+#endif
 }
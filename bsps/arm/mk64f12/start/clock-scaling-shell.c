@@ -0,0 +1,94 @@
+/*
+ * Copyright (c) 2026 Dave Rush.  All rights reserved.
+ *
+ * The license and distribution terms for this file may be
+ * found in the file LICENSE in this distribution or at
+ * http://www.rtems.org/license/LICENSE.
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+
+#include <bsp.h>
+#include <bsp/clock-scaling.h>
+#include <bsp/mk64f12.h>
+
+static const char *const clock_shell_mode_names[MK64F12_CLOCK_MODE_COUNT] = {
+  [MK64F12_CLOCK_MODE_RUN_120MHZ] = "run120",
+  [MK64F12_CLOCK_MODE_RUN_60MHZ] = "run60",
+  [MK64F12_CLOCK_MODE_VLPR_4MHZ] = "vlpr"
+};
+
+static void clock_shell_report(void)
+{
+  mk64f12_clock_statistics stats;
+
+  mk64f12_clock_get_statistics(&stats);
+
+  printf(
+    "mode:          %s\n"
+    "core clock:    %" PRIu32 " Hz\n"
+    "bus clock:     %" PRIu32 " Hz\n"
+    "flash clock:   %" PRIu32 " Hz\n"
+    "switches:      %" PRIu32 "\n"
+    "failures:      %" PRIu32 "\n"
+    "last switch:   %" PRIu32 " ns (%" PRIu32 " ns interrupts disabled)\n"
+    "max switch:    %" PRIu32 " ns (%" PRIu32 " ns interrupts disabled)\n",
+    clock_shell_mode_names[mk64f12_clock_get_mode()],
+    CLOCK_GetCoreSysClkFreq(),
+    CLOCK_GetBusClkFreq(),
+    CLOCK_GetFlashClkFreq(),
+    stats.switches,
+    stats.failures,
+    stats.last_switch_ns,
+    stats.last_disabled_ns,
+    stats.max_switch_ns,
+    stats.max_disabled_ns
+  );
+}
+
+static int clock_shell_main(int argc, char **argv)
+{
+  rtems_status_code sc;
+  int mode;
+
+  if (argc == 1) {
+    clock_shell_report();
+    return 0;
+  }
+
+  if (argc != 2) {
+    fprintf(stderr, "usage: %s\n", mk64f12_clock_shell_command.usage);
+    return 1;
+  }
+
+  for (mode = 0; mode < MK64F12_CLOCK_MODE_COUNT; ++mode) {
+    if (strcmp(argv[1], clock_shell_mode_names[mode]) == 0) {
+      break;
+    }
+  }
+
+  if (mode == MK64F12_CLOCK_MODE_COUNT) {
+    fprintf(stderr, "%s: unknown mode: %s\n", argv[0], argv[1]);
+    return 1;
+  }
+
+  sc = mk64f12_clock_set_mode((mk64f12_clock_mode) mode);
+  if (sc != RTEMS_SUCCESSFUL) {
+    fprintf(stderr, "%s: %s\n", argv[0], rtems_status_text(sc));
+    return 1;
+  }
+
+  clock_shell_report();
+  return 0;
+}
+
+struct rtems_shell_cmd_tt mk64f12_clock_shell_command = {
+  .name     = "clkmode",
+  .usage   = "clkmode [run120|run60|vlpr]",
+  .topic   = "rtems",
+  .command = clock_shell_main,
+  .alias   = NULL,
+  .next    = NULL
+};
@@ -0,0 +1,300 @@
+/*
+ * Copyright (c) 2026 Dave Rush.  All rights reserved.
+ *
+ * The license and distribution terms for this file may be
+ * found in the file LICENSE in this distribution or at
+ * http://www.rtems.org/license/LICENSE.
+ */
+
+#include <bsp.h>
+#include <bsp/clock-armv7m.h>
+#include <bsp/clock-scaling.h>
+#include <bsp/fatal.h>
+#include <bsp/mk64f12.h>
+
+#include <rtems/score/sysstate.h>
+#include <rtems/thread.h>
+
+#include "fsl_smc.h"
+#include "clock_config.h"
+
+/* OUTDIV1: /2, OUTDIV2: /2, OUTDIV3: /3, OUTDIV4: /5 */
+#define CLOCK_SCALING_CLKDIV1_RUN_60MHZ 0x11240000U
+
+/* The mode transition takes a few microseconds at most */
+#define CLOCK_SCALING_SMC_MAX_POLLS 100000
+
+typedef struct {
+  rtems_mutex mutex;
+  rtems_chain_control listeners;
+  mk64f12_clock_mode mode;
+  mk64f12_clock_statistics stats;
+} clock_scaling_context;
+
+static clock_scaling_context clock_scaling_instance = {
+  .mutex = RTEMS_MUTEX_INITIALIZER("Clock Scaling"),
+  .listeners = RTEMS_CHAIN_INITIALIZER_EMPTY(
+    clock_scaling_instance.listeners
+  ),
+  .mode = MK64F12_CLOCK_MODE_RUN_120MHZ
+};
+
+static void clock_scaling_lock(clock_scaling_context *ctx)
+{
+  if (_System_state_Is_up(_System_state_Get())) {
+    rtems_mutex_lock(&ctx->mutex);
+  }
+}
+
+static void clock_scaling_unlock(clock_scaling_context *ctx)
+{
+  if (_System_state_Is_up(_System_state_Get())) {
+    rtems_mutex_unlock(&ctx->mutex);
+  }
+}
+
+static bool clock_scaling_set_run_mode(uint8_t runm, uint8_t state)
+{
+  int polls;
+
+  SMC->PMCTRL = (uint8_t) ((SMC->PMCTRL & ~SMC_PMCTRL_RUNM_MASK)
+    | SMC_PMCTRL_RUNM(runm));
+
+  for (polls = 0; polls < CLOCK_SCALING_SMC_MAX_POLLS; ++polls) {
+    if (SMC_GetPowerModeState(SMC) == state) {
+      return true;
+    }
+  }
+
+  return false;
+}
+
+static bool clock_scaling_enter_run(void)
+{
+  if (SMC_GetPowerModeState(SMC) == kSMC_PowerStateRun) {
+    return true;
+  }
+
+  return clock_scaling_set_run_mode(0, kSMC_PowerStateRun);
+}
+
+static bool clock_scaling_enter_vlpr(void)
+{
+  /*
+   * The power mode protection register is write once after reset.  If some
+   * other code denied the VLPR mode already, the transition times out.
+   */
+  SMC_SetPowerModeProtection(SMC, kSMC_AllowPowerModeAll);
+  return clock_scaling_set_run_mode(2, kSMC_PowerStateVlpr);
+}
+
+static bool clock_scaling_apply(mk64f12_clock_mode mode)
+{
+  sim_clock_config_t sim;
+
+  /* The MCG and the SIM dividers must not change in the VLPR mode */
+  if (!clock_scaling_enter_run()) {
+    return false;
+  }
+
+  if (mode == MK64F12_CLOCK_MODE_VLPR_4MHZ) {
+    CLOCK_SetSimSafeDivs();
+
+    if (CLOCK_SetMcgConfig(&mcgConfig_BOARD_BootClockVLPR) != kStatus_Success) {
+      return false;
+    }
+
+    CLOCK_SetSimConfig(&simConfig_BOARD_BootClockVLPR);
+    return clock_scaling_enter_vlpr();
+  }
+
+  if (CLOCK_GetMode() != kMCG_ModePEE) {
+    CLOCK_SetSimSafeDivs();
+
+    if (CLOCK_SetMcgConfig(&mcgConfig_BOARD_BootClockRUN) != kStatus_Success) {
+      return false;
+    }
+  }
+
+  sim = simConfig_BOARD_BootClockRUN;
+
+  if (mode == MK64F12_CLOCK_MODE_RUN_60MHZ) {
+    sim.clkdiv1 = CLOCK_SCALING_CLKDIV1_RUN_60MHZ;
+  }
+
+  CLOCK_SetSimConfig(&sim);
+  return true;
+}
+
+static void clock_scaling_notify_prepare(clock_scaling_context *ctx)
+{
+  rtems_chain_node *node;
+
+  for (
+    node = rtems_chain_first(&ctx->listeners);
+    !rtems_chain_is_tail(&ctx->listeners, node);
+    node = rtems_chain_next(node)
+  ) {
+    mk64f12_clock_listener *listener;
+
+    listener = RTEMS_CONTAINER_OF(node, mk64f12_clock_listener, node);
+
+    if (listener->prepare != NULL) {
+      (*listener->prepare)(listener);
+    }
+  }
+}
+
+static void clock_scaling_notify_update(clock_scaling_context *ctx)
+{
+  rtems_chain_node *node;
+
+  for (
+    node = rtems_chain_first(&ctx->listeners);
+    !rtems_chain_is_tail(&ctx->listeners, node);
+    node = rtems_chain_next(node)
+  ) {
+    mk64f12_clock_listener *listener;
+
+    listener = RTEMS_CONTAINER_OF(node, mk64f12_clock_listener, node);
+
+    if (listener->update != NULL) {
+      (*listener->update)(listener);
+    }
+  }
+}
+
+static void clock_scaling_notify_complete(clock_scaling_context *ctx)
+{
+  rtems_chain_node *node;
+
+  for (
+    node = rtems_chain_first(&ctx->listeners);
+    !rtems_chain_is_tail(&ctx->listeners, node);
+    node = rtems_chain_next(node)
+  ) {
+    mk64f12_clock_listener *listener;
+
+    listener = RTEMS_CONTAINER_OF(node, mk64f12_clock_listener, node);
+
+    if (listener->complete != NULL) {
+      (*listener->complete)(listener);
+    }
+  }
+}
+
+static void clock_scaling_account(uint32_t *last, uint32_t *max, uint64_t ns)
+{
+  uint32_t value;
+
+  value = ns > UINT32_MAX ? UINT32_MAX : (uint32_t) ns;
+  *last = value;
+
+  if (value > *max) {
+    *max = value;
+  }
+}
+
+void mk64f12_clock_add_listener(mk64f12_clock_listener *listener)
+{
+  clock_scaling_context *ctx = &clock_scaling_instance;
+
+  clock_scaling_lock(ctx);
+  rtems_chain_append_unprotected(&ctx->listeners, &listener->node);
+  clock_scaling_unlock(ctx);
+}
+
+void mk64f12_clock_remove_listener(mk64f12_clock_listener *listener)
+{
+  clock_scaling_context *ctx = &clock_scaling_instance;
+
+  clock_scaling_lock(ctx);
+  rtems_chain_extract_unprotected(&listener->node);
+  clock_scaling_unlock(ctx);
+}
+
+rtems_status_code mk64f12_clock_set_mode(mk64f12_clock_mode mode)
+{
+  clock_scaling_context *ctx = &clock_scaling_instance;
+  rtems_interrupt_level level;
+  rtems_status_code sc;
+  uint64_t begin;
+  uint64_t disabled_begin;
+  uint64_t disabled_end;
+  bool ok;
+
+  if ((unsigned int) mode >= MK64F12_CLOCK_MODE_COUNT) {
+    return RTEMS_INVALID_NUMBER;
+  }
+
+  if (rtems_interrupt_is_in_progress()) {
+    return RTEMS_CALLED_FROM_ISR;
+  }
+
+  if (!_System_state_Is_up(_System_state_Get())) {
+    return RTEMS_INCORRECT_STATE;
+  }
+
+  rtems_mutex_lock(&ctx->mutex);
+
+  if (mode == ctx->mode) {
+    rtems_mutex_unlock(&ctx->mutex);
+    return RTEMS_SUCCESSFUL;
+  }
+
+  begin = rtems_clock_get_uptime_nanoseconds();
+  clock_scaling_notify_prepare(ctx);
+
+  rtems_interrupt_local_disable(level);
+  disabled_begin = rtems_clock_get_uptime_nanoseconds();
+  ok = clock_scaling_apply(mode);
+
+  if (ok) {
+    ctx->mode = mode;
+  } else if (!clock_scaling_apply(ctx->mode)) {
+    bsp_fatal(MK64F12_FATAL_CLOCK_SCALING);
+  }
+
+  SystemCoreClock = CLOCK_GetCoreSysClkFreq();
+  _ARMV7M_Clock_frequency_changed();
+  clock_scaling_notify_update(ctx);
+  disabled_end = rtems_clock_get_uptime_nanoseconds();
+  rtems_interrupt_local_enable(level);
+
+  clock_scaling_notify_complete(ctx);
+
+  if (ok) {
+    ++ctx->stats.switches;
+    clock_scaling_account(
+      &ctx->stats.last_disabled_ns,
+      &ctx->stats.max_disabled_ns,
+      disabled_end - disabled_begin
+    );
+    clock_scaling_account(
+      &ctx->stats.last_switch_ns,
+      &ctx->stats.max_switch_ns,
+      rtems_clock_get_uptime_nanoseconds() - begin
+    );
+    sc = RTEMS_SUCCESSFUL;
+  } else {
+    ++ctx->stats.failures;
+    sc = RTEMS_IO_ERROR;
+  }
+
+  rtems_mutex_unlock(&ctx->mutex);
+  return sc;
+}
+
+mk64f12_clock_mode mk64f12_clock_get_mode(void)
+{
+  return clock_scaling_instance.mode;
+}
+
+void mk64f12_clock_get_statistics(mk64f12_clock_statistics *stats)
+{
+  clock_scaling_context *ctx = &clock_scaling_instance;
+
+  clock_scaling_lock(ctx);
+  *stats = ctx->stats;
+  clock_scaling_unlock(ctx);
+}
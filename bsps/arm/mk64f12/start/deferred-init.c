@@ -0,0 +1,53 @@
+/*
+ * Copyright (c) 2026 Dave Rush.  All rights reserved.
+ *
+ * The license and distribution terms for this file may be
+ * found in the file LICENSE in this distribution or at
+ * http://www.rtems.org/license/LICENSE.
+ */
+
+#include <bsp.h>
+#include <bsp/deferred-init.h>
+
+#ifdef MK64F12_BOOT_PROFILE
+#include <bsp/boot-profile.h>
+#include <rtems/score/armv7m.h>
+#endif
+
+#ifdef MK64F12_DEFERRED_INIT
+
+RTEMS_LINKER_ROSET(_Mk64f12_Deferred_init, rtems_sysinit_item);
+
+static volatile bool deferred_init_done;
+
+void mk64f12_deferred_init_run(void)
+{
+  const rtems_sysinit_item *item;
+
+  if (deferred_init_done) {
+    return;
+  }
+
+  RTEMS_LINKER_SET_FOREACH(_Mk64f12_Deferred_init, item) {
+#ifdef MK64F12_BOOT_PROFILE
+    uint32_t begin;
+
+    begin = _ARMV7M_DWT->cyccnt;
+#endif
+
+    (*item->handler)();
+
+#ifdef MK64F12_BOOT_PROFILE
+    mk64f12_boot_profile_record_deferred(item, _ARMV7M_DWT->cyccnt - begin);
+#endif
+  }
+
+  deferred_init_done = true;
+}
+
+bool mk64f12_deferred_init_is_done(void)
+{
+  return deferred_init_done;
+}
+
+#endif /* MK64F12_DEFERRED_INIT */
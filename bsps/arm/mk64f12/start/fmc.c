@@ -0,0 +1,148 @@
+/*
+ * Copyright (c) 2026 Dave Rush.  All rights reserved.
+ *
+ * The license and distribution terms for this file may be
+ * found in the file LICENSE in this distribution or at
+ * http://www.rtems.org/license/LICENSE.
+ */
+
+#include <bsp.h>
+#include <bsp/fmc.h>
+#include <bsp/linker-symbols.h>
+
+#include <MK64F12.h>
+
+/* The enable bits have the same positions in PFB0CR and PFB1CR */
+#define FMC_BANK_ENABLES \
+  (FMC_PFB0CR_B0SEBE_MASK | FMC_PFB0CR_B0IPE_MASK | FMC_PFB0CR_B0DPE_MASK \
+    | FMC_PFB0CR_B0ICE_MASK | FMC_PFB0CR_B0DCE_MASK)
+
+#define FMC_PFAPR_PFD_SHIFT FMC_PFAPR_M0PFD_SHIFT
+
+#define FMC_PFAPR_PFD_MASK (0xffU << FMC_PFAPR_PFD_SHIFT)
+
+static void fmc_get_bank(mk64f12_fmc_bank_config *bank, uint32_t pfbcr)
+{
+  bank->single_entry_buffer = (pfbcr & FMC_PFB0CR_B0SEBE_MASK) != 0;
+  bank->instruction_prefetch = (pfbcr & FMC_PFB0CR_B0IPE_MASK) != 0;
+  bank->data_prefetch = (pfbcr & FMC_PFB0CR_B0DPE_MASK) != 0;
+  bank->instruction_cache = (pfbcr & FMC_PFB0CR_B0ICE_MASK) != 0;
+  bank->data_cache = (pfbcr & FMC_PFB0CR_B0DCE_MASK) != 0;
+}
+
+static uint32_t fmc_set_bank(const mk64f12_fmc_bank_config *bank)
+{
+  uint32_t pfbcr;
+
+  pfbcr = 0;
+
+  if (bank->single_entry_buffer) {
+    pfbcr |= FMC_PFB0CR_B0SEBE_MASK;
+  }
+
+  if (bank->instruction_prefetch) {
+    pfbcr |= FMC_PFB0CR_B0IPE_MASK;
+  }
+
+  if (bank->data_prefetch) {
+    pfbcr |= FMC_PFB0CR_B0DPE_MASK;
+  }
+
+  if (bank->instruction_cache) {
+    pfbcr |= FMC_PFB0CR_B0ICE_MASK;
+  }
+
+  if (bank->data_cache) {
+    pfbcr |= FMC_PFB0CR_B0DCE_MASK;
+  }
+
+  return pfbcr;
+}
+
+void mk64f12_fmc_get_config(mk64f12_fmc_config *config)
+{
+  uint32_t pfb0cr;
+
+  pfb0cr = FMC->PFB0CR;
+  fmc_get_bank(&config->banks[0], pfb0cr);
+  fmc_get_bank(&config->banks[1], FMC->PFB1CR);
+  config->replacement = (mk64f12_fmc_cache_replacement)
+    ((pfb0cr & FMC_PFB0CR_CRC_MASK) >> FMC_PFB0CR_CRC_SHIFT);
+  config->locked_ways = (uint8_t)
+    ((pfb0cr & FMC_PFB0CR_CLCK_WAY_MASK) >> FMC_PFB0CR_CLCK_WAY_SHIFT);
+  config->prefetch_masters = (uint8_t)
+    ~((FMC->PFAPR & FMC_PFAPR_PFD_MASK) >> FMC_PFAPR_PFD_SHIFT);
+}
+
+/*
+ * Changing the speculation and cache configuration while instructions are
+ * fetched from the flash may return stale instructions, so the registers are
+ * written from RAM.
+ */
+BSP_FAST_TEXT_SECTION RTEMS_NO_INLINE static void fmc_write(
+  uint32_t pfapr,
+  uint32_t pfb0cr,
+  uint32_t pfb1cr
+)
+{
+  _ARM_Data_synchronization_barrier();
+  FMC->PFAPR = pfapr;
+  FMC->PFB1CR = pfb1cr;
+  FMC->PFB0CR = pfb0cr;
+  _ARM_Data_synchronization_barrier();
+  _ARM_Instruction_synchronization_barrier();
+}
+
+void mk64f12_fmc_set_config(const mk64f12_fmc_config *config)
+{
+  uint32_t pfapr;
+  uint32_t pfb0cr;
+  uint32_t pfb1cr;
+  rtems_interrupt_level level;
+
+  rtems_interrupt_disable(level);
+
+  pfapr = FMC->PFAPR & ~FMC_PFAPR_PFD_MASK;
+  pfapr |= ((uint32_t) (uint8_t) ~config->prefetch_masters)
+    << FMC_PFAPR_PFD_SHIFT;
+
+  pfb0cr = FMC->PFB0CR & ~(FMC_BANK_ENABLES | FMC_PFB0CR_CRC_MASK
+    | FMC_PFB0CR_CLCK_WAY_MASK);
+  pfb0cr |= fmc_set_bank(&config->banks[0])
+    | FMC_PFB0CR_CRC(config->replacement)
+    | FMC_PFB0CR_CLCK_WAY(config->locked_ways)
+    | FMC_PFB0CR_S_B_INV_MASK
+    | FMC_PFB0CR_CINV_WAY(~config->locked_ways);
+
+  pfb1cr = FMC->PFB1CR & ~FMC_BANK_ENABLES;
+  pfb1cr |= fmc_set_bank(&config->banks[1]);
+
+  fmc_write(pfapr, pfb0cr, pfb1cr);
+
+  rtems_interrupt_enable(level);
+}
+
+void mk64f12_fmc_invalidate(void)
+{
+  uint32_t pfb0cr;
+  uint32_t locked_ways;
+  rtems_interrupt_level level;
+
+  rtems_interrupt_disable(level);
+  pfb0cr = FMC->PFB0CR;
+  locked_ways = (pfb0cr & FMC_PFB0CR_CLCK_WAY_MASK)
+    >> FMC_PFB0CR_CLCK_WAY_SHIFT;
+  FMC->PFB0CR = pfb0cr | FMC_PFB0CR_S_B_INV_MASK
+    | FMC_PFB0CR_CINV_WAY(~locked_ways);
+  rtems_interrupt_enable(level);
+}
+
+void mk64f12_fmc_initialize(void)
+{
+  mk64f12_fmc_config config;
+
+  mk64f12_fmc_get_config(&config);
+  config.replacement = MK64F12_FMC_CACHE_REPLACEMENT;
+  config.prefetch_masters = MK64F12_FMC_PREFETCH_MASTERS;
+  mk64f12_fmc_set_config(&config);
+}
@@ -1,24 +1,289 @@
+/*
+ * Copyright (c) 2026 Dave Rush.  All rights reserved.
+ *
+ * The license and distribution terms for this file may be
+ * found in the file LICENSE in this distribution or at
+ * http://www.rtems.org/license/LICENSE.
+ */
+
 #include <bsp.h>
+#include <bsp/deferred-init.h>
+#include <bsp/fatal.h>
 #include <bsp/mk64f12.h>
+#include <bsp/rng.h>
 #include <rtems.h>
+#include <rtems/score/sysstate.h>
 #include <rtems/sysinit.h>
+#include <rtems/thread.h>
 
 #include <sys/param.h>
+#include <errno.h>
 #include <unistd.h>
 #include <string.h>
 
-static void mk64f12_rng_enable(void)
+#define RNG_KEY_WORDS 8
+
+#define RNG_BLOCK_WORDS 16
+
+#define RNG_BLOCK_COUNT 8
+
+#define RNG_POOL_SIZE (RNG_BLOCK_COUNT * RNG_BLOCK_WORDS * 4)
+
+/* The first block of each refill provides the next key */
+#define RNG_OUTPUT_SIZE (RNG_POOL_SIZE - RNG_KEY_WORDS * 4)
+
+/* Give up on an RNGA which fails the health check persistently */
+#define RNG_SEED_MAX_FAILURES 64
+
+#define RNG_ROTL(v, n) (((v) << (n)) | ((v) >> (32 - (n))))
+
+#define RNG_QUARTER_ROUND(x, a, b, c, d) \
+  do { \
+    x[a] += x[b]; x[d] ^= x[a]; x[d] = RNG_ROTL(x[d], 16); \
+    x[c] += x[d]; x[b] ^= x[c]; x[b] = RNG_ROTL(x[b], 12); \
+    x[a] += x[b]; x[d] ^= x[a]; x[d] = RNG_ROTL(x[d], 8); \
+    x[c] += x[d]; x[b] ^= x[c]; x[b] = RNG_ROTL(x[b], 7); \
+  } while (0)
+
+typedef struct {
+  rtems_mutex mutex;
+  bool seeded;
+  uint32_t key[RNG_KEY_WORDS];
+  uint32_t pool[RNG_BLOCK_COUNT * RNG_BLOCK_WORDS];
+  size_t available;
+  uint32_t harvest[RNG_KEY_WORDS];
+  size_t harvested;
+  uint32_t since_reseed;
+  uint32_t last_word;
+  mk64f12_rng_statistics stats;
+} rng_context;
+
+static rng_context rng_instance = {
+  .mutex = RTEMS_MUTEX_INITIALIZER("RNG")
+};
+
+static void rng_chacha20_block(const uint32_t in[16], uint32_t out[16])
+{
+  uint32_t x[16];
+  int i;
+
+  memcpy(x, in, sizeof(x));
+
+  for (i = 0; i < 10; ++i) {
+    RNG_QUARTER_ROUND(x, 0, 4, 8, 12);
+    RNG_QUARTER_ROUND(x, 1, 5, 9, 13);
+    RNG_QUARTER_ROUND(x, 2, 6, 10, 14);
+    RNG_QUARTER_ROUND(x, 3, 7, 11, 15);
+    RNG_QUARTER_ROUND(x, 0, 5, 10, 15);
+    RNG_QUARTER_ROUND(x, 1, 6, 11, 12);
+    RNG_QUARTER_ROUND(x, 2, 7, 8, 13);
+    RNG_QUARTER_ROUND(x, 3, 4, 9, 14);
+  }
+
+  for (i = 0; i < 16; ++i) {
+    out[i] = x[i] + in[i];
+  }
+}
+
+static void rng_refill(rng_context *ctx)
+{
+  uint32_t in[16];
+  int i;
+
+  /* "expand 32-byte k", the nonce is zero since each refill has a new key */
+  in[0] = 0x61707865;
+  in[1] = 0x3320646e;
+  in[2] = 0x79622d32;
+  in[3] = 0x6b206574;
+  memcpy(&in[4], ctx->key, sizeof(ctx->key));
+  in[13] = 0;
+  in[14] = 0;
+  in[15] = 0;
+
+  for (i = 0; i < RNG_BLOCK_COUNT; ++i) {
+    in[12] = (uint32_t) i;
+    rng_chacha20_block(in, &ctx->pool[i * RNG_BLOCK_WORDS]);
+  }
+
+  memcpy(ctx->key, ctx->pool, sizeof(ctx->key));
+  memset(ctx->pool, 0, sizeof(ctx->key));
+  memset(in, 0, sizeof(in));
+  ctx->available = RNG_OUTPUT_SIZE;
+  ++ctx->stats.refills;
+}
+
+static bool rng_read_rnga(rng_context *ctx, uint32_t *word)
+{
+  uint32_t sr;
+  uint32_t value;
+
+  sr = RNG->SR;
+
+  if ((sr & RNG_SR_OREG_LVL_MASK) == 0) {
+    return false;
+  }
+
+  value = RNG->OR;
+
+  if (
+    (sr & (RNG_SR_SECV_MASK | RNG_SR_ERRI_MASK)) != 0
+      || value == ctx->last_word
+  ) {
+    RNG->CR |= RNG_CR_CLRI_MASK;
+    ctx->last_word = value;
+    ++ctx->stats.health_failures;
+    return false;
+  }
+
+  ctx->last_word = value;
+  ++ctx->stats.rnga_words;
+  *word = value;
+  return true;
+}
+
+static void rng_harvest(rng_context *ctx)
+{
+  uint32_t word;
+
+  if (ctx->harvested < RNG_KEY_WORDS && rng_read_rnga(ctx, &word)) {
+    ctx->harvest[ctx->harvested] = word;
+    ++ctx->harvested;
+  }
+}
+
+static void rng_mix_harvest(rng_context *ctx)
 {
+  size_t i;
+
+  for (i = 0; i < RNG_KEY_WORDS; ++i) {
+    ctx->key[i] ^= ctx->harvest[i];
+  }
+
+  memset(ctx->harvest, 0, sizeof(ctx->harvest));
+  ctx->harvested = 0;
+  ctx->since_reseed = 0;
+}
+
+static void rng_seed(rng_context *ctx)
+{
+  uint32_t failures;
+
   RNGA_Init(RNG);
+  RNG->CR |= RNG_CR_HA_MASK | RNG_CR_INTM_MASK;
+
+  /* The RNGA needs some time to produce a word, so wait here once */
+  failures = ctx->stats.health_failures;
+
+  while (ctx->harvested < RNG_KEY_WORDS) {
+    rng_harvest(ctx);
+
+    if (ctx->stats.health_failures - failures > RNG_SEED_MAX_FAILURES) {
+      bsp_fatal(MK64F12_FATAL_RNG_HEALTH);
+    }
+  }
+
+  rng_mix_harvest(ctx);
+  rng_refill(ctx);
+  ctx->seeded = true;
+}
+
+static void rng_lock(rng_context *ctx)
+{
+  if (_System_state_Is_up(_System_state_Get())) {
+    rtems_mutex_lock(&ctx->mutex);
+  }
+}
+
+static void rng_unlock(rng_context *ctx)
+{
+  if (_System_state_Is_up(_System_state_Get())) {
+    rtems_mutex_unlock(&ctx->mutex);
+  }
 }
 
 int getentropy(void *ptr, size_t n)
 {
-  RNGA_GetRandomData(RNG, ptr, n);
+  rng_context *ctx = &rng_instance;
+  uint8_t *out = ptr;
+
+  /* The pool is protected by a mutex, which cannot be obtained here */
+  if (rtems_interrupt_is_in_progress()) {
+    errno = EIO;
+    return -1;
+  }
+
+  rng_lock(ctx);
+
+  if (!ctx->seeded) {
+    rng_seed(ctx);
+  }
+
+  rng_harvest(ctx);
+  ctx->stats.bytes += n;
+
+  while (n > 0) {
+    uint8_t *src;
+    size_t chunk;
+
+    if (ctx->available == 0) {
+      if (
+        ctx->since_reseed >= MK64F12_RNG_RESEED_INTERVAL
+          && ctx->harvested == RNG_KEY_WORDS
+      ) {
+        rng_mix_harvest(ctx);
+        ++ctx->stats.reseeds;
+      }
+
+      rng_refill(ctx);
+    }
+
+    chunk = MIN(n, ctx->available);
+    src = (uint8_t *) ctx->pool + RNG_POOL_SIZE - ctx->available;
+    memcpy(out, src, chunk);
+    memset(src, 0, chunk);
+    ctx->available -= chunk;
+    ctx->since_reseed += chunk;
+    out += chunk;
+    n -= chunk;
+  }
+
+  rng_unlock(ctx);
   return 0;
 }
 
-RTEMS_SYSINIT_ITEM(
+void mk64f12_rng_get_statistics(mk64f12_rng_statistics *stats)
+{
+  rng_context *ctx = &rng_instance;
+
+  rng_lock(ctx);
+  *stats = ctx->stats;
+  rng_unlock(ctx);
+}
+
+static void mk64f12_rng_enable(void)
+{
+  rng_context *ctx = &rng_instance;
+
+  /*
+   * As a deferred handler this runs in the idle thread, which must not block.
+   * If the mutex is owned, then getentropy() is in use and seeds on demand.
+   */
+  if (
+    _System_state_Is_up(_System_state_Get())
+      && rtems_mutex_try_lock(&ctx->mutex) != 0
+  ) {
+    return;
+  }
+
+  if (!ctx->seeded) {
+    rng_seed(ctx);
+  }
+
+  rng_unlock(ctx);
+}
+
+/* The getentropy() seeds on demand, so the seed may be deferred */
+MK64F12_DEFERRED_INIT_ITEM(
   mk64f12_rng_enable,
   RTEMS_SYSINIT_DEVICE_DRIVERS,
   RTEMS_SYSINIT_ORDER_LAST_BUT_5
@@ -60,6 +60,10 @@ BOARD_InitPins:
   - {pin_num: '47', peripheral: ENET, signal: RMII_TXD1, pin_signal: ADC1_SE17/PTA17/SPI0_SIN/UART0_RTS_b/RMII0_TXD1/MII0_TXD1/I2S0_MCLK}
   - {pin_num: '46', peripheral: ENET, signal: RMII_TXD0, pin_signal: PTA16/SPI0_SOUT/UART0_CTS_b/UART0_COL_b/RMII0_TXD0/MII0_TXD0/I2S0_RX_FS/I2S0_RXD1}
   - {pin_num: '39', peripheral: ENET, signal: RMII_RXER, pin_signal: PTA5/USB_CLKIN/FTM0_CH2/RMII0_RXER/MII0_RXER/CMP2_OUT/I2S0_TX_BCLK/JTAG_TRST_b}
+  - {pin_num: '93', peripheral: SPI0, signal: PCS0_SS, pin_signal: PTD0/LLWU_P12/SPI0_PCS0/UART2_RTS_b/FTM3_CH0/FB_ALE/FB_CS1_b/FB_TS_b}
+  - {pin_num: '94', peripheral: SPI0, signal: SCK, pin_signal: ADC0_SE5b/PTD1/SPI0_SCK/UART2_CTS_b/FTM3_CH1/FB_CS0_b}
+  - {pin_num: '95', peripheral: SPI0, signal: SOUT, pin_signal: PTD2/LLWU_P13/SPI0_SOUT/UART2_RX/FTM3_CH2/FB_AD4/I2C0_SCL}
+  - {pin_num: '96', peripheral: SPI0, signal: SIN, pin_signal: PTD3/SPI0_SIN/UART2_TX/FTM3_CH3/FB_AD3/I2C0_SDA}
  * BE CAREFUL MODIFYING THIS COMMENT - IT IS YAML SETTINGS FOR TOOLS ***********
  */
 /* clang-format on */
@@ -78,6 +82,8 @@ void BOARD_InitPins(void)
     CLOCK_EnableClock(kCLOCK_PortB);
     /* Port C Clock Gate Control: Clock enabled */
     CLOCK_EnableClock(kCLOCK_PortC);
+    /* Port D Clock Gate Control: Clock enabled */
+    CLOCK_EnableClock(kCLOCK_PortD);
 
     /* PORTA12 (pin 42) is configured as RMII0_RXD1 */
     PORT_SetPinMux(PORTA, 12U, kPORT_MuxAlt4);
@@ -135,6 +141,18 @@ void BOARD_InitPins(void)
     /* PORTC18 (pin 92) is configured as ENET0_1588_TMR2 */
     PORT_SetPinMux(PORTC, 18U, kPORT_MuxAlt4);
 
+    /* PORTD0 (pin 93) is configured as SPI0_PCS0 */
+    PORT_SetPinMux(PORTD, 0U, kPORT_MuxAlt2);
+
+    /* PORTD1 (pin 94) is configured as SPI0_SCK */
+    PORT_SetPinMux(PORTD, 1U, kPORT_MuxAlt2);
+
+    /* PORTD2 (pin 95) is configured as SPI0_SOUT */
+    PORT_SetPinMux(PORTD, 2U, kPORT_MuxAlt2);
+
+    /* PORTD3 (pin 96) is configured as SPI0_SIN */
+    PORT_SetPinMux(PORTD, 3U, kPORT_MuxAlt2);
+
     SIM->SOPT5 = ((SIM->SOPT5 &
                    /* Mask bits to zero which are setting */
                    (~(SIM_SOPT5_UART0TXSRC_MASK)))
@@ -31,6 +31,12 @@
 #include <rtems.h>
 #include <rtems/sysinit.h>
 
+#ifdef BSP_ARMV7M_SYSTICK_TICKLESS_IDLE
+#include <rtems/score/percpu.h>
+#include <rtems/score/timecounter.h>
+#include <rtems/score/watchdogimpl.h>
+#endif
+
 #ifdef ARM_MULTILIB_ARCH_V7M
 
 /* This is defined in dev/clock/clockimpl.h */
@@ -38,6 +44,25 @@ static void Clock_isr(void *arg);
 
 ARMV7M_Timecounter _ARMV7M_TC;
 
+#ifdef BSP_ARMV7M_SYSTICK_TICKLESS_IDLE
+typedef struct {
+  uint32_t interval;
+  uint32_t last_tick;
+  ARMV7M_Clock_tickless_statistics stats;
+} ARMV7M_Clock_tickless_control;
+
+static ARMV7M_Clock_tickless_control _ARMV7M_Clock_tickless;
+
+#ifndef BSP_ARMV7M_WAIT_FOR_INTERRUPT
+#define BSP_ARMV7M_WAIT_FOR_INTERRUPT() __asm__ volatile ("wfi")
+#endif
+
+/* The BSP may do some work in the idle thread with interrupts enabled */
+#ifndef BSP_ARMV7M_IDLE_WORK
+#define BSP_ARMV7M_IDLE_WORK() do { } while (0)
+#endif
+#endif
+
 static uint32_t _ARMV7M_TC_get_timecount(struct timecounter *base)
 {
   return _ARMV7M_Clock_counter((ARMV7M_Timecounter *) base);
@@ -66,6 +91,12 @@ static void _ARMV7M_Clock_initialize(void)
   systick = _ARMV7M_Systick;
   tc = &_ARMV7M_TC;
 
+#ifdef BSP_ARMV7M_SYSTICK_TICKLESS_IDLE
+  (void) _ARMV7M_Clock_counter(tc);
+  _ARMV7M_Clock_tickless.interval = systick->rvr;
+  _ARMV7M_Clock_tickless.last_tick = tc->ticks;
+#endif
+
   systick->csr = ARMV7M_SYSTICK_CSR_ENABLE
     | ARMV7M_SYSTICK_CSR_TICKINT
     | ARMV7M_SYSTICK_CSR_CLKSOURCE;
@@ -77,20 +108,23 @@ static void _ARMV7M_Clock_initialize(void)
   rtems_timecounter_install(&tc->base);
 }
 
-static void _ARMV7M_Clock_initialize_early(void)
+static uint32_t _ARMV7M_Clock_interval(void)
 {
-  volatile ARMV7M_Systick *systick;
   uint32_t us_per_tick;
   uint64_t freq;
-  uint32_t interval;
 
-  systick = _ARMV7M_Systick;
   us_per_tick = rtems_configuration_get_microseconds_per_tick();
   freq = _ARMV7M_Clock_frequency();
 
-  interval = (uint32_t) ((freq * us_per_tick) / 1000000);
+  return (uint32_t) ((freq * us_per_tick) / 1000000);
+}
 
-  systick->rvr = interval;
+static void _ARMV7M_Clock_initialize_early(void)
+{
+  volatile ARMV7M_Systick *systick;
+
+  systick = _ARMV7M_Systick;
+  systick->rvr = _ARMV7M_Clock_interval();
   systick->cvr = 0;
   systick->csr = ARMV7M_SYSTICK_CSR_ENABLE | ARMV7M_SYSTICK_CSR_CLKSOURCE;
 }
@@ -101,6 +135,289 @@ RTEMS_SYSINIT_ITEM(
   RTEMS_SYSINIT_ORDER_FIRST
 );
 
+void _ARMV7M_Clock_frequency_changed(void)
+{
+  volatile ARMV7M_Systick *systick;
+  ARMV7M_Timecounter *tc;
+  uint32_t interval;
+  uint32_t now;
+  uint32_t cvr;
+
+  systick = _ARMV7M_Systick;
+  tc = &_ARMV7M_TC;
+  interval = _ARMV7M_Clock_interval();
+
+  /*
+   * Stop the SysTick, so that the timecounter value and the current value
+   * are consistent.  Writing the control register does not clear the
+   * COUNTFLAG.
+   */
+  systick->csr = ARMV7M_SYSTICK_CSR_TICKINT | ARMV7M_SYSTICK_CSR_CLKSOURCE;
+  now = _ARMV7M_Clock_counter(tc);
+  cvr = systick->cvr;
+  systick->rvr = interval;
+
+  /*
+   * The current period ends with the reload of the new interval.  Keep its
+   * phase if it fits into the new interval, otherwise start a new period.
+   * The timecounter value stays the same in both cases.
+   */
+  if (cvr > interval) {
+    systick->cvr = 0;
+    tc->ticks = now;
+  } else {
+    tc->ticks = now - interval + cvr;
+  }
+
+#ifdef BSP_ARMV7M_SYSTICK_TICKLESS_IDLE
+  _ARMV7M_Clock_tickless.interval = interval;
+  _ARMV7M_Clock_tickless.last_tick = tc->ticks;
+#endif
+
+  systick->csr = ARMV7M_SYSTICK_CSR_ENABLE
+    | ARMV7M_SYSTICK_CSR_TICKINT
+    | ARMV7M_SYSTICK_CSR_CLKSOURCE;
+
+  rtems_timecounter_set_frequency(&tc->base, _ARMV7M_Clock_frequency());
+}
+
+#ifdef BSP_ARMV7M_SYSTICK_TICKLESS_IDLE
+/*
+ * Processes all clock ticks elapsed since the last processed clock tick.  The
+ * timecounter value of a clock tick boundary is a multiple of the SysTick
+ * interval, so the count of elapsed clock ticks follows from the timecounter.
+ * This makes the processing independent of the count of SysTick interrupts.
+ */
+static void _ARMV7M_Clock_tickless_tick(void)
+{
+  ARMV7M_Clock_tickless_control *ctl;
+  Per_CPU_Control *cpu_self;
+  uint32_t now;
+  uint32_t ticks;
+
+  ctl = &_ARMV7M_Clock_tickless;
+  now = _ARMV7M_Clock_counter(&_ARMV7M_TC);
+  ticks = 0;
+
+  while (now - ctl->last_tick >= ctl->interval) {
+    ctl->last_tick += ctl->interval;
+    ++ticks;
+  }
+
+  if (ticks == 0) {
+    return;
+  }
+
+  rtems_timecounter_tick();
+  cpu_self = _Per_CPU_Get();
+
+  while (ticks > 1) {
+    _Watchdog_Tick(cpu_self);
+    --ticks;
+  }
+}
+
+static uint32_t _ARMV7M_Clock_clamp_ns(
+  uint32_t ticks,
+  const Watchdog_Header *header,
+  const struct timespec *now
+)
+{
+  uint64_t remaining;
+  uint64_t delta;
+
+  if (!_Watchdog_Comparator_remaining(header, now, &remaining)) {
+    return ticks;
+  }
+
+  delta = remaining
+    / ((uint64_t) rtems_configuration_get_microseconds_per_tick() * 1000);
+
+  return delta < ticks ? (uint32_t) delta : ticks;
+}
+
+/*
+ * Returns the count of clock ticks until the next watchdog expiration of the
+ * processor limited to the specified maximum.  The caller disabled interrupts,
+ * this is sufficient to access the watchdog headers on a uniprocessor.
+ */
+static uint32_t _ARMV7M_Clock_idle_ticks(
+  Per_CPU_Control *cpu,
+  uint32_t ticks
+)
+{
+  uint64_t expire;
+  struct timespec now;
+
+  /*
+   * For a timing wheel this is the time of the next cascade or expiration, so
+   * the processor may wake up early for a cascade.
+   */
+  if (
+    _Watchdog_Header_next_expire(
+      &cpu->Watchdog.Header[PER_CPU_WATCHDOG_TICKS],
+      &expire
+    )
+  ) {
+    if (expire <= cpu->Watchdog.ticks) {
+      return 0;
+    }
+
+    if (expire - cpu->Watchdog.ticks < ticks) {
+      ticks = (uint32_t) (expire - cpu->Watchdog.ticks);
+    }
+  }
+
+  _Timecounter_Getnanouptime(&now);
+  ticks = _ARMV7M_Clock_clamp_ns(
+    ticks,
+    &cpu->Watchdog.Header[PER_CPU_WATCHDOG_MONOTONIC],
+    &now
+  );
+
+  _Timecounter_Getnanotime(&now);
+  ticks = _ARMV7M_Clock_clamp_ns(
+    ticks,
+    &cpu->Watchdog.Header[PER_CPU_WATCHDOG_REALTIME],
+    &now
+  );
+
+  return ticks;
+}
+
+/*
+ * Reads the SysTick current value after a sleep with a disabled clock tick
+ * interrupt.  The COUNTFLAG was set by the wrap arounds during the sleep, so
+ * clear it first.  If it is set again, then the value read before may be from
+ * the period before the wrap around.
+ */
+static uint32_t _ARMV7M_Clock_read_after_sleep(
+  volatile ARMV7M_Systick *systick
+)
+{
+  uint32_t cvr;
+
+  (void) systick->csr;
+  cvr = systick->cvr;
+
+  if ((systick->csr & ARMV7M_SYSTICK_CSR_COUNTFLAG) != 0) {
+    cvr = systick->cvr;
+  }
+
+  return cvr;
+}
+
+static void _ARMV7M_Clock_tickless_idle(Per_CPU_Control *cpu_self)
+{
+  ARMV7M_Clock_tickless_control *ctl;
+  volatile ARMV7M_Systick *systick;
+  volatile ARMV7M_SCB *scb;
+  ARMV7M_Timecounter *tc;
+  uint32_t interval;
+  uint32_t ticks;
+  uint32_t before;
+  uint32_t phase;
+  uint32_t ticks_before;
+  uint32_t wraps;
+  int64_t delta;
+
+  ctl = &_ARMV7M_Clock_tickless;
+  systick = _ARMV7M_Systick;
+  scb = _ARMV7M_SCB;
+  tc = &_ARMV7M_TC;
+  interval = ctl->interval;
+
+  /* Limit the sleep time so that the 32-bit timecounter cannot overflow */
+  ticks = _ARMV7M_Clock_idle_ticks(cpu_self, 0x80000000U / interval);
+
+  if (ticks < 2) {
+    BSP_ARMV7M_WAIT_FOR_INTERRUPT();
+    return;
+  }
+
+  systick->csr = ARMV7M_SYSTICK_CSR_ENABLE | ARMV7M_SYSTICK_CSR_CLKSOURCE;
+  before = _ARMV7M_Clock_counter(tc);
+  phase = before - ctl->last_tick;
+
+  if (
+    (scb->icsr & ARMV7M_SCB_ICSR_PENDSTSET) != 0
+      || phase >= interval
+  ) {
+    /* A clock tick is due, let the clock interrupt process it */
+    systick->csr = ARMV7M_SYSTICK_CSR_ENABLE
+      | ARMV7M_SYSTICK_CSR_TICKINT
+      | ARMV7M_SYSTICK_CSR_CLKSOURCE;
+    scb->icsr = ARMV7M_SCB_ICSR_PENDSTSET;
+    return;
+  }
+
+  ticks_before = tc->ticks;
+  _ARMV7M_Clock_tickless_timer_start((uint64_t) ticks * interval - phase);
+
+  BSP_ARMV7M_WAIT_FOR_INTERRUPT();
+
+  /*
+   * The wake up timer provides the elapsed time accurate enough to determine
+   * the count of SysTick wrap arounds during the sleep.  The SysTick itself
+   * provides the exact value within the current period.
+   */
+  delta = (int64_t) _ARMV7M_Clock_tickless_timer_stop()
+    - (int64_t) (interval - _ARMV7M_Clock_read_after_sleep(systick))
+    + (int64_t) (before - ticks_before);
+
+  if (delta > 0) {
+    wraps = (uint32_t) (((uint64_t) delta + interval / 2) / interval);
+  } else {
+    wraps = 0;
+  }
+
+  tc->ticks = ticks_before + wraps * interval;
+  systick->csr = ARMV7M_SYSTICK_CSR_ENABLE
+    | ARMV7M_SYSTICK_CSR_TICKINT
+    | ARMV7M_SYSTICK_CSR_CLKSOURCE;
+
+  ++ctl->stats.idle_periods;
+  ctl->stats.suppressed_ticks += wraps;
+
+  if (_ARMV7M_Clock_counter(tc) - ctl->last_tick >= interval) {
+    scb->icsr = ARMV7M_SCB_ICSR_PENDSTSET;
+  }
+}
+
+void *_ARMV7M_Clock_tickless_idle_body(uintptr_t ignored)
+{
+  (void) ignored;
+
+  while (true) {
+    BSP_ARMV7M_IDLE_WORK();
+
+    /*
+     * The WFI wakes up only for an exception with a higher priority than the
+     * current execution priority.  The BASEPRI set by
+     * rtems_interrupt_local_disable() counts for this priority, the PRIMASK
+     * does not.  So mask the interrupts with the PRIMASK, a pending interrupt
+     * wakes up the processor and is serviced after the PRIMASK is cleared.
+     */
+    _ARMV7M_Set_primask(1);
+    _ARMV7M_Clock_tickless_idle(_Per_CPU_Get());
+    _ARMV7M_Set_primask(0);
+  }
+}
+
+void _ARMV7M_Clock_get_tickless_statistics(
+  ARMV7M_Clock_tickless_statistics *stats
+)
+{
+  rtems_interrupt_level level;
+
+  rtems_interrupt_local_disable(level);
+  *stats = _ARMV7M_Clock_tickless.stats;
+  rtems_interrupt_local_enable(level);
+}
+
+#define Clock_driver_timecounter_tick() _ARMV7M_Clock_tickless_tick()
+#endif
+
 #define Clock_driver_support_initialize_hardware() \
   _ARMV7M_Clock_initialize()
 
@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) 2026 Dave Rush.  All rights reserved.
+ *
+ * The license and distribution terms for this file may be
+ * found in the file LICENSE in this distribution or at
+ * http://www.rtems.org/license/LICENSE.
+ */
+
+#include <rtems/score/armv7m.h>
+
+#include <bsp.h>
+#include <bsp/irq-generic.h>
+#include <bsp/armv7m-irq.h>
+
+#ifdef ARM_MULTILIB_ARCH_V7M
+
+static rtems_status_code armv7m_interrupt_direct_check_and_lock(
+  rtems_vector_number vector
+)
+{
+  if (!bsp_interrupt_is_initialized()) {
+    return RTEMS_INCORRECT_STATE;
+  }
+
+  if (!bsp_interrupt_is_valid_vector(vector)) {
+    return RTEMS_INVALID_ID;
+  }
+
+  if (rtems_interrupt_is_in_progress()) {
+    return RTEMS_CALLED_FROM_ISR;
+  }
+
+  bsp_interrupt_lock();
+
+  return RTEMS_SUCCESSFUL;
+}
+
+static bool armv7m_interrupt_direct_is_installed(rtems_vector_number vector)
+{
+  return _ARMV7M_Get_exception_handler(ARMV7M_VECTOR_IRQ((int) vector))
+    != _ARMV7M_NVIC_Interrupt_dispatch;
+}
+
+rtems_status_code armv7m_interrupt_direct_install(
+  rtems_vector_number vector,
+  uint8_t priority,
+  ARMV7M_Exception_handler handler
+)
+{
+  rtems_status_code sc;
+
+  if (handler == NULL) {
+    return RTEMS_INVALID_ADDRESS;
+  }
+
+  sc = armv7m_interrupt_direct_check_and_lock(vector);
+  if (sc != RTEMS_SUCCESSFUL) {
+    return sc;
+  }
+
+  if (
+    armv7m_interrupt_direct_is_installed(vector)
+      || bsp_interrupt_entry_load_first(vector) != NULL
+  ) {
+    bsp_interrupt_unlock();
+    return RTEMS_RESOURCE_IN_USE;
+  }
+
+  /* The vector is disabled while the handler and the priority change */
+  _ARMV7M_NVIC_Clear_enable((int) vector);
+  _ARMV7M_NVIC_Set_priority((int) vector, priority);
+  _ARMV7M_Set_exception_handler(ARMV7M_VECTOR_IRQ((int) vector), handler);
+  _ARM_Data_synchronization_barrier();
+  _ARMV7M_NVIC_Set_enable((int) vector);
+
+  bsp_interrupt_unlock();
+  return RTEMS_SUCCESSFUL;
+}
+
+rtems_status_code armv7m_interrupt_direct_remove(rtems_vector_number vector)
+{
+  rtems_status_code sc;
+
+  sc = armv7m_interrupt_direct_check_and_lock(vector);
+  if (sc != RTEMS_SUCCESSFUL) {
+    return sc;
+  }
+
+  if (!armv7m_interrupt_direct_is_installed(vector)) {
+    bsp_interrupt_unlock();
+    return RTEMS_UNSATISFIED;
+  }
+
+  _ARMV7M_NVIC_Clear_enable((int) vector);
+  _ARM_Data_synchronization_barrier();
+  _ARM_Instruction_synchronization_barrier();
+  _ARMV7M_Set_exception_handler(
+    ARMV7M_VECTOR_IRQ((int) vector),
+    _ARMV7M_NVIC_Interrupt_dispatch
+  );
+  _ARMV7M_NVIC_Set_priority((int) vector, BSP_ARMV7M_IRQ_PRIORITY_DEFAULT);
+
+  bsp_interrupt_unlock();
+  return RTEMS_SUCCESSFUL;
+}
+
+#endif /* ARM_MULTILIB_ARCH_V7M */
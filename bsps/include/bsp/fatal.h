@@ -208,6 +208,13 @@ typedef enum {
 
   /* MicroBlaze fatal codes */
   MICROBLAZE_FATAL_CLOCK_IRQ_INSTALL = BSP_FATAL_CODE_BLOCK(16),
+
+  /* MK64F12 fatal codes */
+  MK64F12_FATAL_TICKLESS_IRQ_INSTALL = BSP_FATAL_CODE_BLOCK(17),
+  MK64F12_FATAL_NO_CYCCNT,
+  MK64F12_FATAL_RNG_HEALTH,
+  MK64F12_FATAL_CLOCK_SCALING,
+  MK64F12_FATAL_COMPARATOR_IRQ_INSTALL,
 } bsp_fatal_code;
 
 RTEMS_NO_RETURN static inline void
@@ -45,6 +45,8 @@ extern "C" {
 
 #ifdef LIBBSP_ARM_IMXRT_BSP_H
   #define EDMA_CHANNEL_COUNT 32U
+#elif defined(LIBBSP_ARM_MK64F12_BSP_H)
+  #define EDMA_CHANNEL_COUNT 16U
 #elif MPC55XX_CHIP_FAMILY == 551
   #define EDMA_CHANNEL_COUNT 16U
 #elif MPC55XX_CHIP_FAMILY == 564
@@ -92,6 +92,14 @@ extern "C" {
   #define EDMA_HAS_CPR_DPA 1
 #endif
 
+#if defined(LIBBSP_ARM_MK64F12_BSP_H)
+  #define EDMA_HAS_CR_CX_ECX 1
+  #define EDMA_HAS_CR_EMLM_CLM_HALT_HOE 1
+  #define EDMA_HAS_ESR_ECX 1
+  #define EDMA_HAS_HRS 1
+  #define EDMA_HAS_CPR_DPA 1
+#endif
+
 struct fsl_edma {
   uint32_t CR;
 #ifdef EDMA_HAS_CR_EBW
@@ -42,6 +42,9 @@
 #ifdef LIBBSP_ARM_IMXRT_BSP_H
 #include <MIMXRT1052.h>
 #endif
+#ifdef LIBBSP_ARM_MK64F12_BSP_H
+#include <MK64F12.h>
+#endif
 
 #define EDMA_CHANNELS_PER_GROUP 32U
 
@@ -58,9 +61,9 @@ static uint32_t edma_channel_occupation [EDMA_GROUP_COUNT];
 static RTEMS_CHAIN_DEFINE_EMPTY(edma_channel_chain);
 
 volatile struct fsl_edma *edma_inst[EDMA_MODULE_COUNT] = {
-#ifdef LIBBSP_ARM_IMXRT_BSP_H
+#if defined(LIBBSP_ARM_IMXRT_BSP_H) || defined(LIBBSP_ARM_MK64F12_BSP_H)
   (volatile struct fsl_edma *) DMA0,
-#else /* ! LIBBSP_ARM_IMXRT_BSP_H */
+#else /* ! LIBBSP_ARM_IMXRT_BSP_H && ! LIBBSP_ARM_MK64F12_BSP_H */
   #if EDMA_MODULE_COUNT == 1
     (volatile struct fsl_edma *) &EDMA,
   #elif EDMA_MODULE_COUNT == 2
@@ -69,7 +72,7 @@ volatile struct fsl_edma *edma_inst[EDMA_MODULE_COUNT] = {
   #else
     #error "unsupported module count"
   #endif
-#endif /* LIBBSP_ARM_IMXRT_BSP_H */
+#endif /* LIBBSP_ARM_IMXRT_BSP_H || LIBBSP_ARM_MK64F12_BSP_H */
 };
 
 unsigned fsl_edma_channel_index_of_tcd(
@@ -218,7 +221,10 @@ void fsl_edma_init(void)
     edma->CERQR = EDMA_CERQR_CAER;
 
     /* Arbitration mode: group round robin, channel fixed */
+#ifndef LIBBSP_ARM_MK64F12_BSP_H
+    /* The MK64F12 eDMA has only one group and no ERGA bit */
     edma->CR |= EDMA_CR_ERGA;
+#endif
     edma->CR &= ~EDMA_CR_ERCA;
 #if defined(BSP_FSL_EDMA_EMLM)
     edma->CR |= EDMA_CR_EMLM;
@@ -261,6 +267,14 @@ void fsl_edma_init(void)
       edma_interrupt_error_handler,
       NULL
     );
+#elif defined(LIBBSP_ARM_MK64F12_BSP_H)
+    sc = rtems_interrupt_handler_install(
+      DMA_Error_IRQn,
+      "eDMA Error",
+      RTEMS_INTERRUPT_UNIQUE,
+      edma_interrupt_error_handler,
+      NULL
+    );
 #else
   #error "Unknown chip"
 #endif
@@ -358,6 +372,14 @@ static rtems_status_code fsl_edma_install_obtained_channel(
     fsl_edma_interrupt_handler,
     ctx
   );
+#elif defined(LIBBSP_ARM_MK64F12_BSP_H)
+  sc = rtems_interrupt_handler_install(
+    DMA0_IRQn + channel_index,
+    "eDMA Channel",
+    RTEMS_INTERRUPT_SHARED,
+    fsl_edma_interrupt_handler,
+    ctx
+  );
 #else
   #error "Unknown chip"
 #endif
@@ -418,6 +440,8 @@ void fsl_edma_release_channel(fsl_edma_channel_context *ctx)
     MPC55XX_IRQ_EDMA(channel_index),
 #elif defined(LIBBSP_ARM_IMXRT_BSP_H)
     DMA0_DMA16_IRQn + (channel_index % 16),
+#elif defined(LIBBSP_ARM_MK64F12_BSP_H)
+    DMA0_IRQn + channel_index,
 #else
   #error "Unknown chip"
 #endif
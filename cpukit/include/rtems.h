@@ -71,6 +71,7 @@
 #include <rtems/rtems/object.h>
 #include <rtems/rtems/options.h>
 #include <rtems/rtems/part.h>
+#include <rtems/rtems/partinfo.h>
 #include <rtems/rtems/ratemon.h>
 #include <rtems/rtems/region.h>
 #include <rtems/rtems/scheduler.h>
@@ -159,6 +159,11 @@ extern "C" {
     RTEMS_ARRAY_SIZE( _User_extensions_Initial_extensions )
   ];
 
+  const User_extensions_Table *_User_extensions_Initial_dispatch[
+    USER_EXTENSIONS_HOOK_COUNT
+      * RTEMS_ARRAY_SIZE( _User_extensions_Initial_extensions )
+  ];
+
   RTEMS_SYSINIT_ITEM(
     _User_extensions_Handler_initialization,
     RTEMS_SYSINIT_INITIAL_EXTENSIONS,
@@ -50,7 +50,8 @@
 #define _CONFIGURE_HEAP_EXTEND_VIA_SBRK
 #endif
 
-#if defined(_CONFIGURE_HEAP_EXTEND_VIA_SBRK) || defined(CONFIGURE_MALLOC_DIRTY)
+#if defined(_CONFIGURE_HEAP_EXTEND_VIA_SBRK) || defined(CONFIGURE_MALLOC_DIRTY) \
+  || defined(CONFIGURE_MALLOC_TLSF) || defined(CONFIGURE_MALLOC_PER_CPU_CACHE)
 #include <rtems/malloc.h>
 #endif
 
@@ -68,6 +69,16 @@ rtems_malloc_dirtier_t rtems_malloc_dirty_helper =
   rtems_malloc_dirty_memory;
 #endif
 
+#ifdef CONFIGURE_MALLOC_TLSF
+const Heap_Initialization_or_extend_handler _Malloc_Heap_initializer =
+  _Heap_Initialize_TLSF;
+#endif
+
+#ifdef CONFIGURE_MALLOC_PER_CPU_CACHE
+const Malloc_Cache_handlers * const _Malloc_Cache =
+  &_Malloc_Cache_per_CPU_handlers;
+#endif
+
 #ifdef __cplusplus
 }
 #endif
@@ -80,6 +80,11 @@
   #include <rtems/rtems/timerdata.h>
 #endif
 
+#ifdef CONFIGURE_OBJECTS_NAME_INDEX
+  #include <rtems/score/objectimpl.h>
+  #include <rtems/sysinit.h>
+#endif
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -119,6 +124,20 @@ extern "C" {
   TIMER_INFORMATION_DEFINE( CONFIGURE_MAXIMUM_TIMERS );
 #endif
 
+/*
+ * The name indices are created after the initialization of all object
+ * classes.  They are allocated from the workspace, so the application has to
+ * account for them, for example with CONFIGURE_MEMORY_OVERHEAD.  An index uses
+ * at most four pointers per object.
+ */
+#ifdef CONFIGURE_OBJECTS_NAME_INDEX
+  RTEMS_SYSINIT_ITEM(
+    _Objects_Name_index_initialize,
+    RTEMS_SYSINIT_IDLE_THREADS,
+    RTEMS_SYSINIT_ORDER_FIRST
+  );
+#endif
+
 #ifdef __cplusplus
 }
 #endif
@@ -56,6 +56,11 @@
 #include <rtems/score/percpu.h>
 #include <rtems/score/smp.h>
 
+#ifdef CONFIGURE_WATCHDOG_TIMING_WHEEL
+  #include <rtems/score/watchdogimpl.h>
+  #include <rtems/sysinit.h>
+#endif
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -164,6 +169,20 @@ const size_t _Thread_Idle_stack_size = CONFIGURE_IDLE_TASK_STACK_SIZE;
   const Thread_Idle_body _Thread_Idle_body = CONFIGURE_IDLE_TASK_BODY;
 #endif
 
+/*
+ * The clock tick based watchdogs of each processor use a timing wheel with
+ * constant time insert and remove operations instead of a red-black tree.
+ */
+#ifdef CONFIGURE_WATCHDOG_TIMING_WHEEL
+  Watchdog_Wheel _Watchdog_Wheels[ _CONFIGURE_MAXIMUM_PROCESSORS ];
+
+  RTEMS_SYSINIT_ITEM(
+    _Watchdog_Wheel_initialize_per_CPU,
+    RTEMS_SYSINIT_DATA_STRUCTURES,
+    RTEMS_SYSINIT_ORDER_FIRST
+  );
+#endif
+
 #ifdef __cplusplus
 }
 #endif
@@ -46,7 +46,9 @@
 #include <rtems/confdefs/bdbuf.h>
 #include <rtems/confdefs/inittask.h>
 #include <rtems/confdefs/initthread.h>
+#include <rtems/confdefs/objectsclassic.h>
 #include <rtems/confdefs/objectsposix.h>
+#include <rtems/confdefs/percpu.h>
 #include <rtems/confdefs/threads.h>
 #include <rtems/confdefs/wkspacesupport.h>
 #include <rtems/score/coremsg.h>
@@ -55,15 +57,23 @@
 #include <rtems/score/stack.h>
 #include <rtems/sysinit.h>
 
+#ifdef CONFIGURE_TASK_STACK_CACHE_CLASSES
+  #define _CONFIGURE_TASK_STACK_CACHE_OVERHEAD STACK_CACHE_HEADER_SIZE
+#else
+  #define _CONFIGURE_TASK_STACK_CACHE_OVERHEAD 0
+#endif
+
 #if CPU_STACK_ALIGNMENT > CPU_HEAP_ALIGNMENT
   #define _CONFIGURE_TASK_STACK_ALLOC_SIZE( _stack_size ) \
     ( RTEMS_ALIGN_UP( \
         ( _stack_size ) + CONTEXT_FP_SIZE, \
         CPU_STACK_ALIGNMENT \
-      ) + CPU_STACK_ALIGNMENT - CPU_HEAP_ALIGNMENT )
+      ) + CPU_STACK_ALIGNMENT - CPU_HEAP_ALIGNMENT \
+      + _CONFIGURE_TASK_STACK_CACHE_OVERHEAD )
 #else
   #define _CONFIGURE_TASK_STACK_ALLOC_SIZE( _stack_size ) \
-    RTEMS_ALIGN_UP( ( _stack_size ) + CONTEXT_FP_SIZE, CPU_STACK_ALIGNMENT )
+    ( RTEMS_ALIGN_UP( ( _stack_size ) + CONTEXT_FP_SIZE, CPU_STACK_ALIGNMENT ) \
+      + _CONFIGURE_TASK_STACK_CACHE_OVERHEAD )
 #endif
 
 #ifdef CONFIGURE_TASK_STACK_FROM_ALLOCATOR
@@ -105,11 +115,39 @@
 #define _CONFIGURE_HEAP_HANDLER_OVERHEAD \
   _Configure_Align_up( HEAP_BLOCK_HEADER_SIZE, CPU_HEAP_ALIGNMENT )
 
+/*
+ * The TLSF index of the workspace is placed in the workspace area, see
+ * _Heap_Initialize_TLSF().
+ */
+#ifdef CONFIGURE_WORKSPACE_TLSF
+  #define _CONFIGURE_WORKSPACE_TLSF_OVERHEAD HEAP_TLSF_CONTROL_OVERHEAD
+#else
+  #define _CONFIGURE_WORKSPACE_TLSF_OVERHEAD 0
+#endif
+
+/*
+ * The per-processor caches of partitions created with the
+ * RTEMS_PARTITION_PER_CPU_CACHE attribute are cache line aligned, see
+ * _Partition_Cache_initialize().
+ */
+#if _CONFIGURE_MAXIMUM_PROCESSORS > 1 && CONFIGURE_MAXIMUM_PARTITIONS > 0
+  #define _CONFIGURE_MEMORY_FOR_PARTITION_CACHES \
+    ( rtems_resource_maximum_per_allocation( CONFIGURE_MAXIMUM_PARTITIONS ) \
+      * _Configure_From_workspace( \
+        _CONFIGURE_MAXIMUM_PROCESSORS * sizeof( Partition_Per_CPU ) \
+          + CPU_CACHE_LINE_BYTES \
+      ) )
+#else
+  #define _CONFIGURE_MEMORY_FOR_PARTITION_CACHES 0
+#endif
+
 #define CONFIGURE_EXECUTIVE_RAM_SIZE \
   ( _CONFIGURE_MEMORY_FOR_POSIX_OBJECTS \
+    + _CONFIGURE_MEMORY_FOR_PARTITION_CACHES \
     + CONFIGURE_MESSAGE_BUFFER_MEMORY \
     + 1024 * CONFIGURE_MEMORY_OVERHEAD \
-    + _CONFIGURE_HEAP_HANDLER_OVERHEAD )
+    + _CONFIGURE_HEAP_HANDLER_OVERHEAD \
+    + _CONFIGURE_WORKSPACE_TLSF_OVERHEAD )
 
 #define _CONFIGURE_STACK_SPACE_SIZE \
   ( _CONFIGURE_INIT_TASK_STACK_EXTRA \
@@ -140,6 +178,11 @@ extern "C" {
 
 const uintptr_t _Workspace_Size = CONFIGURE_EXECUTIVE_RAM_SIZE;
 
+#ifdef CONFIGURE_WORKSPACE_TLSF
+  const Heap_Initialization_or_extend_handler _Workspace_Heap_initializer =
+    _Heap_Initialize_TLSF;
+#endif
+
 #ifdef CONFIGURE_UNIFIED_WORK_AREAS
   const bool _Workspace_Is_unified = true;
 
@@ -221,6 +264,28 @@ const uintptr_t _Stack_Space_size = _CONFIGURE_STACK_SPACE_SIZE;
     CONFIGURE_TASK_STACK_ALLOCATOR_FOR_IDLE;
 #endif
 
+#ifdef CONFIGURE_TASK_STACK_CACHE_CLASSES
+  #if CONFIGURE_TASK_STACK_CACHE_CLASSES < 1
+    #error "CONFIGURE_TASK_STACK_CACHE_CLASSES must be at least one"
+  #endif
+
+  #ifndef CONFIGURE_TASK_STACK_CACHE_MAXIMUM
+    #define CONFIGURE_TASK_STACK_CACHE_MAXIMUM 4
+  #endif
+
+  Stack_Cache_class _Stack_Cache_classes[ CONFIGURE_TASK_STACK_CACHE_CLASSES ];
+
+  const size_t _Stack_Cache_class_count = CONFIGURE_TASK_STACK_CACHE_CLASSES;
+
+  const uint32_t _Stack_Cache_maximum_per_class =
+    CONFIGURE_TASK_STACK_CACHE_MAXIMUM;
+
+  const Stack_Cache_handlers * const _Stack_Cache =
+    &_Stack_Cache_size_class_handlers;
+#elif defined(CONFIGURE_TASK_STACK_CACHE_MAXIMUM)
+  #warning "CONFIGURE_TASK_STACK_CACHE_MAXIMUM defined without CONFIGURE_TASK_STACK_CACHE_CLASSES"
+#endif
+
 #ifdef CONFIGURE_DIRTY_MEMORY
   RTEMS_SYSINIT_ITEM(
     _Memory_Dirty_free_areas,
@@ -0,0 +1,138 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/**
+ * @file
+ *
+ * @ingroup RTEMSAPICRC32
+ *
+ * @brief This header file provides the CRC-32 interface.
+ */
+
+/*
+ * Copyright (C) 2026 Dave Rush
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#ifndef _RTEMS_CRC32_H
+#define _RTEMS_CRC32_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup RTEMSAPICRC32 CRC-32
+ *
+ * @ingroup RTEMSAPI
+ *
+ * @brief CRC-32 with a replaceable backend.
+ *
+ * This is the CRC-32 of IEEE 802.3 (reflected polynomial 0xedb88320).  The
+ * JFFS2 file system, zlib and the XZ decompressor use it.  By default, a
+ * portable slice-by-8 table implementation is used.  A BSP may install a
+ * backend during system initialization, e.g. to use a CRC hardware module.
+ */
+/**@{*/
+
+/**
+ * @brief CRC-32 backend.
+ *
+ * The backend may decline a request, e.g. if it is too small to be worth the
+ * hardware setup or if it is issued in interrupt context.  In this case the
+ * portable implementation is used.
+ *
+ * @param[in, out] crc is the CRC-32 state.  It has the same semantics as in
+ *   rtems_crc32_update().
+ * @param[in] buf is the begin of the buffer.  There are no alignment
+ *   restrictions.
+ * @param len is the length of the buffer in bytes.
+ *
+ * @retval true The backend updated the CRC-32 state.
+ * @retval false The backend declined the request.
+ */
+typedef bool ( *rtems_crc32_backend )(
+  uint32_t   *crc,
+  const void *buf,
+  size_t      len
+);
+
+/**
+ * @brief Updates the CRC-32 state with the buffer contents.
+ *
+ * The state is not inverted before or after the update.  For the CRC-32 of
+ * zlib and IEEE 802.3 use the inverted value of the previous CRC-32 as the
+ * state and invert the result.
+ *
+ * @param crc is the CRC-32 state.
+ * @param[in] buf is the begin of the buffer.
+ * @param len is the length of the buffer in bytes.
+ *
+ * @return Returns the updated CRC-32 state.
+ */
+uint32_t rtems_crc32_update( uint32_t crc, const void *buf, size_t len );
+
+/**
+ * @brief Updates the CRC-32 state with the buffer contents using the
+ *   portable slice-by-8 implementation.
+ *
+ * @param crc is the CRC-32 state.
+ * @param[in] buf is the begin of the buffer.
+ * @param len is the length of the buffer in bytes.
+ *
+ * @return Returns the updated CRC-32 state.
+ */
+uint32_t rtems_crc32_update_generic(
+  uint32_t    crc,
+  const void *buf,
+  size_t      len
+);
+
+/**
+ * @brief Installs the CRC-32 backend.
+ *
+ * This function is not thread-safe with respect to concurrent CRC-32
+ * computations.  Call it during system initialization.
+ *
+ * @param backend is the backend.  Use NULL to use only the portable
+ *   implementation.
+ */
+void rtems_crc32_set_backend( rtems_crc32_backend backend );
+
+/**
+ * @brief The installed CRC-32 backend, NULL selects the portable
+ *   implementation.
+ */
+extern rtems_crc32_backend _CRC32_Backend;
+
+/**@}*/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _RTEMS_CRC32_H */
@@ -311,6 +311,20 @@ struct rtems_jffs2_flash_control {
    * RTEMS_JFFS2_ON_DEMAND_GARBAGE_COLLECTION IO control to carry out the work.
    */
   rtems_jffs2_trigger_garbage_collection trigger_garbage_collection;
+
+  /**
+   * @brief The size in bytes of the programmable unit of the flash device.
+   *
+   * A value of zero or one indicates a NOR flash device which allows to clear
+   * bits of already written data.  A greater value indicates a flash device
+   * which allows to program a unit only once after an erase, for example a
+   * NOR flash device with ECC.  In this case, nodes are not marked obsolete
+   * on the flash device and the write operation must accept writes which
+   * share a unit with a previous write, for example by a write buffer for the
+   * last unit written.  The block size must be an integral multiple of the
+   * write size.
+   */
+  uint32_t write_size;
 };
 
 typedef struct rtems_jffs2_compressor_control rtems_jffs2_compressor_control;
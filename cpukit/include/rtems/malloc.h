@@ -98,6 +98,75 @@ void *rtems_heap_null_extend(
 
 extern const rtems_heap_extend_handler rtems_malloc_extend_handler;
 
+/**
+ * @brief This constant provides the handler to initialize the separate C
+ *   Program Heap.
+ *
+ * This constant is defined by the application configuration option
+ * #CONFIGURE_MALLOC_TLSF via <rtems/confdefs.h> or a default configuration.
+ * It is _Heap_Initialize_TLSF() or _Heap_Initialize().
+ */
+extern const Heap_Initialization_or_extend_handler _Malloc_Heap_initializer;
+
+/**
+ * @brief The handlers of a front-end cache of the C Program Heap.
+ */
+typedef struct {
+  /**
+   * @brief Allocates a memory area of the size from the cache.
+   *
+   * It is called without the allocator mutex owned.  It returns NULL, if the
+   * size is not served by the cache or no memory is available, the caller
+   * then uses the heap directly.
+   */
+  void *( *allocate )( Heap_Control *heap, size_t size );
+
+  /**
+   * @brief Frees the memory area to the cache.
+   *
+   * It returns true, if the cache took the memory area, otherwise false and
+   * the caller frees the memory area to the heap.
+   */
+  bool ( *free )( Heap_Control *heap, void *ptr );
+
+  /**
+   * @brief Returns all memory areas held by the cache to the heap.
+   */
+  void ( *flush )( Heap_Control *heap );
+} Malloc_Cache_handlers;
+
+/**
+ * @brief This constant provides the front-end cache of the C Program Heap.
+ *
+ * This constant is defined by the application configuration option
+ * #CONFIGURE_MALLOC_PER_CPU_CACHE via <rtems/confdefs.h> or a default
+ * configuration.  It is &_Malloc_Cache_per_CPU_handlers or NULL.
+ */
+extern const Malloc_Cache_handlers * const _Malloc_Cache;
+
+/**
+ * @brief The per-processor size class cache.
+ *
+ * Allocations without alignment and boundary constraints of up to 256 bytes
+ * are served from per-processor lists of eight size classes.  The lists are
+ * refilled from the heap and drained to the heap in batches, so most
+ * allocations and frees do not obtain the allocator mutex.  The cached memory
+ * areas are used blocks of the heap.  A repeated free() of a memory area held
+ * by the cache is not detected.
+ */
+extern const Malloc_Cache_handlers _Malloc_Cache_per_CPU_handlers;
+
+/**
+ * @brief Returns all memory areas held by the front-end cache of the C
+ * Program Heap to the heap.
+ *
+ * malloc_walk(), malloc_info(), malloc_free_space() and the greedy allocate
+ * functions call this function, so that they see the cached memory as free.
+ * This function does nothing, if no cache is configured or the system state
+ * does not permit the use of the allocator mutex.
+ */
+void rtems_malloc_cache_flush( void );
+
 /*
  * Malloc Plugin to Dirty Memory at Allocation Time
  */
@@ -65,7 +65,7 @@ RTEMS_INLINE_ROUTINE Heap_Control *_Malloc_Initialize_for_multiple_areas(
 
   mem = _Memory_Get();
   RTEMS_Malloc_Heap = heap;
-  init_or_extend = _Heap_Initialize;
+  init_or_extend = _Malloc_Heap_initializer;
   page_size = CPU_HEAP_ALIGNMENT;
 
   for (i = 0; i < _Memory_Get_count( mem ); ++i) {
@@ -86,7 +86,7 @@ RTEMS_INLINE_ROUTINE Heap_Control *_Malloc_Initialize_for_multiple_areas(
     }
   }
 
-  if ( init_or_extend == _Heap_Initialize ) {
+  if ( init_or_extend != _Heap_Extend ) {
     _Internal_error( INTERNAL_ERROR_NO_MEMORY_FOR_HEAP );
   }
 
@@ -67,7 +67,7 @@ RTEMS_INLINE_ROUTINE Heap_Control *_Malloc_Initialize_for_one_area(
 
   RTEMS_Malloc_Heap = heap;
   area = _Memory_Get_area( mem, 0 );
-  space_available = _Heap_Initialize(
+  space_available = ( *_Malloc_Heap_initializer )(
     heap,
     _Memory_Get_free_begin( area ),
     _Memory_Get_free_size( area ),
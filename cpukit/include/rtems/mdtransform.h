@@ -0,0 +1,136 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/**
+ * @file
+ *
+ * @brief Message Digest Block Transform Hooks
+ *
+ * This file defines the interface to replace the block transforms of the
+ * MD5 and SHA-256 implementations of libmd, e.g. by hardware accelerated
+ * variants.
+ */
+
+/*
+ * Copyright (C) 2026 Dave Rush
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef _RTEMS_MDTRANSFORM_H
+#define _RTEMS_MDTRANSFORM_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup libmd_transform Message Digest Block Transforms
+ *
+ * @ingroup RTEMSImplClassic
+ *
+ * @brief Replaceable block transforms of MD5Update() and SHA256_Update().
+ *
+ * The update functions of libmd hand all complete 64 byte blocks of the
+ * message to the installed block transform, so MD5Final(), SHA256_Final(),
+ * the libcrypt password hashes and the shell @c md5 command use it without
+ * changes.  By default, the portable C transforms are used.  A BSP may
+ * install a hardware accelerated transform during system initialization.
+ */
+/**@{*/
+
+/**
+ * @brief Block transform.
+ *
+ * @param[in, out] state is the hash state, four words for MD5 and eight
+ *   words for SHA-256.
+ * @param[in] blocks is the begin of @a count consecutive blocks of 64 bytes.
+ *   There are no alignment restrictions.
+ * @param count is the count of blocks.
+ */
+typedef void ( *rtems_md_transform )(
+  uint32_t            *state,
+  const unsigned char *blocks,
+  size_t               count
+);
+
+/**
+ * @brief Installs the MD5 block transform.
+ *
+ * This function is not thread-safe with respect to concurrent MD5 hash
+ * computations.  Call it during system initialization.
+ *
+ * @param transform is the block transform.  Use NULL to restore the portable
+ *   C transform.
+ */
+void rtems_md5_set_transform( rtems_md_transform transform );
+
+/**
+ * @brief Installs the SHA-256 block transform.
+ *
+ * This function is not thread-safe with respect to concurrent SHA-256 hash
+ * computations.  Call it during system initialization.
+ *
+ * @param transform is the block transform.  Use NULL to restore the portable
+ *   C transform.
+ */
+void rtems_sha256_set_transform( rtems_md_transform transform );
+
+/**
+ * @brief Portable C MD5 block transform.
+ */
+void rtems_md5_transform_generic(
+  uint32_t            *state,
+  const unsigned char *blocks,
+  size_t               count
+);
+
+/**
+ * @brief Portable C SHA-256 block transform.
+ */
+void rtems_sha256_transform_generic(
+  uint32_t            *state,
+  const unsigned char *blocks,
+  size_t               count
+);
+
+/**
+ * @brief The installed MD5 block transform, NULL selects the portable C
+ *   transform.
+ */
+extern rtems_md_transform _MD5_Transform_hook;
+
+/**
+ * @brief The installed SHA-256 block transform, NULL selects the portable C
+ *   transform.
+ */
+extern rtems_md_transform _SHA256_Transform_hook;
+
+/**@}*/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _RTEMS_MDTRANSFORM_H */
@@ -130,6 +130,30 @@ RTEMS_INLINE_ROUTINE Per_CPU_Control *_POSIX_Timer_Acquire_critical(
   return cpu;
 }
 
+/**
+ *  @brief POSIX Timer Header
+ *
+ *  This function returns the watchdog header of the timer.  If a comparator
+ *  of the high resolution watchdogs is installed, then the timers use the
+ *  nanoseconds watchdog header of their clock, otherwise they use the clock
+ *  tick watchdog header.
+ */
+RTEMS_INLINE_ROUTINE Watchdog_Header *_POSIX_Timer_Header(
+  const POSIX_Timer_Control *ptimer,
+  Per_CPU_Control           *cpu
+)
+{
+  if ( _Watchdog_Comparator == NULL ) {
+    return &cpu->Watchdog.Header[ PER_CPU_WATCHDOG_TICKS ];
+  }
+
+  if ( ptimer->clock_type == CLOCK_MONOTONIC ) {
+    return &cpu->Watchdog.Header[ PER_CPU_WATCHDOG_MONOTONIC ];
+  }
+
+  return &cpu->Watchdog.Header[ PER_CPU_WATCHDOG_REALTIME ];
+}
+
 RTEMS_INLINE_ROUTINE void _POSIX_Timer_Release(
   Per_CPU_Control  *cpu,
   ISR_lock_Context *lock_context
@@ -297,6 +297,23 @@ typedef uint32_t rtems_attribute;
  */
 #define RTEMS_PRIORITY_CEILING 0x00000080
 
+/**
+ * @ingroup RTEMSAPIClassicAttr
+ *
+ * @brief This attribute constant indicates that the Classic API region
+ *   created by rtems_region_create() shall use the TLSF allocator.
+ */
+#define RTEMS_REGION_TLSF 0x00000400
+
+/**
+ * @ingroup RTEMSAPIClassicAttr
+ *
+ * @brief This attribute constant indicates that the Classic API partition
+ *   created by rtems_partition_create() shall cache free buffers per
+ *   processor.
+ */
+#define RTEMS_PARTITION_PER_CPU_CACHE 0x00000800
+
 /* Generated from spec:/rtems/attr/if/semaphore-class */
 
 /**
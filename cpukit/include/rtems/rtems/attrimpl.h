@@ -146,6 +146,37 @@ RTEMS_INLINE_ROUTINE bool _Attributes_Is_priority(
    return ( attribute_set & RTEMS_PRIORITY ) ? true : false;
 }
 
+/**
+ * @brief Checks if the region TLSF attribute is enabled in the attribute set.
+ *
+ * @param attribute_set The attribute set to check.
+ *
+ * @retval true The region shall use the TLSF allocator.
+ * @retval false Otherwise.
+ */
+RTEMS_INLINE_ROUTINE bool _Attributes_Is_region_TLSF(
+  rtems_attribute attribute_set
+)
+{
+   return ( attribute_set & RTEMS_REGION_TLSF ) ? true : false;
+}
+
+/**
+ * @brief Checks if the partition per-CPU cache attribute is enabled in the
+ *   attribute set.
+ *
+ * @param attribute_set The attribute set to check.
+ *
+ * @retval true The partition shall cache free buffers per processor.
+ * @retval false Otherwise.
+ */
+RTEMS_INLINE_ROUTINE bool _Attributes_Is_partition_per_CPU_cache(
+  rtems_attribute attribute_set
+)
+{
+   return ( attribute_set & RTEMS_PARTITION_PER_CPU_CACHE ) ? true : false;
+}
+
 /**
  *  @brief Checks if the binary semaphore attribute is
  *  enabled in the attribute_set.
@@ -144,6 +144,20 @@ extern "C" {
  *   The memory space used for the partition must reside in shared memory.
  *   Setting the global attribute in a single node system has no effect.
  *
+ * The management of the free buffers is selected by the
+ * #RTEMS_PARTITION_PER_CPU_CACHE attribute.
+ *
+ * * By default, a returned buffer is allocated after all other free buffers
+ *   of the partition.
+ *
+ * * If the #RTEMS_PARTITION_PER_CPU_CACHE attribute is set, then a returned
+ *   buffer is allocated before the other free buffers, so that the buffers
+ *   likely present in the data cache are reused first.  In SMP configurations
+ *   with more than one processor, each processor caches some free buffers in
+ *   addition.  The caches are refilled from and drained to the partition in
+ *   batches, so that most buffer get and return operations do not obtain the
+ *   partition lock.  The caches are allocated from the RTEMS Workspace.
+ *
  * @retval ::RTEMS_SUCCESSFUL The requested operation was successful.
  *
  * @retval ::RTEMS_INVALID_NAME The ``name`` parameter was invalid.
@@ -176,6 +190,9 @@ extern "C" {
  *   of global objects available to the application is configured through the
  *   #CONFIGURE_MP_MAXIMUM_GLOBAL_OBJECTS application configuration option.
  *
+ * @retval ::RTEMS_UNSATISFIED There was not enough memory in the RTEMS
+ *   Workspace to allocate the per-processor caches of the partition.
+ *
  * @par Notes
  * @parblock
  * The partition buffer area specified by the ``starting_address`` must be
@@ -196,6 +213,11 @@ extern "C" {
  * the local PTCB free pool and initializes it. Memory from the partition
  * buffer area is not used by RTEMS to store the PTCB.
  *
+ * The buffers cached by a processor are only available to other processors
+ * after they are drained to the partition.  If no free buffer is available to
+ * rtems_partition_get_buffer(), then the caches of all processors are drained
+ * before the directive gives up.
+ *
  * The PTCB for a global partition is allocated on the local node.  Partitions
  * should not be made global unless remote tasks must interact with the
  * partition.  This is to avoid the overhead incurred by the creation of a
@@ -51,6 +51,33 @@ extern "C" {
  * @{
  */
 
+#if defined(RTEMS_SMP)
+/**
+ * @brief The per-processor cache of free buffers of a partition.
+ */
+typedef struct {
+  /**
+   * @brief This lock protects the cached buffers.
+   *
+   * The lock is obtained by the owner processor to get and return buffers and
+   * by other processors to drain the cache.
+   */
+  ISR_lock_Control Lock;
+
+  /**
+   * @brief This chain contains the cached buffers.
+   *
+   * The first buffer is the most recently returned buffer.
+   */
+  Chain_Control Buffers;
+
+  /**
+   * @brief This member contains the count of cached buffers.
+   */
+  uintptr_t count;
+} RTEMS_ALIGNED( CPU_CACHE_LINE_BYTES ) Partition_Per_CPU;
+#endif
+
 /**
  * @brief The Partition Control Block (PTCB) represents a partition.
  */
@@ -96,6 +123,8 @@ typedef struct {
 
   /**
    * @brief This member contains the count of allocated buffers.
+   *
+   * The buffers cached by the processors are included in this count.
    */
   uintptr_t number_of_used_blocks;
 
@@ -103,6 +132,32 @@ typedef struct {
    * @brief This chain is used to manage unallocated buffers.
    */
   Chain_Control Memory;
+
+  /**
+   * @brief This member contains the count of partition lock acquisitions to
+   *   get and return buffers.
+   */
+  uint32_t lock_acquisitions;
+
+  /**
+   * @brief This member contains the count of per-processor cache refills.
+   */
+  uint32_t cache_refills;
+
+  /**
+   * @brief This member contains the count of per-processor cache drains.
+   */
+  uint32_t cache_drains;
+
+#if defined(RTEMS_SMP)
+  /**
+   * @brief This member references the per-processor caches of free buffers
+   *   indexed by the processor index.
+   *
+   * It is NULL, if the partition has no per-processor caches.
+   */
+  Partition_Per_CPU *Per_CPU;
+#endif
 } Partition_Control;
 
 /**
@@ -104,6 +104,74 @@ RTEMS_INLINE_ROUTINE void _Partition_Release(
   _ISR_lock_Release_and_ISR_enable( &the_partition->Lock, lock_context );
 }
 
+#if defined(RTEMS_SMP)
+/**
+ * @brief Initializes the per-processor caches of the partition.
+ *
+ * In configurations with only one processor, the partition gets no
+ * per-processor caches.
+ *
+ * @param[out] the_partition is the partition control block.
+ *
+ * @retval true The per-processor caches were initialized.
+ * @retval false There was not enough memory in the RTEMS Workspace.
+ */
+bool _Partition_Cache_initialize( Partition_Control *the_partition );
+
+/**
+ * @brief Destroys the per-processor caches of the partition.
+ *
+ * @param[in, out] the_partition is the partition control block.
+ */
+void _Partition_Cache_destroy( Partition_Control *the_partition );
+
+/**
+ * @brief Gets a buffer from the cache of the current processor.
+ *
+ * An empty cache is refilled from the partition in a batch.  If the partition
+ * has no free buffer, then the caches of all processors are drained and the
+ * buffer is obtained from the partition.
+ *
+ * @param[in, out] the_partition is the partition control block.
+ *
+ * @param[in, out] lock_context is the lock context set up by _Partition_Get().
+ *   The function restores the ISR level.
+ *
+ * @return Returns the buffer, otherwise NULL if no free buffer was available.
+ */
+void *_Partition_Cache_get_buffer(
+  Partition_Control *the_partition,
+  ISR_lock_Context  *lock_context
+);
+
+/**
+ * @brief Returns the buffer to the cache of the current processor.
+ *
+ * A full cache is drained to the partition in a batch.
+ *
+ * @param[in, out] the_partition is the partition control block.
+ *
+ * @param the_buffer is the buffer to return.
+ *
+ * @param[in, out] lock_context is the lock context set up by _Partition_Get().
+ *   The function restores the ISR level.
+ */
+void _Partition_Cache_return_buffer(
+  Partition_Control *the_partition,
+  void              *the_buffer,
+  ISR_lock_Context  *lock_context
+);
+
+/**
+ * @brief Drains the caches of all processors to the partition.
+ *
+ * The caller shall disable interrupts and shall not own the partition lock.
+ *
+ * @param[in, out] the_partition is the partition control block.
+ */
+void _Partition_Cache_drain( Partition_Control *the_partition );
+#endif
+
 /**@}*/
 
 #ifdef __cplusplus
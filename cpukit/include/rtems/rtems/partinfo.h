@@ -0,0 +1,139 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/**
+ * @file
+ *
+ * @ingroup RTEMSAPIClassicPart
+ *
+ * @brief This header file provides the interface of
+ *   rtems_partition_get_information().
+ */
+
+/*
+ * Copyright (C) 2026 Dave Rush
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef _RTEMS_RTEMS_PARTINFO_H
+#define _RTEMS_RTEMS_PARTINFO_H
+
+#include <stdint.h>
+#include <rtems/rtems/status.h>
+#include <rtems/rtems/types.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @ingroup RTEMSAPIClassicPart
+ *
+ * @brief This structure contains the information about a partition returned
+ *   by rtems_partition_get_information().
+ */
+typedef struct {
+  /**
+   * @brief This member contains the count of buffers managed by the partition.
+   */
+  uintptr_t buffer_count;
+
+  /**
+   * @brief This member contains the count of allocated buffers.
+   */
+  uintptr_t used_buffers;
+
+  /**
+   * @brief This member contains the count of free buffers.
+   */
+  uintptr_t free_buffers;
+
+  /**
+   * @brief This member contains the count of partition lock acquisitions by
+   *   rtems_partition_get_buffer() and rtems_partition_return_buffer().
+   *
+   * For a partition with per-processor caches, this is the count of cache
+   * misses.  In profiling configurations, the lock contention is reported by
+   * rtems_profiling_report_xml() under the lock name "Partition".
+   */
+  uint32_t lock_acquisitions;
+
+  /**
+   * @brief This member contains the count of per-processor cache refills from
+   *   the partition.
+   */
+  uint32_t cache_refills;
+
+  /**
+   * @brief This member contains the count of per-processor cache drains to the
+   *   partition.
+   */
+  uint32_t cache_drains;
+} rtems_partition_information;
+
+/**
+ * @ingroup RTEMSAPIClassicPart
+ *
+ * @brief Gets the information about the partition.
+ *
+ * @param id is the partition identifier.
+ *
+ * @param[out] info is the pointer to an rtems_partition_information object.
+ *   When the directive call is successful, the information about the
+ *   partition will be stored in this object.
+ *
+ * @retval ::RTEMS_SUCCESSFUL The requested operation was successful.
+ *
+ * @retval ::RTEMS_INVALID_ADDRESS The ``info`` parameter was NULL.
+ *
+ * @retval ::RTEMS_INVALID_ID There was no partition associated with the
+ *   identifier specified by ``id``.
+ *
+ * @par Notes
+ * The directive drains the per-processor caches of the partition, so that the
+ * buffers cached by the processors are counted as free buffers.  Buffers
+ * obtained or returned by other processors while the directive executes may
+ * be counted as used or free.
+ *
+ * @par Constraints
+ * @parblock
+ * The following constraints apply to this directive:
+ *
+ * * The directive may be called from within interrupt context.
+ *
+ * * The directive may be called from within task context.
+ *
+ * * The directive operates only on local objects.
+ *
+ * * The directive will not cause the calling task to be preempted.
+ * @endparblock
+ */
+rtems_status_code rtems_partition_get_information(
+  rtems_id                     id,
+  rtems_partition_information *info
+);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _RTEMS_RTEMS_PARTINFO_H */
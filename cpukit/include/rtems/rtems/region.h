@@ -183,6 +183,15 @@ rtems_status_code rtems_region_get_segment_size(
  *
  * * The **priority discipline** is selected by the #RTEMS_PRIORITY attribute.
  *
+ * The **segment allocator** of the region is selected by the
+ * #RTEMS_REGION_TLSF attribute.
+ *
+ * * The **first fit allocator** is the default.
+ *
+ * * The **TLSF allocator** is selected by the #RTEMS_REGION_TLSF attribute.
+ *   It allocates and frees segments in constant time.  The allocator places
+ *   its index of the free blocks at the begin of the memory area.
+ *
  * @retval ::RTEMS_SUCCESSFUL The requested operation was successful.
  *
  * @retval ::RTEMS_INVALID_NAME The ``name`` parameter was invalid.
@@ -73,6 +73,17 @@ extern "C" {
  * we can allocate memory.  The other blocks are used and provide an allocated
  * memory area.  The free blocks are accessible via a list of free blocks.
  *
+ * A heap initialized by _Heap_Initialize_TLSF() uses a two-level segregated
+ * fit (TLSF) index of the free blocks instead of the single free list.  The
+ * first level divides the block sizes into power of two ranges, the second
+ * level divides each range into @ref HEAP_TLSF_SL_INDEX_COUNT linear size
+ * classes.  Each size class has a list of free blocks and two levels of
+ * bitmaps indicate the non-empty lists.  So, a free block is inserted and
+ * removed in constant time and an allocation without an alignment constraint
+ * greater than the page size finds a suitable block in constant time (good
+ * fit).  The block layout, the coalescing, and the statistics are the same
+ * for both kinds of heaps.
+ *
  * Blocks or areas cover a continuous set of memory addresses. They have a
  * begin and end address.  The end address is not part of the set.  The size of
  * a block or area equals the distance between the begin and end address in
@@ -333,11 +344,78 @@ struct Heap_Block {
   Heap_Block *prev;
 };
 
+/**
+ * @brief Binary logarithm of the count of second level size classes of a TLSF
+ * index.
+ */
+#define HEAP_TLSF_SL_INDEX_LOG2 3
+
+/**
+ * @brief Count of second level size classes of a TLSF index.
+ */
+#define HEAP_TLSF_SL_INDEX_COUNT (1 << HEAP_TLSF_SL_INDEX_LOG2)
+
+/**
+ * @brief Binary logarithm of the smallest block size which is not in the
+ * first level size class zero of a TLSF index.
+ *
+ * The first level size class zero is divided into linear size classes of
+ * eight bytes.
+ */
+#define HEAP_TLSF_FL_INDEX_SHIFT (HEAP_TLSF_SL_INDEX_LOG2 + 3)
+
+/**
+ * @brief Binary logarithm of the biggest first level size class of a TLSF
+ * index.
+ *
+ * Bigger blocks are placed in the last size class.
+ */
+#define HEAP_TLSF_FL_INDEX_MAX 31
+
+/**
+ * @brief Count of first level size classes of a TLSF index.
+ */
+#define HEAP_TLSF_FL_INDEX_COUNT \
+  (HEAP_TLSF_FL_INDEX_MAX - HEAP_TLSF_FL_INDEX_SHIFT + 2)
+
+/**
+ * @brief TLSF index of the free blocks.
+ *
+ * The free block lists are NULL terminated doubly linked lists using the
+ * @ref Heap_Block.next and @ref Heap_Block.prev members.
+ */
+typedef struct {
+  /**
+   * @brief Bit i is set, if the first level size class i has a non-empty
+   * list.
+   */
+  uint32_t fl_bitmap;
+
+  /**
+   * @brief Bit j of element i is set, if the list of the second level size
+   * class j of the first level size class i is not empty.
+   */
+  uint32_t sl_bitmap[ HEAP_TLSF_FL_INDEX_COUNT ];
+
+  /**
+   * @brief The free block lists of the size classes.
+   */
+  Heap_Block *blocks[ HEAP_TLSF_FL_INDEX_COUNT ][ HEAP_TLSF_SL_INDEX_COUNT ];
+} Heap_TLSF_Control;
+
+/**
+ * @brief The worst case overhead of _Heap_Initialize_TLSF() in addition to
+ * the overhead of _Heap_Initialize().
+ */
+#define HEAP_TLSF_CONTROL_OVERHEAD \
+  ( sizeof( Heap_TLSF_Control ) + CPU_ALIGNMENT - 1 )
+
 /**
  * @brief Control block used to manage a heap.
  */
 struct Heap_Control {
   Heap_Block free_list;
+  Heap_TLSF_Control *tlsf;
   uintptr_t page_size;
   uintptr_t min_block_size;
   uintptr_t area_begin;
@@ -404,6 +482,32 @@ uintptr_t _Heap_Extend(
   uintptr_t unused
 );
 
+/**
+ * @brief Initializes the heap control block so that the free blocks are
+ * managed by a TLSF index.
+ *
+ * The TLSF index is placed at the begin of the area.  The remaining area is
+ * initialized by _Heap_Initialize().  The heap may be used by all the heap
+ * operations and extended by _Heap_Extend().
+ *
+ * @param[out] heap The heap control block to manage the area.
+ * @param area_begin The starting address of the area.
+ * @param area_size The size of the area in bytes.
+ * @param page_size The page size for the calculation, see _Heap_Initialize().
+ *
+ * @retval some_value The maximum memory available.
+ * @retval 0 The initialization failed.
+ *
+ * @see Heap_Initialization_or_extend_handler and
+ *   HEAP_TLSF_CONTROL_OVERHEAD.
+ */
+uintptr_t _Heap_Initialize_TLSF(
+  Heap_Control *heap,
+  void *area_begin,
+  uintptr_t area_size,
+  uintptr_t page_size
+);
+
 /**
  * @brief This function returns always zero.
  *
@@ -574,6 +574,221 @@ RTEMS_INLINE_ROUTINE void _Heap_Free_list_insert_before(
   block_next->prev = new_block;
 }
 
+/**
+ * @brief Gets the size class of the block size in a TLSF index.
+ *
+ * @param size The block size.
+ * @param[out] fl The first level size class.
+ * @param[out] sl The second level size class.
+ */
+void _Heap_TLSF_Get_size_class(
+  uintptr_t size,
+  uintptr_t *fl,
+  uintptr_t *sl
+);
+
+/**
+ * @brief Inserts the free block into the TLSF index.
+ *
+ * @param[in, out] tlsf The TLSF index.
+ * @param[in, out] block The block to insert.  The block size shall be valid.
+ */
+void _Heap_TLSF_Insert( Heap_TLSF_Control *tlsf, Heap_Block *block );
+
+/**
+ * @brief Removes the free block from the TLSF index.
+ *
+ * @param[in, out] tlsf The TLSF index.
+ * @param[in, out] block The block to remove.  The block size shall be the
+ *   size used to insert the block.
+ */
+void _Heap_TLSF_Remove( Heap_TLSF_Control *tlsf, Heap_Block *block );
+
+/**
+ * @brief Searches the TLSF index for a free block of at least the size.
+ *
+ * @param tlsf The TLSF index.
+ * @param size The minimum block size.
+ *
+ * @return Returns the first block of the first non-empty list with blocks of
+ *   at least the size.  If no such list exists, then the first block of the
+ *   list of the size class of the size is returned which may be NULL.
+ */
+Heap_Block *_Heap_TLSF_Search( const Heap_TLSF_Control *tlsf, uintptr_t size );
+
+/**
+ * @brief Returns the next free block of the TLSF index.
+ *
+ * @param tlsf The TLSF index.
+ * @param block The free block.
+ *
+ * @return Returns the next block of the list of the block, or the first
+ *   block of the next non-empty list with bigger blocks, or NULL.
+ */
+Heap_Block *_Heap_TLSF_Next(
+  const Heap_TLSF_Control *tlsf,
+  const Heap_Block *block
+);
+
+/**
+ * @brief Checks if the free blocks of the heap are managed by a TLSF index.
+ *
+ * @param heap The heap to operate upon.
+ *
+ * @retval true The heap was initialized by _Heap_Initialize_TLSF().
+ * @retval false Otherwise.
+ */
+RTEMS_INLINE_ROUTINE bool _Heap_Is_TLSF( const Heap_Control *heap )
+{
+  return heap->tlsf != NULL;
+}
+
+/**
+ * @brief Inserts the free block into the free block list or index of the
+ * heap.
+ *
+ * @param[in, out] heap The heap to operate upon.
+ * @param block_before The block of the free list after which the block is
+ *   inserted.  This parameter is ignored for a TLSF index.
+ * @param new_block The block to insert.  The block size shall be valid.
+ */
+RTEMS_INLINE_ROUTINE void _Heap_Free_block_insert(
+  Heap_Control *heap,
+  Heap_Block *block_before,
+  Heap_Block *new_block
+)
+{
+  if ( _Heap_Is_TLSF( heap ) ) {
+    _Heap_TLSF_Insert( heap->tlsf, new_block );
+  } else {
+    _Heap_Free_list_insert_after( block_before, new_block );
+  }
+}
+
+/**
+ * @brief Removes the free block from the free block list or index of the
+ * heap.
+ *
+ * @param[in, out] heap The heap to operate upon.
+ * @param block The block to remove.
+ */
+RTEMS_INLINE_ROUTINE void _Heap_Free_block_remove(
+  Heap_Control *heap,
+  Heap_Block *block
+)
+{
+  if ( _Heap_Is_TLSF( heap ) ) {
+    _Heap_TLSF_Remove( heap->tlsf, block );
+  } else {
+    _Heap_Free_list_remove( block );
+  }
+}
+
+/**
+ * @brief Replaces one free block by another in the free block list or index
+ * of the heap.
+ *
+ * @param[in, out] heap The heap to operate upon.
+ * @param old_block The block to replace.
+ * @param new_block The block that should replace @a old_block.  The block
+ *   size shall be valid.
+ */
+RTEMS_INLINE_ROUTINE void _Heap_Free_block_replace(
+  Heap_Control *heap,
+  Heap_Block *old_block,
+  Heap_Block *new_block
+)
+{
+  if ( _Heap_Is_TLSF( heap ) ) {
+    _Heap_TLSF_Remove( heap->tlsf, old_block );
+    _Heap_TLSF_Insert( heap->tlsf, new_block );
+  } else {
+    _Heap_Free_list_replace( old_block, new_block );
+  }
+}
+
+/**
+ * @brief Sets the size of the free block and keeps it in the free block list
+ * or index of the heap.
+ *
+ * @param[in, out] heap The heap to operate upon.
+ * @param[in, out] block The free block.
+ * @param size The new block size.
+ */
+RTEMS_INLINE_ROUTINE void _Heap_Free_block_set_size(
+  Heap_Control *heap,
+  Heap_Block *block,
+  uintptr_t size
+)
+{
+  if ( _Heap_Is_TLSF( heap ) ) {
+    _Heap_TLSF_Remove( heap->tlsf, block );
+    block->size_and_flag = size | HEAP_PREV_BLOCK_USED;
+    _Heap_TLSF_Insert( heap->tlsf, block );
+  } else {
+    block->size_and_flag = size | HEAP_PREV_BLOCK_USED;
+  }
+}
+
+/**
+ * @brief Returns the first free block to examine for an allocation.
+ *
+ * @param heap The heap to operate upon.
+ * @param size The minimum block size of the allocation.  This parameter is
+ *   ignored for the free list.
+ *
+ * @return The first free block or _Heap_Free_block_end().
+ */
+RTEMS_INLINE_ROUTINE Heap_Block *_Heap_Free_block_first(
+  Heap_Control *heap,
+  uintptr_t size
+)
+{
+  if ( _Heap_Is_TLSF( heap ) ) {
+    return _Heap_TLSF_Search( heap->tlsf, size );
+  }
+
+  return _Heap_Free_list_first( heap );
+}
+
+/**
+ * @brief Returns the end marker of the free blocks of the heap.
+ *
+ * @param heap The heap to operate upon.
+ *
+ * @return The free list tail or NULL for a TLSF index.
+ */
+RTEMS_INLINE_ROUTINE Heap_Block *_Heap_Free_block_end( Heap_Control *heap )
+{
+  if ( _Heap_Is_TLSF( heap ) ) {
+    return NULL;
+  }
+
+  return _Heap_Free_list_tail( heap );
+}
+
+/**
+ * @brief Returns the next free block to examine.
+ *
+ * For a TLSF index, the blocks are visited in increasing size classes.
+ *
+ * @param heap The heap to operate upon.
+ * @param block The current free block.
+ *
+ * @return The next free block or _Heap_Free_block_end().
+ */
+RTEMS_INLINE_ROUTINE Heap_Block *_Heap_Free_block_next(
+  Heap_Control *heap,
+  const Heap_Block *block
+)
+{
+  if ( _Heap_Is_TLSF( heap ) ) {
+    return _Heap_TLSF_Next( heap->tlsf, block );
+  }
+
+  return block->next;
+}
+
 /**
  * @brief Checks if the value is aligned to the given alignment.
  *
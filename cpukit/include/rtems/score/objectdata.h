@@ -186,6 +186,42 @@ typedef void ( *Objects_Thread_queue_Extract_callout )(
 
 typedef struct Objects_Information Objects_Information;
 
+/**
+ * @brief The object name index.
+ *
+ * The name index is an open addressing hash table with linear probing.  It
+ * contains the local objects of an object API class which have a non-zero
+ * 32-bit integer name or a non-NULL string name.  The table has at least two
+ * entries per object, so that it is at most half full.
+ *
+ * @see _Objects_Name_index_initialize().
+ */
+typedef struct {
+  /**
+   * @brief This is the count of table entries minus one.
+   *
+   * The count of table entries is a power of two.
+   */
+  uint32_t mask;
+
+  /**
+   * @brief This member is true, if the table contains all named objects.
+   *
+   * It is false after a failed grow of an index which has not enough entries
+   * for the current maximum index.  The lookups use the linear search then
+   * and the next extend of the object information tries to grow the index
+   * again.
+   */
+  bool complete;
+
+  /**
+   * @brief This is the table of objects.
+   *
+   * Unused entries are NULL.
+   */
+  Objects_Control *table[ RTEMS_ZERO_LENGTH_ARRAY ];
+} Objects_Name_index;
+
 /**
  * @brief The information structure used to manage each API class of objects.
  *
@@ -303,6 +339,19 @@ struct Objects_Information {
    */
   Objects_Control *initial_objects;
 
+  /**
+   * @brief This points to the optional name index.
+   *
+   * This member is statically initialized to NULL.  In case the name index is
+   * enabled for this API class, then _Objects_Name_to_id_u32() and
+   * _Objects_Get_by_name() use the index instead of a linear search through
+   * the local table.  The index is only modified while the allocator lock is
+   * owned.  The modifications and the lookups by 32-bit integer name are
+   * protected by an ISR lock, so that these lookups do not need the allocator
+   * lock.
+   */
+  Objects_Name_index *name_index;
+
 #if defined(RTEMS_MULTIPROCESSING)
   /**
    * @brief This method is used by _Thread_MP_Extract_proxy().
@@ -424,6 +473,7 @@ Objects_Information name##_Information = { \
   CHAIN_INITIALIZER_EMPTY( name##_Information.Inactive ), \
   NULL, \
   NULL, \
+  NULL, \
   NULL \
   OBJECTS_INFORMATION_MP( name##_Information, NULL ) \
 }
@@ -464,7 +514,8 @@ Objects_Information name##_Information = { \
   CHAIN_INITIALIZER_EMPTY( name##_Information.Inactive ), \
   NULL, \
   NULL, \
-  &name##_Objects[ 0 ].Object \
+  &name##_Objects[ 0 ].Object, \
+  NULL \
   OBJECTS_INFORMATION_MP( name##_Information, ex ) \
 }
 
@@ -261,6 +261,97 @@ Objects_Control *_Objects_Get_by_name(
   Objects_Get_by_name_error *error
 );
 
+/**
+ * @brief Creates the name index of the object information or grows it to the
+ *   current maximum index.
+ *
+ * The index is allocated from the workspace.  It contains the named objects of
+ * the local table.  Thread object classes must not use a name index.
+ *
+ * @param[in, out] information The object information.
+ *
+ * @retval true The operation was successful.
+ * @retval false There was not enough memory available for the index.  The
+ *   old index is kept.  If it has not enough entries for the current maximum
+ *   index, then it is not complete until the next successful call.
+ */
+bool _Objects_Name_index_create( Objects_Information *information );
+
+/**
+ * @brief Creates the name indices of all object classes with local objects
+ *   except the thread classes.
+ *
+ * This is the system initialization handler of the
+ * CONFIGURE_OBJECTS_NAME_INDEX configuration option.
+ */
+void _Objects_Name_index_initialize( void );
+
+/**
+ * @brief Inserts the object into the name index, if it has a name.
+ *
+ * @param information The object information.  It shall have a name index.
+ * @param the_object The object to insert.
+ */
+void _Objects_Name_index_insert(
+  const Objects_Information *information,
+  Objects_Control           *the_object
+);
+
+/**
+ * @brief Removes the object from the name index, if it has a name.
+ *
+ * This function shall be called before the object name changes.
+ *
+ * @param information The object information.  It shall have a name index.
+ * @param the_object The object to remove.
+ */
+void _Objects_Name_index_remove(
+  const Objects_Information *information,
+  Objects_Control           *the_object
+);
+
+/**
+ * @brief Finds the object with the 32-bit integer name in the name index.
+ *
+ * This function may be called from any context.  It does not use the
+ * allocator lock.
+ *
+ * @param information The object information.  It shall have a name index.
+ * @param name The object name.  It shall not be zero.
+ * @param[out] the_object The object with this name and the lowest object
+ *   index, or NULL if no object with this name is in the index.
+ *
+ * @retval true The index is complete and @a the_object is the lookup result.
+ * @retval false The index is not complete, a linear search is required.
+ */
+bool _Objects_Name_index_find_u32(
+  const Objects_Information  *information,
+  uint32_t                    name,
+  Objects_Control           **the_object
+);
+
+/**
+ * @brief Finds the object with the string name in the name index.
+ *
+ * The allocator lock shall be owned.
+ *
+ * @param information The object information.  It shall have a name index.
+ * @param name The object name.
+ * @param name_length The length of the object name.  It shall be less than or
+ *   equal to the maximum name length of the object information.
+ * @param[out] the_object The object with this name and the lowest object
+ *   index, or NULL if no object with this name is in the index.
+ *
+ * @retval true The index is complete and @a the_object is the lookup result.
+ * @retval false The index is not complete, a linear search is required.
+ */
+bool _Objects_Name_index_find_string(
+  const Objects_Information  *information,
+  const char                 *name,
+  size_t                      name_length,
+  Objects_Control           **the_object
+);
+
 /**
  * @brief Returns the name associated with object id.
  *
@@ -477,6 +568,11 @@ RTEMS_INLINE_ROUTINE void _Objects_Namespace_remove_u32(
 )
 {
   _Assert( !_Objects_Has_string_name( information ) );
+
+  if ( information->name_index != NULL ) {
+    _Objects_Name_index_remove( information, the_object );
+  }
+
   the_object->name.name_u32 = 0;
 }
 
@@ -756,6 +852,10 @@ RTEMS_INLINE_ROUTINE Objects_Id _Objects_Open_u32(
     the_object
   );
 
+  if ( information->name_index != NULL ) {
+    _Objects_Name_index_insert( information, the_object );
+  }
+
   return the_object->id;
 }
 
@@ -786,6 +886,10 @@ RTEMS_INLINE_ROUTINE void _Objects_Open_string(
     _Objects_Get_index( the_object->id ),
     the_object
   );
+
+  if ( information->name_index != NULL ) {
+    _Objects_Name_index_insert( information, the_object );
+  }
 }
 
 /**
@@ -174,6 +174,114 @@ void _Stack_Allocator_do_initialize( void );
 extern const Stack_Allocator_allocate_for_idle
   _Stack_Allocator_allocate_for_idle;
 
+/**
+ * @brief The size of the header in front of each stack area allocated
+ *   through the thread stack cache.
+ *
+ * The header contains the stack size, so that a freed stack area can be
+ * cached in its size class.
+ */
+#define STACK_CACHE_HEADER_SIZE CPU_HEAP_ALIGNMENT
+
+/**
+ * @brief A size class of the thread stack cache.
+ */
+typedef struct {
+  /**
+   * @brief The stack size of the class, zero if the class is unused.
+   */
+  size_t size;
+
+  /**
+   * @brief The LIFO of the cached stack areas.
+   *
+   * The first word of a cached stack area points to the next cached stack
+   * area.
+   */
+  void *free;
+
+  /**
+   * @brief The count of cached stack areas.
+   */
+  uint32_t count;
+} Stack_Cache_class;
+
+/**
+ * @brief The handlers of a thread stack cache.
+ *
+ * The handlers are called by _Stack_Allocate() and _Stack_Free() with the
+ * allocator lock owned.
+ */
+typedef struct {
+  /**
+   * @brief Allocates a stack area of the size.
+   */
+  void *( *allocate )( size_t stack_size );
+
+  /**
+   * @brief Frees the stack area to the cache or the stack allocator.
+   */
+  void ( *free )( void *stack_area );
+
+  /**
+   * @brief Frees all cached stack areas to the stack allocator.
+   */
+  void ( *flush )( void );
+} Stack_Cache_handlers;
+
+/**
+ * @brief This constant provides the thread stack cache.
+ *
+ * This constant is defined by the application configuration option
+ * #CONFIGURE_TASK_STACK_CACHE_CLASSES via <rtems/confdefs.h> or a default
+ * configuration.  It is &_Stack_Cache_size_class_handlers or NULL.
+ */
+extern const Stack_Cache_handlers * const _Stack_Cache;
+
+/**
+ * @brief The size class thread stack cache.
+ *
+ * A freed stack area is cached in the class of its stack size, so that the
+ * next allocation of this size pops it from the class.  A class is bound to
+ * the stack size of the first stack area freed to it and is rebound, if it is
+ * empty and a stack area of a size without a class is freed.  If the class is
+ * full, the stack area is freed to the stack allocator.  If the stack
+ * allocator cannot allocate a stack area, the cache is flushed and the
+ * allocation is retried.
+ */
+extern const Stack_Cache_handlers _Stack_Cache_size_class_handlers;
+
+/**
+ * @brief The size classes of the thread stack cache.
+ *
+ * Application provided via <rtems/confdefs.h>.
+ */
+extern Stack_Cache_class _Stack_Cache_classes[];
+
+/**
+ * @brief The count of size classes of the thread stack cache.
+ *
+ * Application provided via <rtems/confdefs.h>.
+ */
+extern const size_t _Stack_Cache_class_count;
+
+/**
+ * @brief The maximum count of cached stack areas in a size class.
+ *
+ * Application provided via <rtems/confdefs.h>.
+ */
+extern const uint32_t _Stack_Cache_maximum_per_class;
+
+/**
+ * @brief Frees all stack areas held by the thread stack cache to the stack
+ *   allocator.
+ *
+ * The resource snapshot and the test framework heap check call this function,
+ * so that they see the cached stack areas as free.  This function does
+ * nothing, if no thread stack cache is configured.
+ */
+void _Stack_Cache_flush( void );
+
 #ifdef __cplusplus
 }
 #endif
@@ -197,6 +197,9 @@ RTEMS_INLINE_ROUTINE size_t _Stack_Extend_size(
 /**
  * @brief Allocate the requested stack space.
  *
+ * If a thread stack cache is configured, then the stack area is allocated
+ * through the cache.  The allocator lock shall be owned by the caller.
+ *
  * @param stack_size The stack space that is requested.
  *
  * @retval stack_area The allocated stack area.
@@ -207,7 +210,9 @@ void *_Stack_Allocate( size_t stack_size );
 /**
  * @brief Free the stack area allocated by _Stack_Allocate().
  *
- * Do nothing if the stack area is NULL.
+ * Do nothing if the stack area is NULL.  If a thread stack cache is
+ * configured, then the stack area may be kept by the cache.  The allocator
+ * lock shall be owned by the caller.
  *
  * @param stack_area The stack area to free, or NULL.
  */
@@ -1129,6 +1129,7 @@ Thread_Information name##_Information = { \
     CHAIN_INITIALIZER_EMPTY( name##_Information.Objects.Inactive ), \
     NULL, \
     NULL, \
+    NULL, \
     NULL \
     OBJECTS_INFORMATION_MP( name##_Information.Objects, NULL ), \
   }, { \
@@ -1166,7 +1167,8 @@ Thread_Information name##_Information = { \
     CHAIN_INITIALIZER_EMPTY( name##_Information.Objects.Inactive ), \
     NULL, \
     NULL, \
-    &name##_Objects[ 0 ].Control.Object \
+    &name##_Objects[ 0 ].Control.Object, \
+    NULL \
     OBJECTS_INFORMATION_MP( name##_Information.Objects, NULL ) \
   }, { \
     &name##_Heads[ 0 ] \
@@ -195,6 +195,22 @@ void _Timecounter_Getboottimebin( struct bintime *bt );
  */
 void _Timecounter_Install( struct timecounter *tc );
 
+/**
+ * @brief Changes the frequency of the timecounter.
+ *
+ * Use this function if the clock of the timecounter hardware changes at run
+ * time.  The time elapsed since the last timecounter update is accounted with
+ * the previous frequency.  So, call this function right after the clock
+ * change with interrupts disabled to minimize the time error.
+ *
+ * @param tc The timecounter.
+ * @param frequency The new frequency in Hz.
+ */
+void _Timecounter_Set_frequency(
+  struct timecounter *tc,
+  uint64_t            frequency
+);
+
 /**
  * @brief Performs a timecounter tick.
  */
@@ -8,7 +8,8 @@
  * @brief This header file provides data structures used by the implementation
  *   and the @ref RTEMSImplApplConfig to define
  *   ::_User_extensions_Initial_count, ::_User_extensions_Initial_extensions,
- *   and ::_User_extensions_Initial_switch_controls.
+ *   ::_User_extensions_Initial_switch_controls, and
+ *   ::_User_extensions_Initial_dispatch.
  */
 
 /*
@@ -63,16 +64,37 @@ typedef struct {
   User_extensions_thread_switch_extension thread_switch;
 }   User_extensions_Switch_control;
 
+/**
+ * @brief The user extension hooks called through a dispatch list.
+ *
+ * The thread switch hooks use the switch controls.  The fatal hooks are
+ * called through a walk of all extensions since they may be called before the
+ * dispatch lists are initialized.
+ */
+typedef enum {
+  USER_EXTENSIONS_THREAD_CREATE,
+  USER_EXTENSIONS_THREAD_START,
+  USER_EXTENSIONS_THREAD_RESTART,
+  USER_EXTENSIONS_THREAD_DELETE,
+  USER_EXTENSIONS_THREAD_BEGIN,
+  USER_EXTENSIONS_THREAD_EXITTED,
+  USER_EXTENSIONS_THREAD_TERMINATE,
+  USER_EXTENSIONS_HOOK_COUNT
+} User_extensions_Hook;
+
 /**
  * @brief Manages each user extension set.
  *
  * The switch control is part of the extensions control even if not used due to
- * the extension not having a switch handler.
+ * the extension not having a switch handler.  The same applies to the hook
+ * nodes, which are only on the dispatch list of a hook if the extension has a
+ * handler for it.
  */
 typedef struct {
   Chain_Node                     Node;
   User_extensions_Switch_control Switch;
   User_extensions_Table          Callouts;
+  Chain_Node                     Hooks[ USER_EXTENSIONS_HOOK_COUNT ];
 }   User_extensions_Control;
 
 /**
@@ -97,6 +119,17 @@ extern const User_extensions_Table _User_extensions_Initial_extensions[];
 extern User_extensions_Switch_control
   _User_extensions_Initial_switch_controls[];
 
+/**
+ * @brief The dispatch lists of the initial user extensions.
+ *
+ * For each hook, there are ::_User_extensions_Initial_count entries starting
+ * at the hook index times ::_User_extensions_Initial_count.  The entries are
+ * set by _User_extensions_Handler_initialization().
+ *
+ * Application provided via <rtems/confdefs.h>.
+ */
+extern const User_extensions_Table *_User_extensions_Initial_dispatch[];
+
 /** @} */
 
 #ifdef __cplusplus
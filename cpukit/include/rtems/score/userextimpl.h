@@ -79,10 +79,18 @@ typedef struct {
    */
   Chain_Iterator_registry Iterators;
 
+  /**
+   * @brief Active dynamically added user extensions with a handler for the
+   * hook, for each hook.
+   *
+   * The chains use the User_extensions_Control::Hooks nodes.
+   */
+  Chain_Control Hooks[ USER_EXTENSIONS_HOOK_COUNT ];
+
 #if defined(RTEMS_SMP)
   /**
-   * @brief Lock to protect User_extensions_List::Active and
-   * User_extensions_List::Iterators.
+   * @brief Lock to protect User_extensions_List::Active,
+   * User_extensions_List::Iterators, and User_extensions_List::Hooks.
    */
   ISR_lock_Control Lock;
 #endif
@@ -98,6 +106,16 @@ extern User_extensions_List _User_extensions_List;
  */
 extern Chain_Control _User_extensions_Switches_list;
 
+/**
+ * @brief The count of initial user extensions with a handler for the hook,
+ * for each hook.
+ *
+ * @see ::_User_extensions_Initial_dispatch.
+ */
+extern size_t _User_extensions_Initial_dispatch_counts[
+  USER_EXTENSIONS_HOOK_COUNT
+];
+
 /**
  * @name Extension Maintainance
  *
@@ -109,6 +127,40 @@ extern Chain_Control _User_extensions_Switches_list;
  */
 void _User_extensions_Handler_initialization( void );
 
+/**
+ * @brief Checks if the user extension table has a handler for the hook.
+ *
+ * @param callouts The user extension table to check.
+ * @param hook The hook to check.
+ *
+ * @retval true The table has a handler for the hook.
+ * @retval false Otherwise.
+ */
+static inline bool _User_extensions_Has_hook(
+  const User_extensions_Table *callouts,
+  User_extensions_Hook         hook
+)
+{
+  switch ( hook ) {
+    case USER_EXTENSIONS_THREAD_CREATE:
+      return callouts->thread_create != NULL;
+    case USER_EXTENSIONS_THREAD_START:
+      return callouts->thread_start != NULL;
+    case USER_EXTENSIONS_THREAD_RESTART:
+      return callouts->thread_restart != NULL;
+    case USER_EXTENSIONS_THREAD_DELETE:
+      return callouts->thread_delete != NULL;
+    case USER_EXTENSIONS_THREAD_BEGIN:
+      return callouts->thread_begin != NULL;
+    case USER_EXTENSIONS_THREAD_EXITTED:
+      return callouts->thread_exitted != NULL;
+    case USER_EXTENSIONS_THREAD_TERMINATE:
+      return callouts->thread_terminate != NULL;
+    default:
+      return false;
+  }
+}
+
 /**
  * @brief Adds a user extension.
  *
@@ -295,6 +347,25 @@ void _User_extensions_Iterate(
   Chain_Iterator_direction  direction
 );
 
+/**
+ * @brief Calls the visitor for each user extension with a handler for the
+ *   hook.
+ *
+ * In contrast to _User_extensions_Iterate(), only the dispatch lists of the
+ * hook are visited.  The order of the calls is the same.
+ *
+ * @param[in, out] arg The argument passed to the visitor.
+ * @param visitor The visitor for each extension.
+ * @param hook The hook of the visitor.
+ * @param direction The iteration direction for dynamic extensions.
+ */
+void _User_extensions_Dispatch(
+  void                     *arg,
+  User_extensions_Visitor   visitor,
+  User_extensions_Hook      hook,
+  Chain_Iterator_direction  direction
+);
+
 /** @} */
 
 /**
@@ -314,9 +385,10 @@ static inline bool _User_extensions_Thread_create( Thread_Control *created )
 {
   User_extensions_Thread_create_context ctx = { created, true };
 
-  _User_extensions_Iterate(
+  _User_extensions_Dispatch(
     &ctx,
     _User_extensions_Thread_create_visitor,
+    USER_EXTENSIONS_THREAD_CREATE,
     CHAIN_ITERATOR_FORWARD
   );
 
@@ -330,9 +402,10 @@ static inline bool _User_extensions_Thread_create( Thread_Control *created )
  */
 static inline void _User_extensions_Thread_delete( Thread_Control *deleted )
 {
-  _User_extensions_Iterate(
+  _User_extensions_Dispatch(
     deleted,
     _User_extensions_Thread_delete_visitor,
+    USER_EXTENSIONS_THREAD_DELETE,
     CHAIN_ITERATOR_BACKWARD
   );
 }
@@ -344,9 +417,10 @@ static inline void _User_extensions_Thread_delete( Thread_Control *deleted )
  */
 static inline void _User_extensions_Thread_start( Thread_Control *started )
 {
-  _User_extensions_Iterate(
+  _User_extensions_Dispatch(
     started,
     _User_extensions_Thread_start_visitor,
+    USER_EXTENSIONS_THREAD_START,
     CHAIN_ITERATOR_FORWARD
   );
 }
@@ -358,9 +432,10 @@ static inline void _User_extensions_Thread_start( Thread_Control *started )
  */
 static inline void _User_extensions_Thread_restart( Thread_Control *restarted )
 {
-  _User_extensions_Iterate(
+  _User_extensions_Dispatch(
     restarted,
     _User_extensions_Thread_restart_visitor,
+    USER_EXTENSIONS_THREAD_RESTART,
     CHAIN_ITERATOR_FORWARD
   );
 }
@@ -372,9 +447,10 @@ static inline void _User_extensions_Thread_restart( Thread_Control *restarted )
  */
 static inline void _User_extensions_Thread_begin( Thread_Control *executing )
 {
-  _User_extensions_Iterate(
+  _User_extensions_Dispatch(
     executing,
     _User_extensions_Thread_begin_visitor,
+    USER_EXTENSIONS_THREAD_BEGIN,
     CHAIN_ITERATOR_FORWARD
   );
 }
@@ -444,9 +520,10 @@ static inline void _User_extensions_Thread_switch(
  */
 static inline void _User_extensions_Thread_exitted( Thread_Control *executing )
 {
-  _User_extensions_Iterate(
+  _User_extensions_Dispatch(
     executing,
     _User_extensions_Thread_exitted_visitor,
+    USER_EXTENSIONS_THREAD_EXITTED,
     CHAIN_ITERATOR_FORWARD
   );
 }
@@ -480,9 +557,10 @@ static inline void _User_extensions_Thread_terminate(
   Thread_Control *executing
 )
 {
-  _User_extensions_Iterate(
+  _User_extensions_Dispatch(
     executing,
     _User_extensions_Thread_terminate_visitor,
+    USER_EXTENSIONS_THREAD_TERMINATE,
     CHAIN_ITERATOR_BACKWARD
   );
 }
@@ -84,6 +84,64 @@ typedef void Watchdog_Service_routine;
 typedef Watchdog_Service_routine
   ( *Watchdog_Service_routine_entry )( Watchdog_Control * );
 
+/**
+ * @brief The count of bits of the expiration time used to select the slot of
+ * a timing wheel level.
+ */
+#define WATCHDOG_WHEEL_SLOT_BITS 6
+
+/**
+ * @brief The count of slots of a timing wheel level.
+ */
+#define WATCHDOG_WHEEL_SLOT_COUNT ( 1U << WATCHDOG_WHEEL_SLOT_BITS )
+
+/**
+ * @brief The count of timing wheel levels.
+ *
+ * The timing wheel covers watchdogs which expire in less than
+ * 2**( WATCHDOG_WHEEL_SLOT_BITS * WATCHDOG_WHEEL_LEVEL_COUNT ) ticks.  More
+ * distant watchdogs wait in the last level and are placed again after each
+ * revolution of the last level.
+ */
+#define WATCHDOG_WHEEL_LEVEL_COUNT 6
+
+/**
+ * @brief The hierarchical timing wheel of a watchdog header.
+ *
+ * A watchdog which expires in less than WATCHDOG_WHEEL_SLOT_COUNT ticks is
+ * placed in the slot of the first level selected by the lowest bits of the
+ * expiration time.  More distant watchdogs are placed in the slot of a higher
+ * level.  The slots of the higher levels are moved to the lower levels
+ * (cascaded) once the time reaches the start of the slot.
+ */
+typedef struct Watchdog_Wheel {
+  /**
+   * @brief The time of the last processed tick.
+   */
+  uint64_t ticks;
+
+  /**
+   * @brief Watchdogs inserted with an expiration time less than or equal to
+   * the time of the last processed tick.
+   *
+   * The chain is sorted by expiration time.
+   */
+  Chain_Control Expired;
+
+  /**
+   * @brief For each level a bit field of slots which may contain watchdogs.
+   *
+   * A set bit of an empty slot is cleared on demand.
+   */
+  uint64_t occupied[ WATCHDOG_WHEEL_LEVEL_COUNT ];
+
+  /**
+   * @brief The slots of the levels.
+   */
+  Chain_Control
+    Slots[ WATCHDOG_WHEEL_LEVEL_COUNT ][ WATCHDOG_WHEEL_SLOT_COUNT ];
+} Watchdog_Wheel;
+
 /**
  * @brief The watchdog header to manage scheduled watchdogs.
  */
@@ -98,6 +156,17 @@ typedef struct {
    * case no watchdog is scheduled.
    */
   RBTree_Node *first;
+
+  /**
+   * @brief The timing wheel of the scheduled watchdogs or NULL in case the
+   * red-black tree is used.
+   *
+   * If the timing wheel is used, then the red-black tree is empty and the
+   * first watchdog is NULL.  The timing wheel requires that the time advances
+   * by one for each tickle, so it is only used for the clock tick based
+   * watchdog headers, see _Watchdog_Wheel_tickle().
+   */
+  Watchdog_Wheel *wheel;
 } Watchdog_Header;
 
 /**
@@ -120,6 +120,7 @@ RTEMS_INLINE_ROUTINE void _Watchdog_Header_initialize(
 {
   _RBTree_Initialize_empty( &header->Watchdogs );
   header->first = NULL;
+  header->wheel = NULL;
 }
 
 /**
@@ -318,6 +319,127 @@ void _Watchdog_Remove(
   Watchdog_Control *the_watchdog
 );
 
+/**
+ * @brief The timing wheels of the processors.
+ *
+ * This array is defined by the application configuration if the
+ * CONFIGURE_WATCHDOG_TIMING_WHEEL configuration option is defined.
+ */
+extern Watchdog_Wheel _Watchdog_Wheels[];
+
+/**
+ * @brief Uses the timing wheels of _Watchdog_Wheels for the clock tick based
+ * watchdog headers of the configured processors.
+ *
+ * This is a system initialization handler, the watchdog headers must be
+ * empty.
+ */
+void _Watchdog_Wheel_initialize_per_CPU( void );
+
+/**
+ * @brief Initializes the timing wheel.
+ *
+ * @param[out] wheel The timing wheel to initialize.
+ * @param now The time of the last processed tick.
+ */
+void _Watchdog_Wheel_initialize( Watchdog_Wheel *wheel, uint64_t now );
+
+/**
+ * @brief Inserts the watchdog into the timing wheel according to the
+ * specified expiration time.
+ *
+ * The watchdog must be inactive.
+ *
+ * @param[in, out] wheel The timing wheel to insert into.
+ * @param[in, out] the_watchdog The watchdog to insert.
+ * @param expire The expiration time for the watchdog.
+ */
+void _Watchdog_Wheel_insert(
+  Watchdog_Wheel   *wheel,
+  Watchdog_Control *the_watchdog,
+  uint64_t          expire
+);
+
+/**
+ * @brief Advances the timing wheel to the specified time and calls the
+ * routine of each expired watchdog.
+ *
+ * The time must be the time of the last processed tick plus one.  The
+ * watchdogs expire in the same order as in the red-black tree of a watchdog
+ * header, see _Watchdog_Tickle().
+ *
+ * @param wheel The timing wheel.
+ * @param now The current time.
+ * @param lock The lock that is released before calling the routine and then
+ *      acquired after the call.
+ * @param lock_context The lock context for the release before calling the
+ *      routine and for the acquire after.
+ */
+void _Watchdog_Wheel_do_tickle(
+  Watchdog_Wheel   *wheel,
+  uint64_t          now,
+#if defined(RTEMS_SMP)
+  ISR_lock_Control *lock,
+#endif
+  ISR_lock_Context *lock_context
+);
+
+#if defined(RTEMS_SMP)
+  #define _Watchdog_Wheel_tickle( wheel, now, lock, lock_context ) \
+    _Watchdog_Wheel_do_tickle( wheel, now, lock, lock_context )
+#else
+  #define _Watchdog_Wheel_tickle( wheel, now, lock, lock_context ) \
+    _Watchdog_Wheel_do_tickle( wheel, now, lock_context )
+#endif
+
+/**
+ * @brief Gets a lower bound of the earliest expiration time of the watchdogs
+ * in the timing wheel.
+ *
+ * The lower bound may be the time of a cascade of a higher level.
+ *
+ * @param[in, out] wheel The timing wheel.
+ * @param[out] expire The lower bound of the earliest expiration time.
+ *
+ * @retval true The timing wheel contains a watchdog.
+ * @retval false The timing wheel is empty.
+ */
+bool _Watchdog_Wheel_next_expire( Watchdog_Wheel *wheel, uint64_t *expire );
+
+/**
+ * @brief Gets a lower bound of the earliest expiration time of the scheduled
+ * watchdogs of the watchdog header.
+ *
+ * In case the red-black tree is used, this is the expiration time of the
+ * first watchdog.
+ *
+ * @param[in, out] header The watchdog header.
+ * @param[out] expire The lower bound of the earliest expiration time.
+ *
+ * @retval true A watchdog is scheduled.
+ * @retval false No watchdog is scheduled.
+ */
+RTEMS_INLINE_ROUTINE bool _Watchdog_Header_next_expire(
+  Watchdog_Header *header,
+  uint64_t        *expire
+)
+{
+  const Watchdog_Control *first;
+
+  if ( header->wheel != NULL ) {
+    return _Watchdog_Wheel_next_expire( header->wheel, expire );
+  }
+
+  first = _Watchdog_Header_first( header );
+
+  if ( first == NULL ) {
+    return false;
+  }
+
+  *expire = first->expire;
+  return true;
+}
+
 /**
  * @brief In the case the watchdog is scheduled, then it is removed from the set of
  * scheduled watchdogs.
@@ -602,6 +724,133 @@ RTEMS_INLINE_ROUTINE uint64_t _Watchdog_Ticks_from_sbintime( int64_t sbt )
   return ticks;
 }
 
+/**
+ * @brief The one-shot comparator of the high resolution watchdogs.
+ *
+ * The watchdogs of the per-processor realtime and monotonic watchdog headers
+ * use nanoseconds expiration times.  Without a comparator they are processed
+ * by the clock tick.  If a comparator is installed, then they are processed
+ * also by the comparator interrupt at the expiration time of the first
+ * watchdog.  The clock tick based watchdogs are not affected.
+ *
+ * @see _Watchdog_Comparator_install().
+ */
+typedef struct Watchdog_Comparator {
+  /**
+   * @brief Sets the comparator of the current processor, so that an interrupt
+   * is generated once the nanoseconds elapsed.
+   *
+   * The comparator interrupt shall call _Watchdog_Comparator_expire().  The
+   * handler is called with the watchdog lock acquired and interrupts
+   * disabled.  An earlier interrupt is harmless, however, it leads to another
+   * comparator set.
+   */
+  void ( *set )(
+    struct Watchdog_Comparator *comparator,
+    uint64_t                    nanoseconds
+  );
+} Watchdog_Comparator;
+
+/**
+ * @brief The installed comparator or NULL.
+ */
+extern Watchdog_Comparator *_Watchdog_Comparator;
+
+/**
+ * @brief Installs the one-shot comparator of the high resolution watchdogs.
+ *
+ * This function shall be called by the BSP during system initialization
+ * before the multitasking start.
+ *
+ * @param comparator The comparator to install.
+ */
+void _Watchdog_Comparator_install( Watchdog_Comparator *comparator );
+
+/**
+ * @brief Sets the comparator to the earliest expiration time of the
+ * realtime and monotonic watchdog headers of the processor.
+ *
+ * In SMP configurations, the comparator is only set for the current
+ * processor.  The watchdogs of other processors are processed by their next
+ * clock tick or comparator interrupt.
+ *
+ * @param cpu The processor.  The caller shall own the watchdog lock of the
+ *   processor.
+ */
+void _Watchdog_Comparator_update( Per_CPU_Control *cpu );
+
+/**
+ * @brief Processes the expired realtime and monotonic watchdogs of the
+ * processor and sets the comparator for the next expiration.
+ *
+ * This function shall be called by the comparator interrupt handler.
+ *
+ * @param cpu The processor of the comparator.
+ */
+void _Watchdog_Comparator_expire( Per_CPU_Control *cpu );
+
+/**
+ * @brief Converts the expiration time of a realtime or monotonic watchdog to
+ * nanoseconds.
+ *
+ * @param expire The expiration time in the format of
+ *   _Watchdog_Ticks_from_timespec().
+ *
+ * @return The expiration time in nanoseconds.
+ */
+RTEMS_INLINE_ROUTINE uint64_t _Watchdog_Comparator_to_nanoseconds(
+  uint64_t expire
+)
+{
+  uint64_t mask;
+
+  mask = ( UINT64_C( 1 ) << WATCHDOG_BITS_FOR_1E9_NANOSECONDS ) - 1;
+
+  return ( expire >> WATCHDOG_BITS_FOR_1E9_NANOSECONDS )
+    * WATCHDOG_NANOSECONDS_PER_SECOND + ( expire & mask );
+}
+
+/**
+ * @brief Gets the nanoseconds until the first watchdog of the realtime or
+ * monotonic watchdog header expires.
+ *
+ * @param header The realtime or monotonic watchdog header.
+ * @param now The current time of the clock of the header.
+ * @param[out] remaining The nanoseconds until the expiration of the first
+ *   watchdog, zero if it is already expired.
+ *
+ * @retval true The header has a watchdog and @a remaining was set.
+ * @retval false The header is empty.
+ */
+RTEMS_INLINE_ROUTINE bool _Watchdog_Comparator_remaining(
+  const Watchdog_Header *header,
+  const struct timespec *now,
+  uint64_t              *remaining
+)
+{
+  const Watchdog_Control *first;
+  uint64_t                expire;
+  uint64_t                now_ns;
+
+  first = _Watchdog_Header_first( header );
+
+  if ( first == NULL ) {
+    return false;
+  }
+
+  expire = _Watchdog_Comparator_to_nanoseconds( first->expire );
+  now_ns = (uint64_t) now->tv_sec * WATCHDOG_NANOSECONDS_PER_SECOND
+    + (uint64_t) now->tv_nsec;
+
+  if ( expire > now_ns ) {
+    *remaining = expire - now_ns;
+  } else {
+    *remaining = 0;
+  }
+
+  return true;
+}
+
 /**
  * @brief Acquires the per cpu watchdog lock in a critical section.
  *
@@ -685,6 +934,15 @@ RTEMS_INLINE_ROUTINE uint64_t _Watchdog_Per_CPU_insert(
 
   _Watchdog_Per_CPU_acquire_critical( cpu, &lock_context );
   _Watchdog_Insert( header, the_watchdog, expire );
+
+  if (
+    _Watchdog_Comparator != NULL
+      && header->first == &the_watchdog->Node.RBTree
+      && header != &cpu->Watchdog.Header[ PER_CPU_WATCHDOG_TICKS ]
+  ) {
+    _Watchdog_Comparator_update( cpu );
+  }
+
   _Watchdog_Per_CPU_release_critical( cpu, &lock_context );
   return expire;
 }
@@ -39,6 +39,7 @@
 #define _RTEMS_SCORE_WKSPACEDATA_H
 
 #include <rtems/score/basedefs.h>
+#include <rtems/score/heap.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -76,6 +77,16 @@ extern const uintptr_t _Workspace_Size;
  */
 extern const bool _Workspace_Is_unified;
 
+/**
+ * @brief This constant provides the RTEMS Workspace heap initialization
+ *   handler.
+ *
+ * This constant is defined by the application configuration option
+ * #CONFIGURE_WORKSPACE_TLSF via <rtems/confdefs.h> or a default
+ * configuration.
+ */
+extern const Heap_Initialization_or_extend_handler _Workspace_Heap_initializer;
+
 /**
  * @brief Initializes the C Program Heap separated from the RTEMS Workspace.
  *
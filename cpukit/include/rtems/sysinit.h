@@ -157,6 +157,15 @@ typedef struct {
  */
 void _Sysinit_Verbose( void );
 
+/**
+ * @brief Handler called after each system initialization handler.
+ *
+ * If this handler is not NULL, then it is called with the item of the handler
+ * which returned.  A BSP may set it before the call to
+ * rtems_initialize_executive() to profile the system initialization.
+ */
+extern void ( *_Sysinit_Step_handler )( const rtems_sysinit_item *item );
+
 #ifdef __cplusplus
 }
 #endif /* __cplusplus */
@@ -93,6 +93,17 @@ RTEMS_INLINE_ROUTINE void rtems_timecounter_install(
   _Timecounter_Install( tc );
 }
 
+/**
+ * @copydoc _Timecounter_Set_frequency()
+ */
+RTEMS_INLINE_ROUTINE void rtems_timecounter_set_frequency(
+  struct timecounter *tc,
+  uint64_t            frequency
+)
+{
+  _Timecounter_Set_frequency( tc, frequency );
+}
+
 /**
  * @copydoc _Timecounter_Tick()
  */
@@ -100,6 +100,13 @@ void free(
       return;
   }
 
+  if (
+    _Malloc_Cache != NULL
+      && ( *_Malloc_Cache->free )( RTEMS_Malloc_Heap, ptr )
+  ) {
+    return;
+  }
+
   if ( !_Protected_heap_Free( RTEMS_Malloc_Heap, ptr ) ) {
     rtems_fatal( RTEMS_FATAL_SOURCE_INVALID_HEAP_FREE, (rtems_fatal_code) ptr );
   }
@@ -85,6 +85,14 @@ void *rtems_heap_allocate_aligned_with_boundary(
 
   switch ( _Malloc_System_state() ) {
     case MALLOC_SYSTEM_STATE_NORMAL:
+      if ( _Malloc_Cache != NULL && alignment == 0 && boundary == 0 ) {
+        p = ( *_Malloc_Cache->allocate )( heap, size );
+
+        if ( p != NULL ) {
+          break;
+        }
+      }
+
       _RTEMS_Lock_allocator();
       _Malloc_Process_deferred_frees();
       p = _Heap_Allocate_aligned_with_boundary(
@@ -94,6 +102,19 @@ void *rtems_heap_allocate_aligned_with_boundary(
         boundary
       );
       _RTEMS_Unlock_allocator();
+
+      if ( p == NULL && _Malloc_Cache != NULL ) {
+        /* Try again with the memory held by the cache */
+        ( *_Malloc_Cache->flush )( heap );
+        _RTEMS_Lock_allocator();
+        p = _Heap_Allocate_aligned_with_boundary(
+          heap,
+          size,
+          alignment,
+          boundary
+        );
+        _RTEMS_Unlock_allocator();
+      }
       break;
     case MALLOC_SYSTEM_STATE_NO_PROTECTION:
       p = _Heap_Allocate_aligned_with_boundary(
@@ -44,6 +44,7 @@
 
 bool malloc_walk(int source, bool printf_enabled)
 {
+  rtems_malloc_cache_flush();
   return _Protected_heap_Walk( RTEMS_Malloc_Heap, source, printf_enabled );
 }
 
@@ -0,0 +1,360 @@
+/*
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Copyright (C) 2026 Dave Rush
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#ifdef RTEMS_NEWLIB
+#include "malloc_p.h"
+
+#include <rtems/config.h>
+#include <rtems/sysinit.h>
+#include <rtems/score/apimutex.h>
+#include <rtems/score/assert.h>
+#include <rtems/score/heapimpl.h>
+#include <rtems/score/isrlock.h>
+#include <rtems/score/percpudata.h>
+
+/*
+ * The cache serves allocations up to the biggest size class.  A cached memory
+ * area is a used block of the heap, so the cache needs no memory of its own
+ * besides the per-processor list heads.  The lists of a processor are
+ * protected by an ISR lock, so that the fast paths do not use the allocator
+ * mutex.  The lists are refilled and drained in batches while the allocator
+ * mutex is owned.
+ */
+
+#define MALLOC_CACHE_CLASS_COUNT 8
+
+#define MALLOC_CACHE_BATCH 8
+
+#define MALLOC_CACHE_LIMIT ( 4 * MALLOC_CACHE_BATCH )
+
+typedef struct Malloc_Cache_object {
+  struct Malloc_Cache_object *next;
+} Malloc_Cache_object;
+
+typedef struct {
+  ISR_LOCK_MEMBER( Lock )
+  Malloc_Cache_object *objects[ MALLOC_CACHE_CLASS_COUNT ];
+  uint32_t count[ MALLOC_CACHE_CLASS_COUNT ];
+} Malloc_Cache_per_CPU;
+
+static const uint16_t _Malloc_Cache_class_sizes[ MALLOC_CACHE_CLASS_COUNT ] = {
+  16, 32, 48, 64, 96, 128, 192, 256
+};
+
+PER_CPU_DATA_NEED_INITIALIZATION();
+
+static PER_CPU_DATA_ITEM( Malloc_Cache_per_CPU, _Malloc_Cache_per_CPU );
+
+static void _Malloc_Cache_initialize( void )
+{
+  uint32_t cpu_max;
+  uint32_t cpu_index;
+
+  /*
+   * This runs before the SMP initialization, so use the configured processor
+   * maximum.  The per-processor data exists for all configured processors.
+   */
+  cpu_max = rtems_configuration_get_maximum_processors();
+
+  for ( cpu_index = 0; cpu_index < cpu_max; ++cpu_index ) {
+    Per_CPU_Control      *cpu;
+    Malloc_Cache_per_CPU *cache;
+
+    cpu = _Per_CPU_Get_by_index( cpu_index );
+    cache = PER_CPU_DATA_GET( cpu, Malloc_Cache_per_CPU, _Malloc_Cache_per_CPU );
+    _ISR_lock_Initialize( &cache->Lock, "Malloc Cache" );
+  }
+}
+
+RTEMS_SYSINIT_ITEM(
+  _Malloc_Cache_initialize,
+  RTEMS_SYSINIT_MALLOC,
+  RTEMS_SYSINIT_ORDER_FIRST
+);
+
+static Malloc_Cache_per_CPU *_Malloc_Cache_acquire(
+  ISR_lock_Context *lock_context
+)
+{
+  Per_CPU_Control      *cpu;
+  Malloc_Cache_per_CPU *cache;
+
+  _ISR_lock_ISR_disable( lock_context );
+  cpu = _Per_CPU_Get();
+  cache = PER_CPU_DATA_GET( cpu, Malloc_Cache_per_CPU, _Malloc_Cache_per_CPU );
+  _ISR_lock_Acquire( &cache->Lock, lock_context );
+
+  return cache;
+}
+
+static void _Malloc_Cache_release(
+  Malloc_Cache_per_CPU *cache,
+  ISR_lock_Context     *lock_context
+)
+{
+  _ISR_lock_Release_and_ISR_enable( &cache->Lock, lock_context );
+}
+
+static void _Malloc_Cache_push(
+  Malloc_Cache_per_CPU *cache,
+  size_t                index,
+  void                 *ptr
+)
+{
+  Malloc_Cache_object *object;
+
+  object = ptr;
+  object->next = cache->objects[ index ];
+  cache->objects[ index ] = object;
+  ++cache->count[ index ];
+}
+
+static void _Malloc_Cache_free_objects(
+  Heap_Control        *heap,
+  Malloc_Cache_object *object
+)
+{
+  while ( object != NULL ) {
+    Malloc_Cache_object *next;
+    bool                 ok;
+
+    next = object->next;
+    ok = _Heap_Free( heap, object );
+    _Assert( ok );
+    (void) ok;
+    object = next;
+  }
+}
+
+static void *_Malloc_Cache_allocate( Heap_Control *heap, size_t size )
+{
+  Malloc_Cache_per_CPU *cache;
+  ISR_lock_Context      lock_context;
+  Malloc_Cache_object  *object;
+  void                 *batch[ MALLOC_CACHE_BATCH ];
+  size_t                index;
+  size_t                n;
+  size_t                i;
+
+  for ( index = 0; index < MALLOC_CACHE_CLASS_COUNT; ++index ) {
+    if ( size <= _Malloc_Cache_class_sizes[ index ] ) {
+      break;
+    }
+  }
+
+  if ( index == MALLOC_CACHE_CLASS_COUNT ) {
+    return NULL;
+  }
+
+  cache = _Malloc_Cache_acquire( &lock_context );
+  object = cache->objects[ index ];
+
+  if ( object != NULL ) {
+    cache->objects[ index ] = object->next;
+    --cache->count[ index ];
+    _Malloc_Cache_release( cache, &lock_context );
+    return object;
+  }
+
+  _Malloc_Cache_release( cache, &lock_context );
+
+  _RTEMS_Lock_allocator();
+  _Malloc_Process_deferred_frees();
+
+  for ( n = 0; n < MALLOC_CACHE_BATCH; ++n ) {
+    batch[ n ] = _Heap_Allocate( heap, _Malloc_Cache_class_sizes[ index ] );
+
+    if ( batch[ n ] == NULL ) {
+      break;
+    }
+  }
+
+  _RTEMS_Unlock_allocator();
+
+  if ( n == 0 ) {
+    return NULL;
+  }
+
+  /* The thread may run on another processor now, this is harmless */
+  cache = _Malloc_Cache_acquire( &lock_context );
+
+  for ( i = 1; i < n; ++i ) {
+    _Malloc_Cache_push( cache, index, batch[ i ] );
+  }
+
+  _Malloc_Cache_release( cache, &lock_context );
+
+  return batch[ 0 ];
+}
+
+static bool _Malloc_Cache_get_class(
+  const Heap_Control *heap,
+  uintptr_t           alloc_begin,
+  size_t             *index
+)
+{
+  Heap_Block *block;
+  Heap_Block *next_block;
+  uintptr_t   block_size;
+  uintptr_t   usable_size;
+  size_t      i;
+
+  /*
+   * The size of a used block does not change while the block is owned by the
+   * caller, so it can be read without the allocator mutex.  Memory areas
+   * with an offset in the block due to an alignment constraint are left to
+   * the heap.
+   */
+  block = _Heap_Block_of_alloc_area( alloc_begin, heap->page_size );
+
+  if (
+    !_Heap_Is_block_in_heap( heap, block )
+      || _Heap_Alloc_area_of_block( block ) != alloc_begin
+  ) {
+    return false;
+  }
+
+  block_size = _Heap_Block_size( block );
+  next_block = _Heap_Block_at( block, block_size );
+
+  if (
+    !_Heap_Is_block_in_heap( heap, next_block )
+      || !_Heap_Is_prev_used( next_block )
+  ) {
+    return false;
+  }
+
+  usable_size = block_size - HEAP_BLOCK_HEADER_SIZE + HEAP_ALLOC_BONUS;
+  i = MALLOC_CACHE_CLASS_COUNT - 1;
+
+  if (
+    usable_size < _Malloc_Cache_class_sizes[ 0 ]
+      || usable_size > _Malloc_Cache_class_sizes[ i ]
+  ) {
+    return false;
+  }
+
+  while ( usable_size < _Malloc_Cache_class_sizes[ i ] ) {
+    --i;
+  }
+
+  *index = i;
+  return true;
+}
+
+static bool _Malloc_Cache_free( Heap_Control *heap, void *ptr )
+{
+  Malloc_Cache_per_CPU *cache;
+  ISR_lock_Context      lock_context;
+  Malloc_Cache_object  *drain;
+  Malloc_Cache_object  *last;
+  size_t                index;
+  size_t                i;
+
+  if ( !_Malloc_Cache_get_class( heap, (uintptr_t) ptr, &index ) ) {
+    return false;
+  }
+
+  cache = _Malloc_Cache_acquire( &lock_context );
+
+  if ( cache->count[ index ] < MALLOC_CACHE_LIMIT ) {
+    _Malloc_Cache_push( cache, index, ptr );
+    _Malloc_Cache_release( cache, &lock_context );
+    return true;
+  }
+
+  /* Return a batch of the list together with the memory area to the heap */
+  drain = cache->objects[ index ];
+  last = drain;
+
+  for ( i = 1; i < MALLOC_CACHE_BATCH; ++i ) {
+    last = last->next;
+  }
+
+  cache->objects[ index ] = last->next;
+  cache->count[ index ] -= MALLOC_CACHE_BATCH;
+  _Malloc_Cache_release( cache, &lock_context );
+
+  last->next = ptr;
+  last = ptr;
+  last->next = NULL;
+
+  _RTEMS_Lock_allocator();
+  _Malloc_Cache_free_objects( heap, drain );
+  _RTEMS_Unlock_allocator();
+
+  return true;
+}
+
+static void _Malloc_Cache_flush( Heap_Control *heap )
+{
+  uint32_t cpu_max;
+  uint32_t cpu_index;
+
+  /* The caches may be used before the SMP initialization */
+  cpu_max = rtems_configuration_get_maximum_processors();
+
+  for ( cpu_index = 0; cpu_index < cpu_max; ++cpu_index ) {
+    Per_CPU_Control      *cpu;
+    Malloc_Cache_per_CPU *cache;
+    ISR_lock_Context      lock_context;
+    Malloc_Cache_object  *objects[ MALLOC_CACHE_CLASS_COUNT ];
+    size_t                index;
+
+    cpu = _Per_CPU_Get_by_index( cpu_index );
+    cache = PER_CPU_DATA_GET( cpu, Malloc_Cache_per_CPU, _Malloc_Cache_per_CPU );
+
+    _ISR_lock_ISR_disable_and_acquire( &cache->Lock, &lock_context );
+
+    for ( index = 0; index < MALLOC_CACHE_CLASS_COUNT; ++index ) {
+      objects[ index ] = cache->objects[ index ];
+      cache->objects[ index ] = NULL;
+      cache->count[ index ] = 0;
+    }
+
+    _ISR_lock_Release_and_ISR_enable( &cache->Lock, &lock_context );
+
+    _RTEMS_Lock_allocator();
+
+    for ( index = 0; index < MALLOC_CACHE_CLASS_COUNT; ++index ) {
+      _Malloc_Cache_free_objects( heap, objects[ index ] );
+    }
+
+    _RTEMS_Unlock_allocator();
+  }
+}
+
+const Malloc_Cache_handlers _Malloc_Cache_per_CPU_handlers = {
+  .allocate = _Malloc_Cache_allocate,
+  .free = _Malloc_Cache_free,
+  .flush = _Malloc_Cache_flush
+};
+#endif
@@ -57,6 +57,7 @@ size_t malloc_free_space( void )
 {
   Heap_Information info;
 
+  rtems_malloc_cache_flush();
   _Protected_heap_Get_free_information( RTEMS_Malloc_Heap, &info );
   return (size_t) info.largest;
 }
@@ -47,6 +47,7 @@ int malloc_info(
   if ( !the_info )
     return -1;
 
+  rtems_malloc_cache_flush();
   _Protected_heap_Get_information( RTEMS_Malloc_Heap, the_info );
   return 0;
 }
@@ -45,5 +45,6 @@ void malloc_set_heap_pointer(
   Heap_Control *new_heap
 )
 {
+  rtems_malloc_cache_flush();
   RTEMS_Malloc_Heap = new_heap;
 }
@@ -117,9 +117,11 @@ void rtems_resource_snapshot_take(rtems_resource_snapshot *snapshot)
 
   memset(snapshot, 0, sizeof(*snapshot));
 
+  rtems_malloc_cache_flush();
   _RTEMS_Lock_allocator();
 
   _Thread_Kill_zombies();
+  _Stack_Cache_flush();
 
   get_heap_info(RTEMS_Malloc_Heap, &snapshot->heap_info);
   get_heap_info(&_Workspace_Area, &snapshot->workspace_info);
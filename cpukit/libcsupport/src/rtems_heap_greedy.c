@@ -48,6 +48,7 @@ void *rtems_heap_greedy_allocate(
   Heap_Control *heap = RTEMS_Malloc_Heap;
   void *opaque;
 
+  rtems_malloc_cache_flush();
   rtems_heap_sbrk_greedy_allocate( heap, SBRK_ALLOC_SIZE );
 
   _RTEMS_Lock_allocator();
@@ -64,6 +65,7 @@ void *rtems_heap_greedy_allocate_all_except_largest(
   Heap_Control *heap = RTEMS_Malloc_Heap;
   void *opaque;
 
+  rtems_malloc_cache_flush();
   rtems_heap_sbrk_greedy_allocate( heap, SBRK_ALLOC_SIZE );
 
   _RTEMS_Lock_allocator();
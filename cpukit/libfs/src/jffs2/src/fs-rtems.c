@@ -1267,7 +1267,18 @@ int rtems_jffs2_initialize(
 		c->inocache_list = &fs_info->inode_cache[0];
 		c->sector_size = fc->block_size;
 		c->flash_size = fc->flash_size;
-		c->cleanmarker_size = sizeof(struct jffs2_unknown_node);
+
+		/*
+		 * The clean markers are written to erased blocks while the nodes
+		 * are written to the next block.  A flash device which programs
+		 * a unit only once could not complete the last unit of a clean
+		 * marker, so do not use clean markers in this case.
+		 */
+		if (fc->write_size > 1) {
+			c->cleanmarker_size = 0;
+		} else {
+			c->cleanmarker_size = sizeof(struct jffs2_unknown_node);
+		}
 
 		err = jffs2_do_mount_fs(c);
 	}
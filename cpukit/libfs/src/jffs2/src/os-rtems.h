@@ -52,8 +52,11 @@ static inline unsigned int full_name_hash(const void *salt, const unsigned char
 	return hash;
 }
 
-/* NAND flash not currently supported on RTEMS */
-#define jffs2_can_mark_obsolete(c) (1)
+/*
+ * NAND flash not currently supported on RTEMS.  Nodes are not marked obsolete
+ * on flash devices which program a unit only once after an erase.
+ */
+#define jffs2_can_mark_obsolete(c) (jffs2_flash_write_size(c) <= 1)
 
 #define JFFS2_INODE_INFO(i) (&(i)->jffs2_i)
 #define OFNI_EDONI_2SFFJ(f)  ((struct _inode *) ( ((char *)f) - ((char *)(&((struct _inode *)NULL)->jffs2_i)) ) )
@@ -120,6 +123,13 @@ static inline bool jffs2_is_readonly(struct jffs2_sb_info *c)
 	return sb->s_is_readonly;
 }
 
+static inline uint32_t jffs2_flash_write_size(struct jffs2_sb_info *c)
+{
+	const struct super_block *sb = OFNI_BS_2SFFJ(c);
+
+	return sb->s_flash_control->write_size;
+}
+
 static inline void jffs2_garbage_collect_trigger(struct jffs2_sb_info *c)
 {
 	const struct super_block *sb = OFNI_BS_2SFFJ(c);
@@ -178,7 +188,6 @@ static inline void jffs2_erase_pending_trigger(struct jffs2_sb_info *c)
 
 #ifndef CONFIG_JFFS2_FS_WRITEBUFFER
 #define SECTOR_ADDR(x) ( ((unsigned long)(x) & ~(c->sector_size-1)) )
-#define jffs2_can_mark_obsolete(c) (1)
 #define jffs2_is_writebuffered(c) (0)
 #define jffs2_cleanmarker_oob(c) (0)
 #define jffs2_write_nand_cleanmarker(c,jeb) (-EIO)
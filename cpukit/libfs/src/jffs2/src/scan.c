@@ -263,6 +263,19 @@ int jffs2_scan_medium(struct jffs2_sb_info *c)
 		jffs2_scan_dirty_space(c, c->nextblock, skip);
 	}
 #endif
+#ifdef __rtems__
+	if (!jffs2_can_mark_obsolete(c) && c->nextblock &&
+	    (c->nextblock->free_size % jffs2_flash_write_size(c))) {
+		/* The last unit written in the next block cannot be programmed
+		   again, so skip the rest of it. */
+		uint32_t skip = c->nextblock->free_size % jffs2_flash_write_size(c);
+
+		jffs2_dbg(1, "%s(): Skipping %d bytes in nextblock to ensure write size alignment\n",
+			  __func__, skip);
+		jffs2_prealloc_raw_node_refs(c, c->nextblock, 1);
+		jffs2_scan_dirty_space(c, c->nextblock, skip);
+	}
+#endif /* __rtems__ */
 	if (c->nr_erasing_blocks) {
 		if ( !c->used_size && ((c->nr_free_blocks+empty_blocks+bad_blocks)!= c->nr_blocks || bad_blocks == c->nr_blocks) ) {
 			pr_notice("Cowardly refusing to erase blocks on filesystem with no valid JFFS2 nodes\n");
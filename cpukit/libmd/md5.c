@@ -40,6 +40,8 @@
 
 #include "md5.h"
 
+#include <rtems/mdtransform.h>
+
 /*
  ***********************************************************************
  **  Message-digest routines:                                         **
@@ -54,6 +56,18 @@
 /* forward declaration */
 static void Transform (UINT4 *buf, UINT4 *in);
 
+/* Returns the installed block transform */
+static rtems_md_transform GetTransform (void)
+{
+  rtems_md_transform transform;
+
+  transform = _MD5_Transform_hook;
+  if (transform == NULL)
+    transform = rtems_md5_transform_generic;
+
+  return transform;
+}
+
 static unsigned char PADDING[64] = {
   0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
@@ -128,15 +142,15 @@ void MD5Update (
   const void *inBufArg,
   unsigned int inLen )
 {
-  UINT4 in[16];
-  int mdi;
-  unsigned int i, ii;
+  rtems_md_transform transform;
+  unsigned int mdi;
+  unsigned int n;
   const unsigned char *inBuf;
 
   inBuf = inBufArg;
 
   /* compute number of bytes mod 64 */
-  mdi = (int)((mdContext->i[0] >> 3) & 0x3F);
+  mdi = (unsigned int)((mdContext->i[0] >> 3) & 0x3F);
 
   /* update number of bits */
   if ((mdContext->i[0] + ((UINT4)inLen << 3)) < mdContext->i[0])
@@ -144,21 +158,33 @@ void MD5Update (
   mdContext->i[0] += ((UINT4)inLen << 3);
   mdContext->i[1] += ((UINT4)inLen >> 29);
 
-  while (inLen--) {
-    /* add new character to buffer, increment mdi */
-    mdContext->in[mdi++] = *inBuf++;
-
-    /* transform if necessary */
-    if (mdi == 0x40) {
-      for (i = 0, ii = 0; i < 16; i++, ii += 4)
-        in[i] = (((UINT4)mdContext->in[ii+3]) << 24) |
-                (((UINT4)mdContext->in[ii+2]) << 16) |
-                (((UINT4)mdContext->in[ii+1]) << 8) |
-                ((UINT4)mdContext->in[ii]);
-      Transform (mdContext->buf, in);
-      mdi = 0;
-    }
+  /* not enough for a complete block, just buffer the characters */
+  if (inLen < 0x40 - mdi) {
+    memcpy (&mdContext->in[mdi], inBuf, inLen);
+    return;
+  }
+
+  transform = GetTransform ();
+
+  /* complete the buffered block and transform it */
+  if (mdi != 0) {
+    n = 0x40 - mdi;
+    memcpy (&mdContext->in[mdi], inBuf, n);
+    (*transform) (mdContext->buf, mdContext->in, 1);
+    inBuf += n;
+    inLen -= n;
   }
+
+  /* transform all complete blocks directly from the input */
+  n = inLen / 0x40;
+  if (n > 0) {
+    (*transform) (mdContext->buf, inBuf, n);
+    inBuf += n * 0x40;
+    inLen -= n * 0x40;
+  }
+
+  /* buffer the remaining characters */
+  memcpy (mdContext->in, inBuf, inLen);
 }
 
 /* The routine MD5Final terminates the message-digest computation and
@@ -168,14 +194,18 @@ void MD5Final (
   unsigned char hash[],
   MD5_CTX *mdContext )
 {
-  UINT4 in[16];
+  unsigned char bits[8];
   int mdi;
   unsigned int i, ii;
   unsigned int padLen;
 
   /* save number of bits */
-  in[14] = mdContext->i[0];
-  in[15] = mdContext->i[1];
+  for (i = 0, ii = 0; i < 2; i++, ii += 4) {
+    bits[ii] = (unsigned char)(mdContext->i[i] & 0xFF);
+    bits[ii+1] = (unsigned char)((mdContext->i[i] >> 8) & 0xFF);
+    bits[ii+2] = (unsigned char)((mdContext->i[i] >> 16) & 0xFF);
+    bits[ii+3] = (unsigned char)((mdContext->i[i] >> 24) & 0xFF);
+  }
 
   /* compute number of bytes mod 64 */
   mdi = (int)((mdContext->i[0] >> 3) & 0x3F);
@@ -184,13 +214,8 @@ void MD5Final (
   padLen = (mdi < 56) ? (56 - mdi) : (120 - mdi);
   MD5Update (mdContext, PADDING, padLen);
 
-  /* append length in bits and transform */
-  for (i = 0, ii = 0; i < 14; i++, ii += 4)
-    in[i] = (((UINT4)mdContext->in[ii+3]) << 24) |
-            (((UINT4)mdContext->in[ii+2]) << 16) |
-            (((UINT4)mdContext->in[ii+1]) << 8) |
-            ((UINT4)mdContext->in[ii]);
-  Transform (mdContext->buf, in);
+  /* append length in bits, this completes and transforms the last block */
+  MD5Update (mdContext, bits, 8);
 
   /* store buffer in digest */
   for (i = 0, ii = 0; i < 4; i++, ii += 4) {
@@ -205,6 +230,27 @@ void MD5Final (
   memcpy(hash, mdContext->digest, 16);
 }
 
+/* Portable block transform. Transforms buf based on count blocks.
+ */
+void rtems_md5_transform_generic (
+  uint32_t *buf,
+  const unsigned char *blocks,
+  size_t count )
+{
+  UINT4 in[16];
+  unsigned int i, ii;
+
+  while (count-- > 0) {
+    for (i = 0, ii = 0; i < 16; i++, ii += 4)
+      in[i] = (((UINT4)blocks[ii+3]) << 24) |
+              (((UINT4)blocks[ii+2]) << 16) |
+              (((UINT4)blocks[ii+1]) << 8) |
+              ((UINT4)blocks[ii]);
+    Transform (buf, in);
+    blocks += 64;
+  }
+}
+
 /* Basic MD5 step. Transforms buf based on in.
  */
 static void Transform (
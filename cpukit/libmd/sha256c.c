@@ -34,6 +34,8 @@ __FBSDID("$FreeBSD$");
 
 #include "sha256.h"
 
+#include <rtems/mdtransform.h>
+
 #if BYTE_ORDER == BIG_ENDIAN
 
 /* Copy a vector of big-endian uint32_t into a vector of bytes */
@@ -190,6 +192,31 @@ SHA256_Transform(uint32_t * state, const unsigned char block[64])
 		state[i] += S[i];
 }
 
+/* Portable block transform of count consecutive blocks */
+void
+rtems_sha256_transform_generic(uint32_t * state, const unsigned char *blocks,
+    size_t count)
+{
+
+	while (count-- > 0) {
+		SHA256_Transform(state, blocks);
+		blocks += 64;
+	}
+}
+
+/* Return the installed block transform */
+static rtems_md_transform
+SHA256_GetTransform(void)
+{
+	rtems_md_transform transform;
+
+	transform = _SHA256_Transform_hook;
+	if (transform == NULL)
+		transform = rtems_sha256_transform_generic;
+
+	return (transform);
+}
+
 static const unsigned char PAD[64] = {
 	0x80, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
 	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
@@ -242,8 +269,10 @@ SHA256_Init(SHA256_CTX * ctx)
 void
 SHA256_Update(SHA256_CTX * ctx, const void *in, size_t len)
 {
+	rtems_md_transform transform;
 	uint64_t bitlen;
 	uint32_t r;
+	size_t n;
 	const unsigned char *src = in;
 
 	/* Number of bytes left in the buffer from previous updates */
@@ -261,17 +290,20 @@ SHA256_Update(SHA256_CTX * ctx, const void *in, size_t len)
 		return;
 	}
 
+	transform = SHA256_GetTransform();
+
 	/* Finish the current block */
 	memcpy(&ctx->buf[r], src, 64 - r);
-	SHA256_Transform(ctx->state, ctx->buf);
+	(*transform)(ctx->state, ctx->buf, 1);
 	src += 64 - r;
 	len -= 64 - r;
 
 	/* Perform complete blocks */
-	while (len >= 64) {
-		SHA256_Transform(ctx->state, src);
-		src += 64;
-		len -= 64;
+	n = len / 64;
+	if (n > 0) {
+		(*transform)(ctx->state, src, n);
+		src += n * 64;
+		len -= n * 64;
 	}
 
 	/* Copy left over data into buffer */
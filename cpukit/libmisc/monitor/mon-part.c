@@ -56,6 +56,19 @@ rtems_monitor_part_canonical(
         rtems_part->limit_address + 1 - (uintptr_t) rtems_part->base_address );
     canonical_part->buf_size = rtems_part->buffer_size;
     canonical_part->used_blocks = rtems_part->number_of_used_blocks;
+
+#if defined(RTEMS_SMP)
+    /* The buffers cached by the processors are free */
+    if ( rtems_part->Per_CPU != NULL ) {
+        uint32_t cpu_max = rtems_scheduler_get_processor_maximum();
+        uint32_t cpu_index;
+
+        for ( cpu_index = 0; cpu_index < cpu_max; ++cpu_index ) {
+            canonical_part->used_blocks -=
+                rtems_part->Per_CPU[ cpu_index ].count;
+        }
+    }
+#endif
 }
 
 
@@ -16,6 +16,9 @@
  */
 
 #include "xz_private.h"
+#ifdef __rtems__
+#include <rtems/crc32.h>
+#endif /* __rtems__ */
 
 /*
  * STATIC_RW_DATA is used in the pre-boot environment on some architectures.
@@ -25,10 +28,13 @@
 #	define STATIC_RW_DATA static
 #endif
 
+#ifndef __rtems__
 STATIC_RW_DATA uint32_t xz_crc32_table[256];
+#endif /* __rtems__ */
 
 XZ_EXTERN void xz_crc32_init(void)
 {
+#ifndef __rtems__
 	const uint32_t poly = 0xEDB88320;
 
 	uint32_t i;
@@ -42,12 +48,17 @@ XZ_EXTERN void xz_crc32_init(void)
 
 		xz_crc32_table[i] = r;
 	}
+#endif /* __rtems__ */
 
 	return;
 }
 
 XZ_EXTERN uint32_t xz_crc32(const uint8_t *buf, size_t size, uint32_t crc)
 {
+#ifdef __rtems__
+	/* Use the CRC-32 of RTEMS, it may use a CRC backend of the BSP */
+	return ~rtems_crc32_update(~crc, buf, size);
+#else /* __rtems__ */
 	crc = ~crc;
 
 	while (size != 0) {
@@ -56,4 +67,5 @@ XZ_EXTERN uint32_t xz_crc32(const uint8_t *buf, size_t size, uint32_t crc)
 	}
 
 	return ~crc;
+#endif /* __rtems__ */
 }
@@ -28,6 +28,7 @@
 #include <rtems/test.h>
 
 #include <rtems/score/heapimpl.h>
+#include <rtems/score/stack.h>
 #include <rtems/score/wkspace.h>
 #include <rtems/malloc.h>
 
@@ -51,6 +52,8 @@ T_heap_run_initialize(void)
 	T_resource_heap_context *ctx;
 
 	ctx = &T_resource_heap_instance;
+	rtems_malloc_cache_flush();
+	_Stack_Cache_flush();
 	T_get_heap_info(&_Workspace_Area, &ctx->workspace_info);
 
 	if (!rtems_configuration_get_unified_work_area()) {
@@ -66,6 +69,8 @@ T_heap_case_end(void)
 	bool ok;
 
 	ctx = &T_resource_heap_instance;
+	rtems_malloc_cache_flush();
+	_Stack_Cache_flush();
 
 	T_get_heap_info(&_Workspace_Area, &info);
 	ok = memcmp(&info, &ctx->workspace_info, sizeof(info)) == 0;
@@ -74,10 +74,7 @@ int timer_delete(
     _Objects_Close( &_POSIX_Timer_Information, &ptimer->Object );
     cpu = _POSIX_Timer_Acquire_critical( ptimer, &lock_context );
     ptimer->state = POSIX_TIMER_STATE_FREE;
-    _Watchdog_Remove(
-      &cpu->Watchdog.Header[ PER_CPU_WATCHDOG_TICKS ],
-      &ptimer->Timer
-    );
+    _Watchdog_Remove( _POSIX_Timer_Header( ptimer, cpu ), &ptimer->Timer );
     _POSIX_Timer_Release( cpu, &lock_context );
     _POSIX_Timer_Free( ptimer );
     _Objects_Allocator_unlock();
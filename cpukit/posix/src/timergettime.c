@@ -77,7 +77,12 @@ int timer_gettime(
   }
 
   cpu = _POSIX_Timer_Acquire_critical( ptimer, &lock_context );
-  rtems_timespec_from_ticks( ptimer->Timer.expire, &expire );
+
+  if ( _Watchdog_Comparator != NULL ) {
+    _Watchdog_Ticks_to_timespec( ptimer->Timer.expire, &expire );
+  } else {
+    rtems_timespec_from_ticks( ptimer->Timer.expire, &expire );
+  }
 
   if ( ptimer->clock_type == CLOCK_MONOTONIC ) {
   _Timecounter_Nanouptime(&now);
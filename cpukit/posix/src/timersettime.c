@@ -48,23 +48,48 @@
 #include <rtems/score/watchdogimpl.h>
 #include <rtems/seterr.h>
 
+/*
+ * Returns the nanoseconds watchdog expiration time of the time point base
+ * plus delta.  The base is updated to this time point.
+ */
+static uint64_t _POSIX_Timer_Expire(
+  struct timespec       *base,
+  const struct timespec *delta
+)
+{
+  if (
+    _Watchdog_Future_timespec( base, delta ) == NULL
+      || _Watchdog_Is_far_future_timespec( base )
+  ) {
+    return WATCHDOG_MAXIMUM_TICKS;
+  }
+
+  return _Watchdog_Ticks_from_timespec( base );
+}
+
 static void _POSIX_Timer_Insert(
   POSIX_Timer_Control *ptimer,
   Per_CPU_Control     *cpu,
-  Watchdog_Interval    ticks
+  uint64_t             expire
 )
 {
+  Watchdog_Header *header;
+
   /* The state really did not change but just to be safe */
   ptimer->state = POSIX_TIMER_STATE_CREATE_RUN;
 
   /* Store the time when the timer was started again */
   _TOD_Get( &ptimer->time );
 
-  _Watchdog_Insert(
-    &cpu->Watchdog.Header[ PER_CPU_WATCHDOG_TICKS ],
-    &ptimer->Timer,
-    cpu->Watchdog.ticks + ticks
-  );
+  header = _POSIX_Timer_Header( ptimer, cpu );
+  _Watchdog_Insert( header, &ptimer->Timer, expire );
+
+  if (
+    _Watchdog_Comparator != NULL
+      && header->first == &ptimer->Timer.Node.RBTree
+  ) {
+    _Watchdog_Comparator_update( cpu );
+  }
 }
 
 /*
@@ -83,10 +108,25 @@ void _POSIX_Timer_TSR( Watchdog_Control *the_watchdog )
   /* Increment the number of expirations. */
   ptimer->overrun = ptimer->overrun + 1;
 
-  /* The timer must be reprogrammed */
+  /*
+   * The timer must be reprogrammed.  The next expiration time is relative to
+   * the previous one, so that the latency of this service routine does not
+   * accumulate.
+   */
   if ( ( ptimer->timer_data.it_interval.tv_sec  != 0 ) ||
        ( ptimer->timer_data.it_interval.tv_nsec != 0 ) ) {
-    _POSIX_Timer_Insert( ptimer, cpu, ptimer->ticks );
+    uint64_t expire;
+
+    if ( _Watchdog_Comparator != NULL ) {
+      struct timespec base;
+
+      _Watchdog_Ticks_to_timespec( ptimer->Timer.expire, &base );
+      expire = _POSIX_Timer_Expire( &base, &ptimer->timer_data.it_interval );
+    } else {
+      expire = ptimer->Timer.expire + ptimer->ticks;
+    }
+
+    _POSIX_Timer_Insert( ptimer, cpu, expire );
   } else {
    /* Indicates that the timer is stopped */
    ptimer->state = POSIX_TIMER_STATE_CREATE_STOP;
@@ -166,14 +206,12 @@ int timer_settime(
   ptimer = _POSIX_Timer_Get( timerid, &lock_context );
   if ( ptimer != NULL ) {
     Per_CPU_Control *cpu;
+    uint64_t         expire;
 
     cpu = _POSIX_Timer_Acquire_critical( ptimer, &lock_context );
 
     /* Stop the timer */
-    _Watchdog_Remove(
-      &cpu->Watchdog.Header[ PER_CPU_WATCHDOG_TICKS ],
-      &ptimer->Timer
-    );
+    _Watchdog_Remove( _POSIX_Timer_Header( ptimer, cpu ), &ptimer->Timer );
 
     /* First, it verifies if the timer must be stopped */
     if ( normalize.it_value.tv_sec == 0 && normalize.it_value.tv_nsec == 0 ) {
@@ -193,7 +231,21 @@ int timer_settime(
     ptimer->ticks  = _Timespec_To_ticks( &value->it_interval );
     initial_period = _Timespec_To_ticks( &normalize.it_value );
 
-    _POSIX_Timer_Insert( ptimer, cpu, initial_period );
+    if ( _Watchdog_Comparator != NULL ) {
+      struct timespec now;
+
+      if ( ptimer->clock_type == CLOCK_MONOTONIC ) {
+        _Timecounter_Nanouptime( &now );
+      } else {
+        _TOD_Get( &now );
+      }
+
+      expire = _POSIX_Timer_Expire( &now, &normalize.it_value );
+    } else {
+      expire = cpu->Watchdog.ticks + initial_period;
+    }
+
+    _POSIX_Timer_Insert( ptimer, cpu, expire );
 
     /*
      * The timer has been started and is running.  So we return the
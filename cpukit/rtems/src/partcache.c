@@ -0,0 +1,270 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/**
+ * @file
+ *
+ * @ingroup RTEMSImplClassicPartition
+ *
+ * @brief This source file contains the implementation of the per-processor
+ *   buffer caches of partitions.
+ */
+
+/*
+ * Copyright (C) 2026 Dave Rush
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/rtems/partimpl.h>
+#include <rtems/score/assert.h>
+#include <rtems/score/chainimpl.h>
+#include <rtems/score/heapimpl.h>
+#include <rtems/score/smp.h>
+#include <rtems/score/wkspace.h>
+
+/*
+ * A cache miss moves a batch of buffers between the partition and the cache
+ * of the current processor, so that the partition lock is obtained at most
+ * once for PARTITION_CACHE_BATCH buffer get or return operations of a
+ * processor.  A cache holds at most PARTITION_CACHE_LIMIT buffers.
+ */
+#define PARTITION_CACHE_BATCH 8
+
+#define PARTITION_CACHE_LIMIT ( 2 * PARTITION_CACHE_BATCH )
+
+static Partition_Per_CPU *_Partition_Cache_acquire(
+  Partition_Control *the_partition,
+  ISR_lock_Context  *lock_context
+)
+{
+  Partition_Per_CPU *cache;
+
+  cache = &the_partition->Per_CPU[ _Per_CPU_Get_index( _Per_CPU_Get() ) ];
+  _ISR_lock_Acquire( &cache->Lock, lock_context );
+
+  return cache;
+}
+
+static void _Partition_Cache_move_to_partition(
+  Partition_Control *the_partition,
+  Partition_Per_CPU *cache,
+  uintptr_t          count
+)
+{
+  uintptr_t i;
+
+  _Assert( count <= cache->count );
+
+  /* Keep the most recently returned buffers in the cache */
+  for ( i = 0; i < count; ++i ) {
+    Chain_Node *the_buffer;
+
+    the_buffer = _Chain_Last( &cache->Buffers );
+    _Chain_Extract_unprotected( the_buffer );
+    _Chain_Append_unprotected( &the_partition->Memory, the_buffer );
+  }
+
+  cache->count -= count;
+  the_partition->number_of_used_blocks -= count;
+  ++the_partition->cache_drains;
+}
+
+bool _Partition_Cache_initialize( Partition_Control *the_partition )
+{
+  Partition_Per_CPU *caches;
+  uint32_t           cpu_max;
+  uint32_t           cpu_index;
+
+  cpu_max = _SMP_Get_processor_maximum();
+
+  if ( cpu_max == 1 ) {
+    the_partition->Per_CPU = NULL;
+    return true;
+  }
+
+  caches = _Heap_Allocate_aligned(
+    &_Workspace_Area,
+    cpu_max * sizeof( *caches ),
+    CPU_CACHE_LINE_BYTES
+  );
+
+  if ( caches == NULL ) {
+    return false;
+  }
+
+  for ( cpu_index = 0; cpu_index < cpu_max; ++cpu_index ) {
+    Partition_Per_CPU *cache;
+
+    cache = &caches[ cpu_index ];
+    _ISR_lock_Initialize( &cache->Lock, "Partition Cache" );
+    _Chain_Initialize_empty( &cache->Buffers );
+    cache->count = 0;
+  }
+
+  the_partition->Per_CPU = caches;
+  return true;
+}
+
+void _Partition_Cache_destroy( Partition_Control *the_partition )
+{
+  Partition_Per_CPU *caches;
+  uint32_t           cpu_max;
+  uint32_t           cpu_index;
+
+  caches = the_partition->Per_CPU;
+
+  if ( caches == NULL ) {
+    return;
+  }
+
+  cpu_max = _SMP_Get_processor_maximum();
+
+  for ( cpu_index = 0; cpu_index < cpu_max; ++cpu_index ) {
+    _Assert( caches[ cpu_index ].count == 0 );
+    _ISR_lock_Destroy( &caches[ cpu_index ].Lock );
+  }
+
+  the_partition->Per_CPU = NULL;
+  _Workspace_Free( caches );
+}
+
+void *_Partition_Cache_get_buffer(
+  Partition_Control *the_partition,
+  ISR_lock_Context  *lock_context
+)
+{
+  Partition_Per_CPU *cache;
+  ISR_lock_Context   cache_lock_context;
+  Chain_Node        *the_buffer;
+  uintptr_t          count;
+
+  cache = _Partition_Cache_acquire( the_partition, &cache_lock_context );
+
+  if ( cache->count > 0 ) {
+    --cache->count;
+    the_buffer = _Chain_Get_first_unprotected( &cache->Buffers );
+    _ISR_lock_Release( &cache->Lock, &cache_lock_context );
+    _ISR_lock_ISR_enable( lock_context );
+    return the_buffer;
+  }
+
+  _Partition_Acquire_critical( the_partition, lock_context );
+  ++the_partition->lock_acquisitions;
+  the_buffer = _Chain_Get_unprotected( &the_partition->Memory );
+
+  if ( the_buffer != NULL ) {
+    Chain_Node *next;
+
+    count = 1;
+
+    while (
+      count < PARTITION_CACHE_BATCH
+        && ( next = _Chain_Get_unprotected( &the_partition->Memory ) ) != NULL
+    ) {
+      _Chain_Append_unprotected( &cache->Buffers, next );
+      ++count;
+    }
+
+    cache->count = count - 1;
+    the_partition->number_of_used_blocks += count;
+    ++the_partition->cache_refills;
+  }
+
+  _ISR_lock_Release( &the_partition->Lock, lock_context );
+  _ISR_lock_Release( &cache->Lock, &cache_lock_context );
+
+  if ( the_buffer == NULL ) {
+    /* Try again with the buffers cached by the other processors */
+    _Partition_Cache_drain( the_partition );
+    _Partition_Acquire_critical( the_partition, lock_context );
+    ++the_partition->lock_acquisitions;
+    the_buffer = _Chain_Get_unprotected( &the_partition->Memory );
+
+    if ( the_buffer != NULL ) {
+      the_partition->number_of_used_blocks += 1;
+    }
+
+    _ISR_lock_Release( &the_partition->Lock, lock_context );
+  }
+
+  _ISR_lock_ISR_enable( lock_context );
+  return the_buffer;
+}
+
+void _Partition_Cache_return_buffer(
+  Partition_Control *the_partition,
+  void              *the_buffer,
+  ISR_lock_Context  *lock_context
+)
+{
+  Partition_Per_CPU *cache;
+  ISR_lock_Context   cache_lock_context;
+
+  _Chain_Initialize_node( the_buffer );
+  cache = _Partition_Cache_acquire( the_partition, &cache_lock_context );
+  _Chain_Prepend_unprotected( &cache->Buffers, the_buffer );
+  ++cache->count;
+
+  if ( cache->count > PARTITION_CACHE_LIMIT ) {
+    _Partition_Acquire_critical( the_partition, lock_context );
+    ++the_partition->lock_acquisitions;
+    _Partition_Cache_move_to_partition(
+      the_partition,
+      cache,
+      PARTITION_CACHE_BATCH
+    );
+    _ISR_lock_Release( &the_partition->Lock, lock_context );
+  }
+
+  _ISR_lock_Release( &cache->Lock, &cache_lock_context );
+  _ISR_lock_ISR_enable( lock_context );
+}
+
+void _Partition_Cache_drain( Partition_Control *the_partition )
+{
+  uint32_t cpu_max;
+  uint32_t cpu_index;
+
+  cpu_max = _SMP_Get_processor_maximum();
+
+  for ( cpu_index = 0; cpu_index < cpu_max; ++cpu_index ) {
+    Partition_Per_CPU *cache;
+    ISR_lock_Context   cache_lock_context;
+
+    cache = &the_partition->Per_CPU[ cpu_index ];
+    _ISR_lock_Acquire( &cache->Lock, &cache_lock_context );
+
+    if ( cache->count > 0 ) {
+      ISR_lock_Context lock_context;
+
+      _Partition_Acquire_critical( the_partition, &lock_context );
+      _Partition_Cache_move_to_partition( the_partition, cache, cache->count );
+      _ISR_lock_Release( &the_partition->Lock, &lock_context );
+    }
+
+    _ISR_lock_Release( &cache->Lock, &cache_lock_context );
+  }
+}
@@ -68,6 +68,9 @@ static void _Partition_Initialize(
   the_partition->buffer_size           = buffer_size;
   the_partition->attribute_set         = attribute_set;
   the_partition->number_of_used_blocks = 0;
+  the_partition->lock_acquisitions     = 0;
+  the_partition->cache_refills         = 0;
+  the_partition->cache_drains          = 0;
 
   _Chain_Initialize(
     &the_partition->Memory,
@@ -143,6 +146,18 @@ rtems_status_code rtems_partition_create(
     return RTEMS_TOO_MANY;
   }
 
+#if defined(RTEMS_SMP)
+  if ( _Attributes_Is_partition_per_CPU_cache( attribute_set ) ) {
+    if ( !_Partition_Cache_initialize( the_partition ) ) {
+      _Objects_Free( &_Partition_Information, &the_partition->Object );
+      _Objects_Allocator_unlock();
+      return RTEMS_UNSATISFIED;
+    }
+  } else {
+    the_partition->Per_CPU = NULL;
+  }
+#endif
+
 #if defined(RTEMS_MULTIPROCESSING)
   if ( _Attributes_Is_global( attribute_set ) &&
        !( _Objects_MP_Allocate_and_open( &_Partition_Information, name,
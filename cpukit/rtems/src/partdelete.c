@@ -64,6 +64,12 @@ rtems_status_code rtems_partition_delete(
     return RTEMS_INVALID_ID;
   }
 
+#if defined(RTEMS_SMP)
+  if ( the_partition->Per_CPU != NULL ) {
+    _Partition_Cache_drain( the_partition );
+  }
+#endif
+
   _Partition_Acquire_critical( the_partition, &lock_context );
 
   if ( the_partition->number_of_used_blocks != 0 ) {
@@ -91,6 +97,9 @@ rtems_status_code rtems_partition_delete(
   }
 #endif
 
+#if defined(RTEMS_SMP)
+  _Partition_Cache_destroy( the_partition );
+#endif
   _ISR_lock_Destroy( &the_partition->Lock );
   _Objects_Free( &_Partition_Information, &the_partition->Object );
   _Objects_Allocator_unlock();
@@ -70,7 +70,21 @@ rtems_status_code rtems_partition_get_buffer(
 #endif
   }
 
+#if defined(RTEMS_SMP)
+  if ( the_partition->Per_CPU != NULL ) {
+    the_buffer = _Partition_Cache_get_buffer( the_partition, &lock_context );
+
+    if ( the_buffer == NULL ) {
+      return RTEMS_UNSATISFIED;
+    }
+
+    *buffer = the_buffer;
+    return RTEMS_SUCCESSFUL;
+  }
+#endif
+
   _Partition_Acquire_critical( the_partition, &lock_context );
+  ++the_partition->lock_acquisitions;
   the_buffer = _Partition_Allocate_buffer( the_partition );
 
   if ( the_buffer == NULL ) {
@@ -0,0 +1,80 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/**
+ * @file
+ *
+ * @ingroup RTEMSImplClassicPartition
+ *
+ * @brief This source file contains the implementation of
+ *   rtems_partition_get_information().
+ */
+
+/*
+ * Copyright (C) 2026 Dave Rush
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/rtems/partimpl.h>
+#include <rtems/rtems/partinfo.h>
+
+rtems_status_code rtems_partition_get_information(
+  rtems_id                     id,
+  rtems_partition_information *info
+)
+{
+  Partition_Control *the_partition;
+  ISR_lock_Context   lock_context;
+  uintptr_t          length;
+
+  if ( info == NULL ) {
+    return RTEMS_INVALID_ADDRESS;
+  }
+
+  the_partition = _Partition_Get( id, &lock_context );
+
+  if ( the_partition == NULL ) {
+    return RTEMS_INVALID_ID;
+  }
+
+#if defined(RTEMS_SMP)
+  if ( the_partition->Per_CPU != NULL ) {
+    _Partition_Cache_drain( the_partition );
+  }
+#endif
+
+  _Partition_Acquire_critical( the_partition, &lock_context );
+  length = (uintptr_t) the_partition->limit_address + 1
+    - (uintptr_t) the_partition->base_address;
+  info->buffer_count = length / the_partition->buffer_size;
+  info->used_buffers = the_partition->number_of_used_blocks;
+  info->free_buffers = info->buffer_count - info->used_buffers;
+  info->lock_acquisitions = the_partition->lock_acquisitions;
+  info->cache_refills = the_partition->cache_refills;
+  info->cache_drains = the_partition->cache_drains;
+  _Partition_Release( the_partition, &lock_context );
+  return RTEMS_SUCCESSFUL;
+}
@@ -40,6 +40,7 @@
 #endif
 
 #include <rtems/rtems/partimpl.h>
+#include <rtems/rtems/attrimpl.h>
 #include <rtems/score/address.h>
 #include <rtems/score/chainimpl.h>
 
@@ -81,7 +82,17 @@ static void _Partition_Free_buffer(
   void              *the_buffer
 )
 {
-  _Chain_Append_unprotected( &the_partition->Memory, the_buffer );
+  rtems_attribute attribute_set;
+
+  attribute_set = the_partition->attribute_set;
+  _Chain_Initialize_node( the_buffer );
+
+  if ( _Attributes_Is_partition_per_CPU_cache( attribute_set ) ) {
+    /* Reuse the buffer first, since it is likely present in the data cache */
+    _Chain_Prepend_unprotected( &the_partition->Memory, the_buffer );
+  } else {
+    _Chain_Append_unprotected( &the_partition->Memory, the_buffer );
+  }
 }
 
 rtems_status_code rtems_partition_return_buffer(
@@ -102,6 +113,18 @@ rtems_status_code rtems_partition_return_buffer(
 #endif
   }
 
+#if defined(RTEMS_SMP)
+  if ( the_partition->Per_CPU != NULL ) {
+    if ( !_Partition_Is_address_a_buffer_begin( the_partition, buffer ) ) {
+      _ISR_lock_ISR_enable( &lock_context );
+      return RTEMS_INVALID_ADDRESS;
+    }
+
+    _Partition_Cache_return_buffer( the_partition, buffer, &lock_context );
+    return RTEMS_SUCCESSFUL;
+  }
+#endif
+
   _Partition_Acquire_critical( the_partition, &lock_context );
 
   if ( !_Partition_Is_address_a_buffer_begin( the_partition, buffer ) ) {
@@ -109,6 +132,7 @@ rtems_status_code rtems_partition_return_buffer(
     return RTEMS_INVALID_ADDRESS;
   }
 
+  ++the_partition->lock_acquisitions;
   _Partition_Free_buffer( the_partition, buffer );
   the_partition->number_of_used_blocks -= 1;
   _Partition_Release( the_partition, &lock_context );
@@ -126,6 +126,8 @@ RTEMS_SYSINIT_ITEM(
   RTEMS_SYSINIT_ORDER_MIDDLE
 );
 
+void ( *_Sysinit_Step_handler )( const rtems_sysinit_item *item );
+
 void rtems_initialize_executive(void)
 {
   const rtems_sysinit_item *item;
@@ -133,6 +135,10 @@ void rtems_initialize_executive(void)
   /* Invoke the registered system initialization handlers */
   RTEMS_LINKER_SET_FOREACH( _Sysinit, item ) {
     ( *item->handler )();
+
+    if ( _Sysinit_Step_handler != NULL ) {
+      ( *_Sysinit_Step_handler )( item );
+    }
   }
 
   _System_state_Set( SYSTEM_STATE_UP );
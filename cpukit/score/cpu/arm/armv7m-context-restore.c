@@ -36,6 +36,7 @@
 #endif
 
 #include <rtems/score/armv7m.h>
+#include <rtems/score/cpuimpl.h>
 #include <rtems/score/percpu.h>
 
 #ifdef ARM_MULTILIB_ARCH_V7M
@@ -49,11 +50,37 @@ void __attribute__((naked)) _CPU_Context_restore(
     "movt r2, #:upper16:_Per_CPU_Information\n"
     "ldr r3, [r0, %[isrctxoff]]\n"
     "ldr sp, [r0, %[spctxoff]]\n"
+#ifdef ARM_MULTILIB_VFP
+    /*
+     * The registers d8 to d15 may have been changed by the previous context
+     * without a save, so they belong to no context unless they are loaded
+     * here.
+     */
+    "mrs r4, control\n"
+    "ldr r5, [r0, %[vfpactoff]]\n"
+    "bic r4, r4, %[fpca]\n"
+    "movs r6, #0\n"
+    "cbz r5, 1f\n"
+    "orr r4, r4, %[fpca]\n"
+    "mov r6, r0\n"
+    "add r5, r0, %[d8off]\n"
+    "vldm r5, {d8-d15}\n"
+    "1:\n"
+    "str r6, [r2, %[vfpownoff]]\n"
+    "msr control, r4\n"
+    "isb\n"
+#endif
     "ldm r0, {r4-r11, lr}\n"
     "str r3, [r2, %[isrpcpuoff]]\n"
     "bx lr\n"
     :
     : [spctxoff] "J" (offsetof(Context_Control, register_sp)),
+#ifdef ARM_MULTILIB_VFP
+      [d8off] "J" (ARM_CONTEXT_CONTROL_D8_OFFSET),
+      [vfpactoff] "J" (ARM_CONTEXT_CONTROL_VFP_ACTIVE_OFFSET),
+      [vfpownoff] "J" (ARM_PER_CPU_VFP_OWNER_OFFSET),
+      [fpca] "J" (ARMV7M_CONTROL_FPCA),
+#endif
       [isrctxoff] "J" (offsetof(Context_Control, isr_nest_level)),
       [isrpcpuoff] "J" (offsetof(Per_CPU_Control, isr_nest_level))
   );
@@ -36,10 +36,23 @@
 #endif
 
 #include <rtems/score/armv7m.h>
+#include <rtems/score/cpuimpl.h>
 #include <rtems/score/percpu.h>
 
 #ifdef ARM_MULTILIB_ARCH_V7M
 
+/*
+ * The registers d8 to d15 are only saved for threads which used the floating
+ * point unit since they were switched in.  This is indicated by the
+ * CONTROL.FPCA bit, which is set by the first floating point instruction in
+ * thread mode.  The bit is part of the thread context.  For a thread without
+ * floating point context it is cleared, so that the exception entries stack
+ * only the basic frame.
+ *
+ * A thread which did not use the floating point unit leaves d8 to d15 as
+ * they are.  The registers are not restored if they still contain the values
+ * of the heir, see CPU_Per_CPU_control::vfp_owner.
+ */
 void __attribute__((naked)) _CPU_Context_switch(
   Context_Control *executing,
   Context_Control *heir
@@ -51,16 +64,33 @@ void __attribute__((naked)) _CPU_Context_switch(
     "ldr r3, [r2, %[isrpcpuoff]]\n"
     "stm r0, {r4-r11, lr}\n"
 #ifdef ARM_MULTILIB_VFP
-    "add r4, r0, %[d8off]\n"
-    "vstm r4, {d8-d15}\n"
+    "mrs r4, control\n"
+    "ands r5, r4, %[fpca]\n"
+    "str r5, [r0, %[vfpactoff]]\n"
+    "beq 1f\n"
+    "add r6, r0, %[d8off]\n"
+    "vstm r6, {d8-d15}\n"
+    "str r0, [r2, %[vfpownoff]]\n"
+    "1:\n"
 #endif
     "str sp, [r0, %[spctxoff]]\n"
     "str r3, [r0, %[isrctxoff]]\n"
     "ldr r3, [r1, %[isrctxoff]]\n"
     "ldr sp, [r1, %[spctxoff]]\n"
 #ifdef ARM_MULTILIB_VFP
-    "add r4, r1, %[d8off]\n"
-    "vldm r4, {d8-d15}\n"
+    "ldr r5, [r1, %[vfpactoff]]\n"
+    "bic r4, r4, %[fpca]\n"
+    "cbz r5, 2f\n"
+    "orr r4, r4, %[fpca]\n"
+    "ldr r6, [r2, %[vfpownoff]]\n"
+    "cmp r6, r1\n"
+    "beq 2f\n"
+    "str r1, [r2, %[vfpownoff]]\n"
+    "add r6, r1, %[d8off]\n"
+    "vldm r6, {d8-d15}\n"
+    "2:\n"
+    "msr control, r4\n"
+    "isb\n"
 #endif
     "ldm r1, {r4-r11, lr}\n"
     "str r3, [r2, %[isrpcpuoff]]\n"
@@ -69,6 +99,9 @@ void __attribute__((naked)) _CPU_Context_switch(
     : [spctxoff] "J" (offsetof(Context_Control, register_sp)),
 #ifdef ARM_MULTILIB_VFP
       [d8off] "J" (ARM_CONTEXT_CONTROL_D8_OFFSET),
+      [vfpactoff] "J" (ARM_CONTEXT_CONTROL_VFP_ACTIVE_OFFSET),
+      [vfpownoff] "J" (ARM_PER_CPU_VFP_OWNER_OFFSET),
+      [fpca] "J" (ARMV7M_CONTROL_FPCA),
 #endif
       [isrctxoff] "J" (offsetof(Context_Control, isr_nest_level)),
       [isrpcpuoff] "J" (offsetof(Per_CPU_Control, isr_nest_level))
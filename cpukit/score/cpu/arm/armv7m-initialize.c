@@ -57,6 +57,19 @@ void _CPU_Initialize( void )
     ARMV7M_VECTOR_PENDSV,
     ARMV7M_EXCEPTION_PRIORITY_LOWEST
   );
+
+#ifdef ARM_MULTILIB_VFP
+  /*
+   * The context switch uses CONTROL.FPCA to find out if a thread used the
+   * floating point unit.  The automatic state preservation sets this bit on
+   * the first floating point instruction of a thread.  With the lazy state
+   * preservation, the exception entry only reserves the stack space for the
+   * caller-saved floating point registers.
+   */
+  _ARMV7M_SCB->fpccr |= ARMV7M_SCB_FPCCR_ASPEN | ARMV7M_SCB_FPCCR_LSPEN;
+  _ARM_Data_synchronization_barrier();
+  _ARM_Instruction_synchronization_barrier();
+#endif
 }
 
 #endif /* ARM_MULTILIB_ARCH_V7M */
@@ -40,13 +40,35 @@
 
 #ifdef ARM_MULTILIB_ARCH_V7M
 
+/*
+ * The exception frame of the supervisor call must have the type of the frame
+ * of the interrupted thread, since the supervisor call returns to the latter.
+ * The thread dispatch may set CONTROL.FPCA, e.g. in a thread switch extension
+ * using the floating point unit, so restore the CONTROL.FPCA of the
+ * interrupted thread passed in r0 by _ARMV7M_Do_pendable_service_call().
+ */
 static void __attribute__((naked)) _ARMV7M_Thread_dispatch( void )
 {
   __asm__ volatile (
+#ifdef ARM_MULTILIB_VFP
+    "push {r0, r1}\n"
+#endif
     "bl _Thread_Dispatch\n"
+#ifdef ARM_MULTILIB_VFP
+    "pop {r0, r1}\n"
+    "mrs r1, control\n"
+    "bic r1, r1, %[fpca]\n"
+    "orr r1, r1, r0\n"
+    "msr control, r1\n"
+    "isb\n"
+#endif
     /* FIXME: SVC, binutils bug */
     ".short 0xdf00\n"
     "nop\n"
+#ifdef ARM_MULTILIB_VFP
+    :
+    : [fpca] "J" (ARMV7M_CONTROL_FPCA)
+#endif
   );
 }
 
@@ -59,7 +81,26 @@ static void _ARMV7M_Trigger_lazy_floating_point_context_save( void )
 #endif
 }
 
-void _ARMV7M_Pendable_service_call( void )
+/*
+ * Threads which did not use the floating point unit since they were switched
+ * in run with CONTROL.FPCA cleared, see _CPU_Context_switch().  Their
+ * exception entries stack the basic frame, which ends in front of
+ * register_s0.
+ */
+static uint32_t _ARMV7M_Exception_frame_size( uint32_t exc_return )
+{
+#ifdef ARM_MULTILIB_VFP
+  if ( ( exc_return & ARMV7M_EXC_RETURN_FTYPE ) != 0 ) {
+    return offsetof( ARMV7M_Exception_frame, register_s0 );
+  }
+#else
+  (void) exc_return;
+#endif
+
+  return sizeof( ARMV7M_Exception_frame );
+}
+
+static void _ARMV7M_Do_pendable_service_call( uint32_t exc_return )
 {
   Per_CPU_Control *cpu_self = _Per_CPU_Get();
 
@@ -79,8 +120,8 @@ void _ARMV7M_Pendable_service_call( void )
     _ARMV7M_SCB->icsr = ARMV7M_SCB_ICSR_PENDSVCLR;
     _ARMV7M_Trigger_lazy_floating_point_context_save();
 
-    ef = (ARMV7M_Exception_frame *) _ARMV7M_Get_PSP();
-    --ef;
+    ef = (ARMV7M_Exception_frame *)
+      ( _ARMV7M_Get_PSP() - _ARMV7M_Exception_frame_size( exc_return ) );
     _ARMV7M_Set_PSP( (uint32_t) ef );
 
     /*
@@ -91,24 +132,40 @@ void _ARMV7M_Pendable_service_call( void )
       ((uintptr_t) _ARMV7M_Thread_dispatch & ~((uintptr_t) 1));
 
     ef->register_xpsr = 0x01000000U;
+
+#ifdef ARM_MULTILIB_VFP
+    if ( ( exc_return & ARMV7M_EXC_RETURN_FTYPE ) == 0 ) {
+      ef->register_r0 = ARMV7M_CONTROL_FPCA;
+    } else {
+      ef->register_r0 = 0;
+    }
+#endif
   }
 }
 
+void _ARMV7M_Pendable_service_call( void )
+{
+  _ARMV7M_Do_pendable_service_call(
+    (uint32_t) (uintptr_t) __builtin_return_address( 0 )
+  );
+}
+
 void _ARMV7M_Supervisor_call( void )
 {
   Per_CPU_Control *cpu_self = _Per_CPU_Get();
-  ARMV7M_Exception_frame *ef;
+  uint32_t exc_return;
 
+  exc_return = (uint32_t) (uintptr_t) __builtin_return_address( 0 );
   _ARMV7M_Trigger_lazy_floating_point_context_save();
 
-  ef = (ARMV7M_Exception_frame *) _ARMV7M_Get_PSP();
-  ++ef;
-  _ARMV7M_Set_PSP( (uint32_t) ef );
+  _ARMV7M_Set_PSP(
+    _ARMV7M_Get_PSP() + _ARMV7M_Exception_frame_size( exc_return )
+  );
 
   cpu_self->isr_nest_level = 0;
 
   if ( cpu_self->dispatch_necessary ) {
-    _ARMV7M_Pendable_service_call();
+    _ARMV7M_Do_pendable_service_call( exc_return );
   }
 }
 
@@ -51,11 +51,19 @@ void __attribute__((naked)) _ARMV7M_Start_multitasking(
     /* Enable process stack pointer (PSP) */
     "mrs r2, control\n"
     "orr r2, #0x2\n"
+#ifdef ARM_MULTILIB_VFP
+    /* The heir has no floating point context yet */
+    "bic r2, %[fpca]\n"
+#endif
     "msr control, r2\n"
+    "isb\n"
     /* Return to heir */
     "bx lr\n"
     :
     : [spctxoff] "J" (offsetof(Context_Control, register_sp))
+#ifdef ARM_MULTILIB_VFP
+      , [fpca] "J" (ARMV7M_CONTROL_FPCA)
+#endif
   );
 }
 
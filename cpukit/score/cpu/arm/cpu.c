@@ -46,6 +46,7 @@
 #endif
 
 #include <rtems/score/cpuimpl.h>
+#include <rtems/score/percpu.h>
 #include <rtems/score/thread.h>
 #include <rtems/score/tls.h>
 
@@ -56,6 +57,20 @@
   );
 #endif
 
+#if defined(ARM_MULTILIB_ARCH_V7M) && defined(ARM_MULTILIB_VFP)
+  RTEMS_STATIC_ASSERT(
+    offsetof( Context_Control, vfp_active )
+      == ARM_CONTEXT_CONTROL_VFP_ACTIVE_OFFSET,
+    ARM_CONTEXT_CONTROL_VFP_ACTIVE_OFFSET
+  );
+
+  RTEMS_STATIC_ASSERT(
+    offsetof( Per_CPU_Control, cpu_per_cpu.vfp_owner )
+      == ARM_PER_CPU_VFP_OWNER_OFFSET,
+    ARM_PER_CPU_VFP_OWNER_OFFSET
+  );
+#endif
+
 #ifdef ARM_MULTILIB_HAS_THREAD_ID_REGISTER
   RTEMS_STATIC_ASSERT(
     offsetof( Context_Control, thread_id )
@@ -48,6 +48,12 @@ extern "C" {
 /* Coprocessor Access Control Register, CPACR */
 #define ARMV7M_CPACR 0xe000ed88
 
+/* Floating-point context active bit of the CONTROL register */
+#define ARMV7M_CONTROL_FPCA (1U << 2)
+
+/* Stack frame type bit of EXC_RETURN, it is cleared for an extended frame */
+#define ARMV7M_EXC_RETURN_FTYPE (1U << 4)
+
 #ifndef ASM
 
 typedef struct {
@@ -165,6 +171,9 @@ typedef struct {
   uint32_t reserved_e000ed40[18];
   uint32_t cpacr;
   uint32_t reserved_e000ed8c[106];
+
+#define ARMV7M_SCB_FPCCR_ASPEN (1U << 31)
+#define ARMV7M_SCB_FPCCR_LSPEN (1U << 30)
   uint32_t fpccr;
   uint32_t fpcar;
   uint32_t fpdscr;
@@ -184,6 +184,10 @@
   #define ARM_CONTEXT_CONTROL_D8_OFFSET 48
 #endif
 
+#if defined(ARM_MULTILIB_ARCH_V7M) && defined(ARM_MULTILIB_VFP)
+  #define ARM_CONTEXT_CONTROL_VFP_ACTIVE_OFFSET 44
+#endif
+
 #ifdef ARM_MULTILIB_ARCH_V4
   #define ARM_CONTEXT_CONTROL_ISR_DISPATCH_DISABLE 40
 #endif
@@ -237,6 +241,13 @@ typedef struct {
   void *register_lr;
   void *register_sp;
   uint32_t isr_nest_level;
+#ifdef ARM_MULTILIB_VFP
+  /*
+   * The CONTROL.FPCA bit of the thread at the last context switch.  Only if
+   * it is set, the registers d8 to d15 belong to the context.
+   */
+  uint32_t vfp_active;
+#endif
 #else
   void *register_sp;
 #endif
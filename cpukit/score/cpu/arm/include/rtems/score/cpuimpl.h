@@ -46,7 +46,17 @@
  * @{
  */
 
-#define CPU_PER_CPU_CONTROL_SIZE 0
+#if defined(ARM_MULTILIB_ARCH_V7M) && defined(ARM_MULTILIB_VFP)
+  #define CPU_PER_CPU_CONTROL_SIZE 4
+
+  /**
+   * @brief Offset of the CPU_Per_CPU_control::vfp_owner field relative to the
+   * Per_CPU_Control begin.
+   */
+  #define ARM_PER_CPU_VFP_OWNER_OFFSET 0
+#else
+  #define CPU_PER_CPU_CONTROL_SIZE 0
+#endif
 
 #ifdef ARM_MULTILIB_ARCH_V4
 
@@ -66,6 +76,22 @@
 extern "C" {
 #endif
 
+#if defined(ARM_MULTILIB_ARCH_V7M) && defined(ARM_MULTILIB_VFP)
+
+typedef struct {
+  /**
+   * @brief The context which saved or restored the registers d8 to d15 last.
+   *
+   * Threads which did not use the floating point unit since they were
+   * switched in leave the registers as they are, so the registers still
+   * belong to this context.  This member is only compared, it is never used
+   * to access the context.
+   */
+  const Context_Control *vfp_owner;
+} CPU_Per_CPU_control;
+
+#endif /* ARM_MULTILIB_ARCH_V7M && ARM_MULTILIB_VFP */
+
 #ifdef ARM_MULTILIB_ARCH_V4
 
 typedef struct {
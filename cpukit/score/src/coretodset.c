@@ -91,6 +91,10 @@ Status_Control _TOD_Set(
       );
     }
 
+    if ( _Watchdog_Comparator != NULL ) {
+      _Watchdog_Comparator_update( cpu );
+    }
+
     _ISR_lock_Release_and_ISR_enable( &cpu->Watchdog.Lock, &lock_context_2 );
   }
 
@@ -250,10 +250,10 @@ void *_Heap_Allocate_aligned_with_boundary(
   }
 
   do {
-    Heap_Block *const free_list_tail = _Heap_Free_list_tail( heap );
+    Heap_Block *const free_list_end = _Heap_Free_block_end( heap );
 
-    block = _Heap_Free_list_first( heap );
-    while ( block != free_list_tail ) {
+    block = _Heap_Free_block_first( heap, block_size_floor );
+    while ( block != free_list_end ) {
       _HAssert( _Heap_Is_prev_used( block ) );
 
       _Heap_Protection_block_check( heap, block );
@@ -284,7 +284,7 @@ void *_Heap_Allocate_aligned_with_boundary(
         break;
       }
 
-      block = block->next;
+      block = _Heap_Free_block_next( heap, block );
     }
 
     search_again = _Heap_Protection_free_delayed_blocks( heap, alloc_begin );
@@ -47,7 +47,7 @@ Heap_Block *_Heap_Greedy_allocate(
   size_t block_count
 )
 {
-  Heap_Block *const free_list_tail = _Heap_Free_list_tail( heap );
+  Heap_Block *const free_list_end = _Heap_Free_block_end( heap );
   Heap_Block *allocated_blocks = NULL;
   Heap_Block *blocks = NULL;
   Heap_Block *current;
@@ -69,7 +69,7 @@ Heap_Block *_Heap_Greedy_allocate(
     }
   }
 
-  while ( (current = _Heap_Free_list_first( heap )) != free_list_tail ) {
+  while ( (current = _Heap_Free_block_first( heap, 0 )) != free_list_end ) {
     _Heap_Block_allocate(
       heap,
       current,
@@ -0,0 +1,261 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/**
+ * @file
+ *
+ * @ingroup RTEMSScoreHeap
+ *
+ * @brief This source file contains the implementation of
+ *   _Heap_Initialize_TLSF() and the TLSF index of the free blocks.
+ */
+
+/*
+ * Copyright (C) 2026 Dave Rush
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/score/heapimpl.h>
+
+#include <string.h>
+
+static uintptr_t _Heap_TLSF_Find_last_set( uintptr_t value )
+{
+  return 63 - (uintptr_t) __builtin_clzll( (unsigned long long) value );
+}
+
+void _Heap_TLSF_Get_size_class(
+  uintptr_t size,
+  uintptr_t *fl,
+  uintptr_t *sl
+)
+{
+  uintptr_t msb;
+
+  if ( size < ( (uintptr_t) 1 << HEAP_TLSF_FL_INDEX_SHIFT ) ) {
+    *fl = 0;
+    *sl = size >> ( HEAP_TLSF_FL_INDEX_SHIFT - HEAP_TLSF_SL_INDEX_LOG2 );
+    return;
+  }
+
+  msb = _Heap_TLSF_Find_last_set( size );
+
+  if ( msb > HEAP_TLSF_FL_INDEX_MAX ) {
+    *fl = HEAP_TLSF_FL_INDEX_COUNT - 1;
+    *sl = HEAP_TLSF_SL_INDEX_COUNT - 1;
+    return;
+  }
+
+  *fl = msb - HEAP_TLSF_FL_INDEX_SHIFT + 1;
+  *sl = ( size >> ( msb - HEAP_TLSF_SL_INDEX_LOG2 ) )
+    ^ HEAP_TLSF_SL_INDEX_COUNT;
+}
+
+/*
+ * Returns the first block of the first non-empty list with a size class
+ * greater than or equal to the size class (fl, sl).  The second level size
+ * class may be HEAP_TLSF_SL_INDEX_COUNT to start the search in the next first
+ * level size class.
+ */
+static Heap_Block *_Heap_TLSF_Find_suitable(
+  const Heap_TLSF_Control *tlsf,
+  uintptr_t fl,
+  uintptr_t sl
+)
+{
+  uint32_t sl_map;
+
+  sl_map = tlsf->sl_bitmap[ fl ] & ( UINT32_MAX << sl );
+
+  if ( sl_map == 0 ) {
+    uint32_t fl_map;
+
+    fl_map = tlsf->fl_bitmap & ( UINT32_MAX << ( fl + 1 ) );
+
+    if ( fl_map == 0 ) {
+      return NULL;
+    }
+
+    fl = (uintptr_t) __builtin_ctz( fl_map );
+    sl_map = tlsf->sl_bitmap[ fl ];
+  }
+
+  sl = (uintptr_t) __builtin_ctz( sl_map );
+  return tlsf->blocks[ fl ][ sl ];
+}
+
+void _Heap_TLSF_Insert( Heap_TLSF_Control *tlsf, Heap_Block *block )
+{
+  uintptr_t fl;
+  uintptr_t sl;
+  Heap_Block *first;
+
+  _Heap_TLSF_Get_size_class( _Heap_Block_size( block ), &fl, &sl );
+  first = tlsf->blocks[ fl ][ sl ];
+
+  block->next = first;
+  block->prev = NULL;
+
+  if ( first != NULL ) {
+    first->prev = block;
+  }
+
+  tlsf->blocks[ fl ][ sl ] = block;
+  tlsf->fl_bitmap |= UINT32_C( 1 ) << fl;
+  tlsf->sl_bitmap[ fl ] |= UINT32_C( 1 ) << sl;
+}
+
+void _Heap_TLSF_Remove( Heap_TLSF_Control *tlsf, Heap_Block *block )
+{
+  Heap_Block *next;
+  Heap_Block *prev;
+
+  next = block->next;
+  prev = block->prev;
+
+  if ( next != NULL ) {
+    next->prev = prev;
+  }
+
+  if ( prev != NULL ) {
+    prev->next = next;
+  } else {
+    uintptr_t fl;
+    uintptr_t sl;
+
+    _Heap_TLSF_Get_size_class( _Heap_Block_size( block ), &fl, &sl );
+    _HAssert( tlsf->blocks[ fl ][ sl ] == block );
+    tlsf->blocks[ fl ][ sl ] = next;
+
+    if ( next == NULL ) {
+      tlsf->sl_bitmap[ fl ] &= ~( UINT32_C( 1 ) << sl );
+
+      if ( tlsf->sl_bitmap[ fl ] == 0 ) {
+        tlsf->fl_bitmap &= ~( UINT32_C( 1 ) << fl );
+      }
+    }
+  }
+}
+
+Heap_Block *_Heap_TLSF_Search( const Heap_TLSF_Control *tlsf, uintptr_t size )
+{
+  uintptr_t fl;
+  uintptr_t sl;
+  uintptr_t rounded_size;
+  Heap_Block *block;
+
+  /*
+   * Round up the size to the next size class, so that all blocks of the found
+   * list are big enough.
+   */
+  rounded_size = size;
+
+  if ( size >= ( (uintptr_t) 1 << HEAP_TLSF_FL_INDEX_SHIFT ) ) {
+    rounded_size += ( (uintptr_t) 1
+      << ( _Heap_TLSF_Find_last_set( size ) - HEAP_TLSF_SL_INDEX_LOG2 ) ) - 1;
+  } else {
+    rounded_size += ( (uintptr_t) 1
+      << ( HEAP_TLSF_FL_INDEX_SHIFT - HEAP_TLSF_SL_INDEX_LOG2 ) ) - 1;
+  }
+
+  if ( rounded_size >= size ) {
+    _Heap_TLSF_Get_size_class( rounded_size, &fl, &sl );
+    block = _Heap_TLSF_Find_suitable( tlsf, fl, sl );
+
+    if ( block != NULL ) {
+      return block;
+    }
+  }
+
+  /*
+   * The list of the size class of the size may contain blocks which are big
+   * enough.  The caller checks the block sizes.
+   */
+  _Heap_TLSF_Get_size_class( size, &fl, &sl );
+  return tlsf->blocks[ fl ][ sl ];
+}
+
+Heap_Block *_Heap_TLSF_Next(
+  const Heap_TLSF_Control *tlsf,
+  const Heap_Block *block
+)
+{
+  uintptr_t fl;
+  uintptr_t sl;
+
+  if ( block->next != NULL ) {
+    return block->next;
+  }
+
+  _Heap_TLSF_Get_size_class( _Heap_Block_size( block ), &fl, &sl );
+  return _Heap_TLSF_Find_suitable( tlsf, fl, sl + 1 );
+}
+
+uintptr_t _Heap_Initialize_TLSF(
+  Heap_Control *heap,
+  void *heap_area_begin_ptr,
+  uintptr_t heap_area_size,
+  uintptr_t page_size
+)
+{
+  uintptr_t const heap_area_begin = (uintptr_t) heap_area_begin_ptr;
+  uintptr_t const tlsf_begin = _Heap_Align_up( heap_area_begin, CPU_ALIGNMENT );
+  uintptr_t const tlsf_end = tlsf_begin + sizeof( Heap_TLSF_Control );
+  uintptr_t const overhead = tlsf_end - heap_area_begin;
+  Heap_TLSF_Control *tlsf;
+  Heap_Block *first_block;
+  uintptr_t space_available;
+
+  if ( tlsf_end < heap_area_begin || heap_area_size <= overhead ) {
+    /* Invalid area or area too small */
+    return 0;
+  }
+
+  /*
+   * The TLSF index is not part of the heap area, so that a heap extension
+   * directly below the area does not merge with the index.
+   */
+  space_available = _Heap_Initialize(
+    heap,
+    (void *) tlsf_end,
+    heap_area_size - overhead,
+    page_size
+  );
+
+  if ( space_available == 0 ) {
+    return 0;
+  }
+
+  tlsf = (Heap_TLSF_Control *) tlsf_begin;
+  memset( tlsf, 0, sizeof( *tlsf ) );
+  heap->tlsf = tlsf;
+
+  first_block = heap->first_block;
+  _Heap_Free_list_remove( first_block );
+  _Heap_TLSF_Insert( tlsf, first_block );
+
+  return space_available;
+}
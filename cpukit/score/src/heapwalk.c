@@ -139,19 +139,149 @@ static bool _Heap_Walk_check_free_list(
   return true;
 }
 
+static bool _Heap_Walk_check_tlsf(
+  int source,
+  Heap_Walk_printer printer,
+  Heap_Control *heap
+)
+{
+  const Heap_TLSF_Control *const tlsf = heap->tlsf;
+  uintptr_t const page_size = heap->page_size;
+  uintptr_t fl;
+
+  for ( fl = 0; fl < HEAP_TLSF_FL_INDEX_COUNT; ++fl ) {
+    uintptr_t sl;
+
+    if (
+      ( ( tlsf->fl_bitmap & ( UINT32_C( 1 ) << fl ) ) != 0 )
+        != ( tlsf->sl_bitmap[ fl ] != 0 )
+    ) {
+      (*printer)(
+        source,
+        true,
+        "TLSF first level %u: invalid bitmap\n",
+        fl
+      );
+
+      return false;
+    }
+
+    for ( sl = 0; sl < HEAP_TLSF_SL_INDEX_COUNT; ++sl ) {
+      const Heap_Block *prev_block = NULL;
+      const Heap_Block *free_block = tlsf->blocks[ fl ][ sl ];
+
+      if (
+        ( ( tlsf->sl_bitmap[ fl ] & ( UINT32_C( 1 ) << sl ) ) != 0 )
+          != ( free_block != NULL )
+      ) {
+        (*printer)(
+          source,
+          true,
+          "TLSF second level %u, %u: invalid bitmap\n",
+          fl,
+          sl
+        );
+
+        return false;
+      }
+
+      while ( free_block != NULL ) {
+        uintptr_t block_fl;
+        uintptr_t block_sl;
+
+        if ( !_Heap_Is_block_in_heap( heap, free_block ) ) {
+          (*printer)(
+            source,
+            true,
+            "free block 0x%08x: not in heap\n",
+            free_block
+          );
+
+          return false;
+        }
+
+        if (
+          !_Heap_Is_aligned(
+            _Heap_Alloc_area_of_block( free_block ),
+            page_size
+          )
+        ) {
+          (*printer)(
+            source,
+            true,
+            "free block 0x%08x: alloc area not page aligned\n",
+            free_block
+          );
+
+          return false;
+        }
+
+        if ( _Heap_Is_used( free_block ) ) {
+          (*printer)(
+            source,
+            true,
+            "free block 0x%08x: is used\n",
+            free_block
+          );
+
+          return false;
+        }
+
+        if ( free_block->prev != prev_block ) {
+          (*printer)(
+            source,
+            true,
+            "free block 0x%08x: invalid previous block 0x%08x\n",
+            free_block,
+            free_block->prev
+          );
+
+          return false;
+        }
+
+        _Heap_TLSF_Get_size_class(
+          _Heap_Block_size( free_block ),
+          &block_fl,
+          &block_sl
+        );
+
+        if ( block_fl != fl || block_sl != sl ) {
+          (*printer)(
+            source,
+            true,
+            "free block 0x%08x: in size class %u, %u instead of %u, %u\n",
+            free_block,
+            fl,
+            sl,
+            block_fl,
+            block_sl
+          );
+
+          return false;
+        }
+
+        prev_block = free_block;
+        free_block = free_block->next;
+      }
+    }
+  }
+
+  return true;
+}
+
 static bool _Heap_Walk_is_in_free_list(
   Heap_Control *heap,
   Heap_Block *block
 )
 {
-  const Heap_Block *const free_list_tail = _Heap_Free_list_tail( heap );
-  const Heap_Block *free_block = _Heap_Free_list_first( heap );
+  const Heap_Block *const free_list_end = _Heap_Free_block_end( heap );
+  const Heap_Block *free_block = _Heap_Free_block_first( heap, 0 );
 
-  while ( free_block != free_list_tail ) {
+  while ( free_block != free_list_end ) {
     if ( free_block == block ) {
       return true;
     }
-    free_block = free_block->next;
+    free_block = _Heap_Free_block_next( heap, free_block );
   }
 
   return false;
@@ -256,6 +386,10 @@ static bool _Heap_Walk_check_control(
     return false;
   }
 
+  if ( _Heap_Is_TLSF( heap ) ) {
+    return _Heap_Walk_check_tlsf( source, printer, heap );
+  }
+
   return _Heap_Walk_check_free_list( source, printer, heap );
 }
 
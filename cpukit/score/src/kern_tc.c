@@ -12,8 +12,8 @@
  *  _Timecounter_Getbinuptime(), _Timecounter_Getnanouptime(),
  *  _Timecounter_Getmicrouptime(), _Timecounter_Getbintime(),
  *  _Timecounter_Getnanotime(), _Timecounter_Getmicrotime(),
- *  _Timecounter_Getboottime(), _Timecounter_Getboottimebin(), and
- *  _Timecounter_Install().
+ *  _Timecounter_Getboottime(), _Timecounter_Getboottimebin(),
+ *  _Timecounter_Install(), and _Timecounter_Set_frequency().
  */
 
 /*-
@@ -137,6 +137,9 @@ atomic_load_ptr(void *ptr)
 
 static Timecounter_NTP_update_second _Timecounter_NTP_update_second_handler;
 
+/* Protected by _Timecounter_Lock, see _Timecounter_Set_frequency() */
+static bool _Timecounter_Frequency_changed;
+
 void
 _Timecounter_Set_NTP_update_second(Timecounter_NTP_update_second handler)
 {
@@ -1769,6 +1772,12 @@ _Timecounter_Windup(struct bintime *new_boottimebin,
 		ffclock_change_tc(th);
 #endif
 	}
+#ifdef __rtems__
+	else if (_Timecounter_Frequency_changed)
+		recalculate_scaling_factor_and_large_delta(th);
+
+	_Timecounter_Frequency_changed = false;
+#endif /* __rtems__ */
 
 #if defined(RTEMS_SMP)
 	/*
@@ -1809,6 +1818,24 @@ _Timecounter_Windup(struct bintime *new_boottimebin,
 #endif /* __rtems__ */
 }
 
+#ifdef __rtems__
+void
+_Timecounter_Set_frequency(struct timecounter *tc, uint64_t frequency)
+{
+	ISR_lock_Context lock_context;
+
+	_Timecounter_Acquire(&lock_context);
+
+	/*
+	 * The windup accounts the delta since the last windup with the scale of
+	 * the previous frequency and afterwards recalculates the scale.
+	 */
+	tc->tc_frequency = frequency;
+	_Timecounter_Frequency_changed = (tc == timehands->th_counter);
+	_Timecounter_Windup(NULL, &lock_context);
+}
+#endif /* __rtems__ */
+
 #ifndef __rtems__
 /* Report or change the active timecounter hardware. */
 static int
@@ -247,6 +247,14 @@ Objects_Maximum _Objects_Extend_information(
 
     _Workspace_Free( old_tables );
 
+    /*
+     * If the name index cannot grow, then it is kept and the next extend tries
+     * again, see _Objects_Name_index_create().
+     */
+    if ( information->name_index != NULL ) {
+      (void) _Objects_Name_index_create( information );
+    }
+
     block_count++;
   }
 
@@ -0,0 +1,449 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/**
+ * @file
+ *
+ * @ingroup RTEMSScoreObject
+ *
+ * @brief This source file contains the implementation of
+ *   the object name index.
+ */
+
+/*
+ * Copyright (C) 2026 Dave Rush
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/score/objectimpl.h>
+#include <rtems/score/assert.h>
+#include <rtems/score/isrlock.h>
+#include <rtems/score/sysstate.h>
+#include <rtems/score/wkspace.h>
+
+#include <string.h>
+
+/*
+ * The index is modified while the allocator lock is owned.  The lookup by a
+ * 32-bit integer name may be carried out in any context, so it must not use
+ * the allocator lock.  This ISR lock protects the index modifications against
+ * these lookups.
+ */
+ISR_LOCK_DEFINE( static, _Objects_Name_index_lock, "Object Name Index" )
+
+static uint32_t _Objects_Name_index_mix( uint32_t hash )
+{
+  hash *= 0x9e3779b1U;
+  return hash ^ ( hash >> 16 );
+}
+
+static uint32_t _Objects_Name_index_hash_u32( uint32_t name )
+{
+  return _Objects_Name_index_mix( name );
+}
+
+static uint32_t _Objects_Name_index_hash_string(
+  const char *name,
+  size_t      name_length
+)
+{
+  uint32_t hash;
+  size_t   i;
+
+  hash = 2166136261U;
+
+  for ( i = 0; i < name_length; ++i ) {
+    hash ^= (unsigned char) name[ i ];
+    hash *= 16777619U;
+  }
+
+  return _Objects_Name_index_mix( hash );
+}
+
+static bool _Objects_Name_index_has_name(
+  const Objects_Information *information,
+  const Objects_Control     *the_object
+)
+{
+  if ( _Objects_Has_string_name( information ) ) {
+    return the_object->name.name_p != NULL;
+  }
+
+  return the_object->name.name_u32 != 0;
+}
+
+static uint32_t _Objects_Name_index_hash_object(
+  const Objects_Information *information,
+  const Objects_Control     *the_object
+)
+{
+  if ( _Objects_Has_string_name( information ) ) {
+    const char *name;
+
+    name = the_object->name.name_p;
+    return _Objects_Name_index_hash_string(
+      name,
+      strnlen( name, information->name_length )
+    );
+  }
+
+  return _Objects_Name_index_hash_u32( the_object->name.name_u32 );
+}
+
+static void _Objects_Name_index_do_insert(
+  Objects_Name_index *index,
+  Objects_Control    *the_object,
+  uint32_t            slot
+)
+{
+  while ( true ) {
+    slot &= index->mask;
+
+    if ( index->table[ slot ] == NULL ) {
+      index->table[ slot ] = the_object;
+      return;
+    }
+
+    ++slot;
+  }
+}
+
+/*
+ * Among objects with equal names, the one with the lowest object index is
+ * returned to get the same result as a linear search through the local table.
+ */
+static Objects_Control *_Objects_Name_index_select(
+  Objects_Control *candidate,
+  Objects_Control *the_object
+)
+{
+  if (
+    candidate == NULL
+      || _Objects_Get_index( the_object->id )
+        < _Objects_Get_index( candidate->id )
+  ) {
+    return the_object;
+  }
+
+  return candidate;
+}
+
+bool _Objects_Name_index_create( Objects_Information *information )
+{
+  Objects_Name_index *old_index;
+  Objects_Name_index *new_index;
+  Objects_Maximum     maximum;
+  Objects_Maximum     index;
+  uint32_t            count;
+  ISR_lock_Context    lock_context;
+
+  _Assert(
+    _Objects_Allocator_is_owner()
+      || !_System_state_Is_up( _System_state_Get() )
+  );
+
+  maximum = _Objects_Get_maximum_index( information );
+  old_index = information->name_index;
+
+  if (
+    old_index != NULL
+      && old_index->complete
+      && old_index->mask >= 2U * maximum - 1
+  ) {
+    return true;
+  }
+
+  count = 8;
+
+  while ( count < 2U * maximum ) {
+    count *= 2;
+  }
+
+  new_index = _Workspace_Allocate(
+    sizeof( *new_index ) + count * sizeof( new_index->table[ 0 ] )
+  );
+
+  if ( new_index == NULL ) {
+    /*
+     * Keep the old index.  It remains in use as long as it has a free entry
+     * for each object.  Otherwise, the lookups use the linear search until
+     * the next extend of the object information grows the index.
+     */
+    if (
+      old_index != NULL
+        && old_index->complete
+        && old_index->mask < maximum
+    ) {
+      _ISR_lock_ISR_disable_and_acquire(
+        &_Objects_Name_index_lock,
+        &lock_context
+      );
+      old_index->complete = false;
+      _ISR_lock_Release_and_ISR_enable(
+        &_Objects_Name_index_lock,
+        &lock_context
+      );
+    }
+
+    return false;
+  }
+
+  new_index->mask = count - 1;
+  new_index->complete = true;
+  memset( new_index->table, 0, count * sizeof( new_index->table[ 0 ] ) );
+
+  for ( index = 0; index < maximum; ++index ) {
+    Objects_Control *the_object;
+
+    the_object = information->local_table[ index ];
+
+    if (
+      the_object != NULL
+        && _Objects_Name_index_has_name( information, the_object )
+    ) {
+      _Objects_Name_index_do_insert(
+        new_index,
+        the_object,
+        _Objects_Name_index_hash_object( information, the_object )
+      );
+    }
+  }
+
+  _ISR_lock_ISR_disable_and_acquire( &_Objects_Name_index_lock, &lock_context );
+  information->name_index = new_index;
+  _ISR_lock_Release_and_ISR_enable( &_Objects_Name_index_lock, &lock_context );
+
+  _Workspace_Free( old_index );
+  return true;
+}
+
+void _Objects_Name_index_insert(
+  const Objects_Information *information,
+  Objects_Control           *the_object
+)
+{
+  Objects_Name_index *index;
+  uint32_t            slot;
+  ISR_lock_Context    lock_context;
+
+  index = information->name_index;
+  _Assert( index != NULL );
+
+  if (
+    !index->complete
+      || !_Objects_Name_index_has_name( information, the_object )
+  ) {
+    return;
+  }
+
+  slot = _Objects_Name_index_hash_object( information, the_object );
+  _ISR_lock_ISR_disable_and_acquire( &_Objects_Name_index_lock, &lock_context );
+  _Objects_Name_index_do_insert( index, the_object, slot );
+  _ISR_lock_Release_and_ISR_enable( &_Objects_Name_index_lock, &lock_context );
+}
+
+void _Objects_Name_index_remove(
+  const Objects_Information *information,
+  Objects_Control           *the_object
+)
+{
+  Objects_Name_index *index;
+  uint32_t            mask;
+  uint32_t            hole;
+  uint32_t            slot;
+  ISR_lock_Context    lock_context;
+
+  index = information->name_index;
+  _Assert( index != NULL );
+
+  if (
+    !index->complete
+      || !_Objects_Name_index_has_name( information, the_object )
+  ) {
+    return;
+  }
+
+  mask = index->mask;
+  hole = _Objects_Name_index_hash_object( information, the_object ) & mask;
+
+  _ISR_lock_ISR_disable_and_acquire( &_Objects_Name_index_lock, &lock_context );
+
+  while ( index->table[ hole ] != the_object ) {
+    _Assert( index->table[ hole ] != NULL );
+    hole = ( hole + 1 ) & mask;
+  }
+
+  /*
+   * Move back the following objects of the cluster which do not have their
+   * home slot between the hole and their current slot, so that no lookup
+   * stops too early at the new hole.
+   */
+  slot = hole;
+
+  while ( true ) {
+    Objects_Control *other;
+    uint32_t         home;
+
+    slot = ( slot + 1 ) & mask;
+    other = index->table[ slot ];
+
+    if ( other == NULL ) {
+      break;
+    }
+
+    home = _Objects_Name_index_hash_object( information, other ) & mask;
+
+    if ( ( ( slot - home ) & mask ) >= ( ( slot - hole ) & mask ) ) {
+      index->table[ hole ] = other;
+      hole = slot;
+    }
+  }
+
+  index->table[ hole ] = NULL;
+  _ISR_lock_Release_and_ISR_enable( &_Objects_Name_index_lock, &lock_context );
+}
+
+bool _Objects_Name_index_find_u32(
+  const Objects_Information  *information,
+  uint32_t                    name,
+  Objects_Control           **the_object
+)
+{
+  const Objects_Name_index *index;
+  Objects_Control          *candidate;
+  uint32_t                  slot;
+  ISR_lock_Context          lock_context;
+  bool                      complete;
+
+  _Assert( name != 0 );
+  candidate = NULL;
+  slot = _Objects_Name_index_hash_u32( name );
+
+  _ISR_lock_ISR_disable_and_acquire( &_Objects_Name_index_lock, &lock_context );
+
+  index = information->name_index;
+  _Assert( index != NULL );
+  complete = index->complete;
+
+  while ( complete ) {
+    Objects_Control *other;
+
+    slot &= index->mask;
+    other = index->table[ slot ];
+
+    if ( other == NULL ) {
+      break;
+    }
+
+    if ( other->name.name_u32 == name ) {
+      candidate = _Objects_Name_index_select( candidate, other );
+    }
+
+    ++slot;
+  }
+
+  _ISR_lock_Release_and_ISR_enable( &_Objects_Name_index_lock, &lock_context );
+
+  *the_object = candidate;
+  return complete;
+}
+
+bool _Objects_Name_index_find_string(
+  const Objects_Information  *information,
+  const char                 *name,
+  size_t                      name_length,
+  Objects_Control           **the_object
+)
+{
+  const Objects_Name_index *index;
+  Objects_Control          *candidate;
+  uint32_t                  slot;
+
+  _Assert( _Objects_Allocator_is_owner() );
+  index = information->name_index;
+  _Assert( index != NULL );
+  _Assert( name_length <= information->name_length );
+
+  if ( !index->complete ) {
+    return false;
+  }
+
+  candidate = NULL;
+  slot = _Objects_Name_index_hash_string( name, name_length );
+
+  while ( true ) {
+    Objects_Control *other;
+
+    slot &= index->mask;
+    other = index->table[ slot ];
+
+    if ( other == NULL ) {
+      break;
+    }
+
+    if ( strncmp( name, other->name.name_p, information->name_length ) == 0 ) {
+      candidate = _Objects_Name_index_select( candidate, other );
+    }
+
+    ++slot;
+  }
+
+  *the_object = candidate;
+  return true;
+}
+
+void _Objects_Name_index_initialize( void )
+{
+  uint32_t api;
+
+  for ( api = OBJECTS_INTERNAL_API; api <= OBJECTS_APIS_LAST; ++api ) {
+    unsigned int maximum_class;
+    unsigned int the_class;
+
+    maximum_class = _Objects_API_maximum_class( api );
+
+    /*
+     * The first class of each API is the thread class.  Thread objects are
+     * closed with thread dispatching disabled and without the allocator lock,
+     * see _Thread_Make_zombie().  This rules out a name index for them.
+     */
+    for ( the_class = 2; the_class <= maximum_class; ++the_class ) {
+      Objects_Information *information;
+
+      information = _Objects_Get_information(
+        (Objects_APIs) api,
+        (uint16_t) the_class
+      );
+
+      if (
+        information != NULL
+          && _Objects_Get_maximum_index( information ) != 0
+      ) {
+        (void) _Objects_Name_index_create( information );
+      }
+    }
+  }
+}
@@ -60,6 +60,10 @@ Status_Control _Objects_Set_name(
       return STATUS_NO_MEMORY;
     }
 
+    if ( information->name_index != NULL ) {
+      _Objects_Name_index_remove( information, the_object );
+    }
+
     _Workspace_Free( RTEMS_DECONST( char *, the_object->name.name_p ) );
     the_object->name.name_p = dup;
   } else {
@@ -68,6 +72,10 @@ Status_Control _Objects_Set_name(
 
     memset( c, ' ', sizeof( c ) );
 
+    if ( information->name_index != NULL ) {
+      _Objects_Name_index_remove( information, the_object );
+    }
+
     for ( i = 0; i < 4; ++i ) {
       if ( name[ i ] == '\0') {
         break;
@@ -80,5 +88,9 @@ Status_Control _Objects_Set_name(
       _Objects_Build_name( c[ 0 ], c[ 1 ], c[ 2 ], c[ 3 ] );
   }
 
+  if ( information->name_index != NULL ) {
+    _Objects_Name_index_insert( information, the_object );
+  }
+
   return STATUS_SUCCESSFUL;
 }
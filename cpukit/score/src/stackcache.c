@@ -0,0 +1,193 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/**
+ * @file
+ *
+ * @ingroup RTEMSScoreStack
+ *
+ * @brief This source file contains the implementation of the size class
+ *   thread stack cache ::_Stack_Cache_size_class_handlers.
+ */
+
+/*
+ * Copyright (C) 2026 Dave Rush
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/score/stackimpl.h>
+#include <rtems/config.h>
+
+RTEMS_STATIC_ASSERT(
+  STACK_CACHE_HEADER_SIZE >= sizeof( size_t ),
+  STACK_CACHE_HEADER_SIZE
+);
+
+static Stack_Cache_class *_Stack_Cache_Find_class( size_t stack_size )
+{
+  size_t i;
+
+  for ( i = 0 ; i < _Stack_Cache_class_count ; ++i ) {
+    Stack_Cache_class *cache_class;
+
+    cache_class = &_Stack_Cache_classes[ i ];
+
+    if ( cache_class->size == stack_size ) {
+      return cache_class;
+    }
+  }
+
+  return NULL;
+}
+
+static Stack_Cache_class *_Stack_Cache_Bind_class( size_t stack_size )
+{
+  size_t i;
+
+  for ( i = 0 ; i < _Stack_Cache_class_count ; ++i ) {
+    Stack_Cache_class *cache_class;
+
+    cache_class = &_Stack_Cache_classes[ i ];
+
+    if ( cache_class->count == 0 ) {
+      cache_class->size = stack_size;
+      return cache_class;
+    }
+  }
+
+  return NULL;
+}
+
+static void _Stack_Cache_Free_to_allocator( void *stack_area )
+{
+  ( *rtems_configuration_get_stack_free_hook() )(
+    (char *) stack_area - STACK_CACHE_HEADER_SIZE
+  );
+}
+
+static void _Stack_Cache_Do_flush( void )
+{
+  size_t i;
+
+  for ( i = 0 ; i < _Stack_Cache_class_count ; ++i ) {
+    Stack_Cache_class *cache_class;
+    void              *stack_area;
+
+    cache_class = &_Stack_Cache_classes[ i ];
+    stack_area = cache_class->free;
+
+    while ( stack_area != NULL ) {
+      void *next;
+
+      next = *(void **) stack_area;
+      _Stack_Cache_Free_to_allocator( stack_area );
+      stack_area = next;
+    }
+
+    cache_class->size = 0;
+    cache_class->free = NULL;
+    cache_class->count = 0;
+  }
+}
+
+static void *_Stack_Cache_Allocate( size_t stack_size )
+{
+  Stack_Cache_class *cache_class;
+  char              *begin;
+
+  cache_class = _Stack_Cache_Find_class( stack_size );
+
+  if ( cache_class != NULL && cache_class->free != NULL ) {
+    void *stack_area;
+
+    stack_area = cache_class->free;
+    cache_class->free = *(void **) stack_area;
+    --cache_class->count;
+
+    return stack_area;
+  }
+
+  if ( stack_size > SIZE_MAX - STACK_CACHE_HEADER_SIZE ) {
+    return NULL;
+  }
+
+  begin = ( *rtems_configuration_get_stack_allocate_hook() )(
+    stack_size + STACK_CACHE_HEADER_SIZE
+  );
+
+  if ( begin == NULL ) {
+    /*
+     * The cached stack areas of other sizes may be enough to satisfy the
+     * request.
+     */
+    _Stack_Cache_Do_flush();
+    begin = ( *rtems_configuration_get_stack_allocate_hook() )(
+      stack_size + STACK_CACHE_HEADER_SIZE
+    );
+
+    if ( begin == NULL ) {
+      return NULL;
+    }
+  }
+
+  *(size_t *) begin = stack_size;
+
+  return begin + STACK_CACHE_HEADER_SIZE;
+}
+
+static void _Stack_Cache_Free( void *stack_area )
+{
+  Stack_Cache_class *cache_class;
+  size_t             stack_size;
+
+  if ( stack_area == NULL ) {
+    return;
+  }
+
+  stack_size = *(size_t *) ( (char *) stack_area - STACK_CACHE_HEADER_SIZE );
+  cache_class = _Stack_Cache_Find_class( stack_size );
+
+  if ( cache_class == NULL ) {
+    cache_class = _Stack_Cache_Bind_class( stack_size );
+  }
+
+  if (
+    cache_class != NULL
+      && cache_class->count < _Stack_Cache_maximum_per_class
+  ) {
+    *(void **) stack_area = cache_class->free;
+    cache_class->free = stack_area;
+    ++cache_class->count;
+  } else {
+    _Stack_Cache_Free_to_allocator( stack_area );
+  }
+}
+
+const Stack_Cache_handlers _Stack_Cache_size_class_handlers = {
+  .allocate = _Stack_Cache_Allocate,
+  .free = _Stack_Cache_Free,
+  .flush = _Stack_Cache_Do_flush
+};
@@ -132,7 +132,17 @@ void _Thread_queue_Add_timeout_monotonic_timespec(
 {
   struct timespec now;
 
-  _Timecounter_Getnanouptime( &now );
+  /*
+   * The high resolution watchdogs may expire between two clock ticks, so a
+   * relative timeout needs the current time and not the time of the last
+   * clock tick.
+   */
+  if ( _Watchdog_Comparator != NULL ) {
+    _Timecounter_Nanouptime( &now );
+  } else {
+    _Timecounter_Getnanouptime( &now );
+  }
+
   _Thread_queue_Add_timeout_timespec(
     queue,
     the_thread,
@@ -152,7 +162,12 @@ void _Thread_queue_Add_timeout_realtime_timespec(
 {
   struct timespec now;
 
-  _Timecounter_Getnanotime( &now );
+  if ( _Watchdog_Comparator != NULL ) {
+    _Timecounter_Nanotime( &now );
+  } else {
+    _Timecounter_Getnanotime( &now );
+  }
+
   _Thread_queue_Add_timeout_timespec(
     queue,
     the_thread,
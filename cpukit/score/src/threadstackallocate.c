@@ -44,5 +44,9 @@
 
 void *_Stack_Allocate( size_t stack_size )
 {
+  if ( _Stack_Cache != NULL ) {
+    return ( *_Stack_Cache->allocate )( stack_size );
+  }
+
   return ( *rtems_configuration_get_stack_allocate_hook() )( stack_size );
 }
@@ -44,5 +44,10 @@
 
 void _Stack_Free( void *stack_area )
 {
+  if ( _Stack_Cache != NULL ) {
+    ( *_Stack_Cache->free )( stack_area );
+    return;
+  }
+
   ( *rtems_configuration_get_stack_free_hook() )( stack_area );
 }
@@ -45,15 +45,28 @@ void _User_extensions_Handler_initialization(void)
 {
   const User_extensions_Table    *initial_table;
   User_extensions_Switch_control *initial_switch_controls;
+  const User_extensions_Table   **initial_dispatch;
   size_t                          n;
   size_t                          i;
 
   initial_table = _User_extensions_Initial_extensions;
   initial_switch_controls = _User_extensions_Initial_switch_controls;
+  initial_dispatch = _User_extensions_Initial_dispatch;
   n = _User_extensions_Initial_count;
 
   for ( i = 0 ; i < n ; ++i ) {
     User_extensions_thread_switch_extension callout;
+    User_extensions_Hook                    hook;
+
+    for ( hook = 0 ; hook < USER_EXTENSIONS_HOOK_COUNT ; ++hook ) {
+      if ( _User_extensions_Has_hook( &initial_table[ i ], hook ) ) {
+        size_t *count;
+
+        count = &_User_extensions_Initial_dispatch_counts[ hook ];
+        initial_dispatch[ hook * n + *count ] = &initial_table[ i ];
+        ++( *count );
+      }
+    }
 
     callout = initial_table[ i ].thread_switch;
 
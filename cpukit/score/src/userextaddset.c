@@ -66,7 +66,8 @@ void _User_extensions_Add_set(
   User_extensions_Control *the_extension
 )
 {
-  ISR_lock_Context lock_context;
+  ISR_lock_Context     lock_context;
+  User_extensions_Hook hook;
 
   _User_extensions_Acquire( &lock_context );
   _Chain_Initialize_node( &the_extension->Node );
@@ -74,6 +75,22 @@ void _User_extensions_Add_set(
     &_User_extensions_List.Active,
     &the_extension->Node
   );
+
+  /*
+   * Append the extension to the dispatch list of each hook it has a handler
+   * for.
+   */
+
+  for ( hook = 0 ; hook < USER_EXTENSIONS_HOOK_COUNT ; ++hook ) {
+    if ( _User_extensions_Has_hook( &the_extension->Callouts, hook ) ) {
+      _Chain_Initialize_node( &the_extension->Hooks[ hook ] );
+      _Chain_Append_unprotected(
+        &_User_extensions_List.Hooks[ hook ],
+        &the_extension->Hooks[ hook ]
+      );
+    }
+  }
+
   _User_extensions_Release( &lock_context );
 
   /*
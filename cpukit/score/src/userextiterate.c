@@ -51,13 +51,43 @@
 
 User_extensions_List _User_extensions_List = {
   CHAIN_INITIALIZER_EMPTY( _User_extensions_List.Active ),
-  CHAIN_ITERATOR_REGISTRY_INITIALIZER( _User_extensions_List.Iterators )
+  CHAIN_ITERATOR_REGISTRY_INITIALIZER( _User_extensions_List.Iterators ),
+  {
+    CHAIN_INITIALIZER_EMPTY(
+      _User_extensions_List.Hooks[ USER_EXTENSIONS_THREAD_CREATE ]
+    ),
+    CHAIN_INITIALIZER_EMPTY(
+      _User_extensions_List.Hooks[ USER_EXTENSIONS_THREAD_START ]
+    ),
+    CHAIN_INITIALIZER_EMPTY(
+      _User_extensions_List.Hooks[ USER_EXTENSIONS_THREAD_RESTART ]
+    ),
+    CHAIN_INITIALIZER_EMPTY(
+      _User_extensions_List.Hooks[ USER_EXTENSIONS_THREAD_DELETE ]
+    ),
+    CHAIN_INITIALIZER_EMPTY(
+      _User_extensions_List.Hooks[ USER_EXTENSIONS_THREAD_BEGIN ]
+    ),
+    CHAIN_INITIALIZER_EMPTY(
+      _User_extensions_List.Hooks[ USER_EXTENSIONS_THREAD_EXITTED ]
+    ),
+    CHAIN_INITIALIZER_EMPTY(
+      _User_extensions_List.Hooks[ USER_EXTENSIONS_THREAD_TERMINATE ]
+    )
+  }
 #if defined(RTEMS_SMP)
   ,
   ISR_LOCK_INITIALIZER( "User Extensions List" )
 #endif
 };
 
+RTEMS_STATIC_ASSERT(
+  USER_EXTENSIONS_HOOK_COUNT == 7,
+  User_extensions_List_Hooks
+);
+
+size_t _User_extensions_Initial_dispatch_counts[ USER_EXTENSIONS_HOOK_COUNT ];
+
 void _User_extensions_Thread_create_visitor(
   Thread_Control              *executing,
   void                        *arg,
@@ -167,43 +197,30 @@ void _User_extensions_Thread_terminate_visitor(
   }
 }
 
-void _User_extensions_Iterate(
+static void _User_extensions_Iterate_dynamic(
+  Thread_Control           *executing,
   void                     *arg,
   User_extensions_Visitor   visitor,
+  Chain_Control            *chain,
+  size_t                    node_offset,
   Chain_Iterator_direction  direction
 )
 {
-  Thread_Control              *executing;
-  const User_extensions_Table *initial_current;
-  const User_extensions_Table *initial_begin;
-  const User_extensions_Table *initial_end;
-  const Chain_Node            *end;
-  Chain_Node                  *node;
-  User_extensions_Iterator     iter;
-  ISR_lock_Context             lock_context;
-
-  executing = _Thread_Get_executing();
-
-  initial_begin = _User_extensions_Initial_extensions;
-  initial_end = initial_begin + _User_extensions_Initial_count;
+  const Chain_Node         *end;
+  Chain_Node               *node;
+  User_extensions_Iterator  iter;
+  ISR_lock_Context          lock_context;
 
   if ( direction == CHAIN_ITERATOR_FORWARD ) {
-    initial_current = initial_begin;
-
-    while ( initial_current != initial_end ) {
-      (*visitor)( executing, arg, initial_current );
-      ++initial_current;
-    }
-
-    end = _Chain_Immutable_tail( &_User_extensions_List.Active );
+    end = _Chain_Immutable_tail( chain );
   } else {
-    end = _Chain_Immutable_head( &_User_extensions_List.Active );
+    end = _Chain_Immutable_head( chain );
   }
 
   _User_extensions_Acquire( &lock_context );
 
   _Chain_Iterator_initialize(
-    &_User_extensions_List.Active,
+    chain,
     &_User_extensions_List.Iterators,
     &iter.Iterator,
     direction
@@ -221,7 +238,8 @@ void _User_extensions_Iterate(
 
     _User_extensions_Release( &lock_context );
 
-    extension = (const User_extensions_Control *) node;
+    extension = (const User_extensions_Control *)
+      ( (const char *) node - node_offset );
     ( *visitor )( executing, arg, &extension->Callouts );
 
     _User_extensions_Acquire( &lock_context );
@@ -234,6 +252,41 @@ void _User_extensions_Iterate(
   _Chain_Iterator_destroy( &iter.Iterator );
 
   _User_extensions_Release( &lock_context );
+}
+
+void _User_extensions_Iterate(
+  void                     *arg,
+  User_extensions_Visitor   visitor,
+  Chain_Iterator_direction  direction
+)
+{
+  Thread_Control              *executing;
+  const User_extensions_Table *initial_current;
+  const User_extensions_Table *initial_begin;
+  const User_extensions_Table *initial_end;
+
+  executing = _Thread_Get_executing();
+
+  initial_begin = _User_extensions_Initial_extensions;
+  initial_end = initial_begin + _User_extensions_Initial_count;
+
+  if ( direction == CHAIN_ITERATOR_FORWARD ) {
+    initial_current = initial_begin;
+
+    while ( initial_current != initial_end ) {
+      (*visitor)( executing, arg, initial_current );
+      ++initial_current;
+    }
+  }
+
+  _User_extensions_Iterate_dynamic(
+    executing,
+    arg,
+    visitor,
+    &_User_extensions_List.Active,
+    offsetof( User_extensions_Control, Node ),
+    direction
+  );
 
   if ( direction == CHAIN_ITERATOR_BACKWARD ) {
     initial_current = initial_end;
@@ -244,3 +297,63 @@ void _User_extensions_Iterate(
     }
   }
 }
+
+void _User_extensions_Dispatch(
+  void                     *arg,
+  User_extensions_Visitor   visitor,
+  User_extensions_Hook      hook,
+  Chain_Iterator_direction  direction
+)
+{
+  Thread_Control               *executing;
+  const User_extensions_Table **initial_current;
+  const User_extensions_Table **initial_begin;
+  const User_extensions_Table **initial_end;
+  Chain_Control                *chain;
+
+  executing = _Thread_Get_executing();
+
+  initial_begin = &_User_extensions_Initial_dispatch[
+    hook * _User_extensions_Initial_count
+  ];
+  initial_end = initial_begin
+    + _User_extensions_Initial_dispatch_counts[ hook ];
+
+  if ( direction == CHAIN_ITERATOR_FORWARD ) {
+    initial_current = initial_begin;
+
+    while ( initial_current != initial_end ) {
+      (*visitor)( executing, arg, *initial_current );
+      ++initial_current;
+    }
+  }
+
+  /*
+   * Most dynamic extensions have no handler for most hooks.  Avoid the lock
+   * and the iterator registration if there is nothing to call.  Extensions
+   * added or removed concurrently may be called or not, just like for a walk
+   * through all extensions.
+   */
+  chain = &_User_extensions_List.Hooks[ hook ];
+
+  if ( !_Chain_Is_empty( chain ) ) {
+    _User_extensions_Iterate_dynamic(
+      executing,
+      arg,
+      visitor,
+      chain,
+      offsetof( User_extensions_Control, Hooks )
+        + hook * sizeof( Chain_Node ),
+      direction
+    );
+  }
+
+  if ( direction == CHAIN_ITERATOR_BACKWARD ) {
+    initial_current = initial_end;
+
+    while ( initial_current != initial_begin ) {
+      --initial_current;
+      (*visitor)( executing, arg, *initial_current );
+    }
+  }
+}
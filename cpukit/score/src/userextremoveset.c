@@ -46,7 +46,8 @@ void _User_extensions_Remove_set (
   User_extensions_Control  *the_extension
 )
 {
-  ISR_lock_Context lock_context;
+  ISR_lock_Context     lock_context;
+  User_extensions_Hook hook;
 
   _User_extensions_Acquire( &lock_context );
   _Chain_Iterator_registry_update(
@@ -54,6 +55,17 @@ void _User_extensions_Remove_set (
     &the_extension->Node
   );
   _Chain_Extract_unprotected( &the_extension->Node );
+
+  for ( hook = 0 ; hook < USER_EXTENSIONS_HOOK_COUNT ; ++hook ) {
+    if ( _User_extensions_Has_hook( &the_extension->Callouts, hook ) ) {
+      _Chain_Iterator_registry_update(
+        &_User_extensions_List.Iterators,
+        &the_extension->Hooks[ hook ]
+      );
+      _Chain_Extract_unprotected( &the_extension->Hooks[ hook ] );
+    }
+  }
+
   _User_extensions_Release( &lock_context );
 
   /*
@@ -0,0 +1,147 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/**
+ * @file
+ *
+ * @ingroup RTEMSScoreWatchdog
+ *
+ * @brief This source file contains the implementation of
+ *   _Watchdog_Comparator_install(), _Watchdog_Comparator_update(), and
+ *   _Watchdog_Comparator_expire().
+ */
+
+/*
+ * Copyright (C) 2026 Dave Rush
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/score/watchdogimpl.h>
+#include <rtems/score/timecounter.h>
+
+Watchdog_Comparator *_Watchdog_Comparator;
+
+void _Watchdog_Comparator_install( Watchdog_Comparator *comparator )
+{
+  _Watchdog_Comparator = comparator;
+}
+
+static void _Watchdog_Comparator_minimum(
+  const Watchdog_Header *header,
+  const struct timespec *now,
+  uint64_t              *minimum,
+  bool                  *scheduled
+)
+{
+  uint64_t remaining;
+
+  if ( _Watchdog_Comparator_remaining( header, now, &remaining ) ) {
+    if ( remaining < *minimum ) {
+      *minimum = remaining;
+    }
+
+    *scheduled = true;
+  }
+}
+
+void _Watchdog_Comparator_update( Per_CPU_Control *cpu )
+{
+  Watchdog_Comparator *comparator;
+  struct timespec      now;
+  uint64_t             remaining;
+  bool                 scheduled;
+
+  comparator = _Watchdog_Comparator;
+  _Assert( comparator != NULL );
+
+#if defined(RTEMS_SMP)
+  if ( cpu != _Per_CPU_Get() ) {
+    return;
+  }
+#endif
+
+  remaining = UINT64_MAX;
+  scheduled = false;
+  _Timecounter_Nanouptime( &now );
+  _Watchdog_Comparator_minimum(
+    &cpu->Watchdog.Header[ PER_CPU_WATCHDOG_MONOTONIC ],
+    &now,
+    &remaining,
+    &scheduled
+  );
+  _Timecounter_Nanotime( &now );
+  _Watchdog_Comparator_minimum(
+    &cpu->Watchdog.Header[ PER_CPU_WATCHDOG_REALTIME ],
+    &now,
+    &remaining,
+    &scheduled
+  );
+
+  if ( scheduled ) {
+    ( *comparator->set )( comparator, remaining );
+  }
+}
+
+void _Watchdog_Comparator_expire( Per_CPU_Control *cpu )
+{
+  ISR_lock_Context  lock_context;
+  Watchdog_Header  *header;
+  Watchdog_Control *first;
+  struct timespec   now;
+
+  _ISR_lock_ISR_disable_and_acquire( &cpu->Watchdog.Lock, &lock_context );
+
+  header = &cpu->Watchdog.Header[ PER_CPU_WATCHDOG_MONOTONIC ];
+  first = _Watchdog_Header_first( header );
+
+  if ( first != NULL ) {
+    _Timecounter_Nanouptime( &now );
+    _Watchdog_Tickle(
+      header,
+      first,
+      _Watchdog_Ticks_from_timespec( &now ),
+      &cpu->Watchdog.Lock,
+      &lock_context
+    );
+  }
+
+  header = &cpu->Watchdog.Header[ PER_CPU_WATCHDOG_REALTIME ];
+  first = _Watchdog_Header_first( header );
+
+  if ( first != NULL ) {
+    _Timecounter_Nanotime( &now );
+    _Watchdog_Tickle(
+      header,
+      first,
+      _Watchdog_Ticks_from_timespec( &now ),
+      &cpu->Watchdog.Lock,
+      &lock_context
+    );
+  }
+
+  _Watchdog_Comparator_update( cpu );
+  _ISR_lock_Release_and_ISR_enable( &cpu->Watchdog.Lock, &lock_context );
+}
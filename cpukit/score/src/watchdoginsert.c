@@ -51,6 +51,11 @@ void _Watchdog_Insert(
   RBTree_Node  *old_first;
   RBTree_Node  *new_first;
 
+  if ( header->wheel != NULL ) {
+    _Watchdog_Wheel_insert( header->wheel, the_watchdog, expire );
+    return;
+  }
+
   _Assert( _Watchdog_Get_state( the_watchdog ) == WATCHDOG_INACTIVE );
 
   link = _RBTree_Root_reference( &header->Watchdogs );
@@ -39,6 +39,7 @@
 #endif
 
 #include <rtems/score/watchdogimpl.h>
+#include <rtems/score/chainimpl.h>
 
 void _Watchdog_Remove(
   Watchdog_Header  *header,
@@ -46,11 +47,16 @@ void _Watchdog_Remove(
 )
 {
   if ( _Watchdog_Is_scheduled( the_watchdog ) ) {
-    if ( header->first == &the_watchdog->Node.RBTree ) {
-      _Watchdog_Next_first( header, the_watchdog );
+    if ( header->wheel != NULL ) {
+      _Chain_Extract_unprotected( &the_watchdog->Node.Chain );
+    } else {
+      if ( header->first == &the_watchdog->Node.RBTree ) {
+        _Watchdog_Next_first( header, the_watchdog );
+      }
+
+      _RBTree_Extract( &header->Watchdogs, &the_watchdog->Node.RBTree );
     }
 
-    _RBTree_Extract( &header->Watchdogs, &the_watchdog->Node.RBTree );
     _Watchdog_Set_state( the_watchdog, WATCHDOG_INACTIVE );
   }
 }
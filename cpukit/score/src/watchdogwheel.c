@@ -0,0 +1,338 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/**
+ * @file
+ *
+ * @ingroup RTEMSScoreWatchdog
+ *
+ * @brief This source file contains the implementation of
+ *   _Watchdog_Wheel_initialize(), _Watchdog_Wheel_initialize_per_CPU(),
+ *   _Watchdog_Wheel_insert(), _Watchdog_Wheel_do_tickle(), and
+ *   _Watchdog_Wheel_next_expire().
+ */
+
+/*
+ * Copyright (C) 2026 Dave Rush
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/score/watchdogimpl.h>
+#include <rtems/score/chainimpl.h>
+#include <rtems/score/smp.h>
+
+#define WATCHDOG_WHEEL_SLOT_MASK ( WATCHDOG_WHEEL_SLOT_COUNT - 1 )
+
+#define WATCHDOG_WHEEL_MAXIMUM_DELTA \
+  ( (uint64_t) 1 << ( WATCHDOG_WHEEL_SLOT_BITS * WATCHDOG_WHEEL_LEVEL_COUNT ) )
+
+static uint64_t _Watchdog_Wheel_level_mask( unsigned int level )
+{
+  return ( (uint64_t) 1 << ( WATCHDOG_WHEEL_SLOT_BITS * level ) ) - 1;
+}
+
+static void _Watchdog_Wheel_place(
+  Watchdog_Wheel   *wheel,
+  Watchdog_Control *the_watchdog,
+  bool              prepend
+)
+{
+  uint64_t       key;
+  uint64_t       delta;
+  unsigned int   level;
+  unsigned int   index;
+  Chain_Control *slot;
+
+  key = the_watchdog->expire;
+  _Assert( key >= wheel->ticks );
+  delta = key - wheel->ticks;
+
+  if ( delta >= WATCHDOG_WHEEL_MAXIMUM_DELTA ) {
+    delta = WATCHDOG_WHEEL_MAXIMUM_DELTA - 1;
+    key = wheel->ticks + delta;
+  }
+
+  level = 0;
+
+  while ( delta >= WATCHDOG_WHEEL_SLOT_COUNT ) {
+    delta >>= WATCHDOG_WHEEL_SLOT_BITS;
+    ++level;
+  }
+
+  index = (unsigned int) ( key >> ( WATCHDOG_WHEEL_SLOT_BITS * level ) )
+    & WATCHDOG_WHEEL_SLOT_MASK;
+  slot = &wheel->Slots[ level ][ index ];
+  wheel->occupied[ level ] |= (uint64_t) 1 << index;
+
+  /*
+   * The watchdogs moved by a cascade were inserted before the watchdogs of the
+   * lower level with the same expiration time, so they are prepended.
+   */
+  if ( prepend ) {
+    _Chain_Prepend_unprotected( slot, &the_watchdog->Node.Chain );
+  } else {
+    _Chain_Append_unprotected( slot, &the_watchdog->Node.Chain );
+  }
+}
+
+static void _Watchdog_Wheel_cascade(
+  Watchdog_Wheel *wheel,
+  unsigned int    level
+)
+{
+  unsigned int   index;
+  Chain_Control *slot;
+  Chain_Node    *first;
+  Chain_Node    *node;
+
+  index = (unsigned int)
+    ( wheel->ticks >> ( WATCHDOG_WHEEL_SLOT_BITS * level ) )
+    & WATCHDOG_WHEEL_SLOT_MASK;
+  wheel->occupied[ level ] &= ~( (uint64_t) 1 << index );
+  slot = &wheel->Slots[ level ][ index ];
+
+  if ( _Chain_Is_empty( slot ) ) {
+    return;
+  }
+
+  first = _Chain_First( slot );
+  node = _Chain_Last( slot );
+  _Chain_Initialize_empty( slot );
+
+  /* Prepend in reverse order to keep the order of the slot */
+  while ( true ) {
+    Chain_Node *previous;
+
+    previous = _Chain_Previous( node );
+    _Watchdog_Wheel_place( wheel, (Watchdog_Control *) node, true );
+
+    if ( node == first ) {
+      break;
+    }
+
+    node = previous;
+  }
+}
+
+void _Watchdog_Wheel_initialize( Watchdog_Wheel *wheel, uint64_t now )
+{
+  unsigned int level;
+  unsigned int index;
+
+  wheel->ticks = now;
+  _Chain_Initialize_empty( &wheel->Expired );
+
+  for ( level = 0; level < WATCHDOG_WHEEL_LEVEL_COUNT; ++level ) {
+    wheel->occupied[ level ] = 0;
+
+    for ( index = 0; index < WATCHDOG_WHEEL_SLOT_COUNT; ++index ) {
+      _Chain_Initialize_empty( &wheel->Slots[ level ][ index ] );
+    }
+  }
+}
+
+void _Watchdog_Wheel_initialize_per_CPU( void )
+{
+  uint32_t cpu_max;
+  uint32_t cpu_index;
+
+  cpu_max = _SMP_Processor_configured_maximum;
+
+  for ( cpu_index = 0 ; cpu_index < cpu_max ; ++cpu_index ) {
+    Per_CPU_Control *cpu;
+    Watchdog_Header *header;
+    Watchdog_Wheel  *wheel;
+
+    cpu = _Per_CPU_Get_by_index( cpu_index );
+    header = &cpu->Watchdog.Header[ PER_CPU_WATCHDOG_TICKS ];
+    wheel = &_Watchdog_Wheels[ cpu_index ];
+
+    _Assert( _Watchdog_Header_first( header ) == NULL );
+    _Watchdog_Wheel_initialize( wheel, cpu->Watchdog.ticks );
+    header->wheel = wheel;
+  }
+}
+
+void _Watchdog_Wheel_insert(
+  Watchdog_Wheel   *wheel,
+  Watchdog_Control *the_watchdog,
+  uint64_t          expire
+)
+{
+  _Assert( _Watchdog_Get_state( the_watchdog ) == WATCHDOG_INACTIVE );
+
+  the_watchdog->expire = expire;
+  _Watchdog_Set_state( the_watchdog, WATCHDOG_SCHEDULED_BLACK );
+
+  if ( expire > wheel->ticks ) {
+    _Watchdog_Wheel_place( wheel, the_watchdog, false );
+  } else {
+    Chain_Node *node;
+
+    node = _Chain_Last( &wheel->Expired );
+
+    while (
+      node != _Chain_Head( &wheel->Expired )
+        && ( (Watchdog_Control *) node )->expire > expire
+    ) {
+      node = _Chain_Previous( node );
+    }
+
+    _Chain_Insert_unprotected( node, &the_watchdog->Node.Chain );
+  }
+}
+
+void _Watchdog_Wheel_do_tickle(
+  Watchdog_Wheel   *wheel,
+  uint64_t          now,
+#ifdef RTEMS_SMP
+  ISR_lock_Control *lock,
+#endif
+  ISR_lock_Context *lock_context
+)
+{
+  unsigned int   level;
+  unsigned int   index;
+  Chain_Control *slot;
+
+  _Assert( now == wheel->ticks + 1 );
+  wheel->ticks = now;
+
+  /*
+   * Cascade the lower levels first.  The watchdogs of a higher level are
+   * prepended to the lower level slots, so they stay in front of the
+   * watchdogs with the same expiration time which were inserted later.
+   */
+  for (
+    level = 1;
+    level < WATCHDOG_WHEEL_LEVEL_COUNT
+      && ( now & _Watchdog_Wheel_level_mask( level ) ) == 0;
+    ++level
+  ) {
+    _Watchdog_Wheel_cascade( wheel, level );
+  }
+
+  index = (unsigned int) now & WATCHDOG_WHEEL_SLOT_MASK;
+  slot = &wheel->Slots[ 0 ][ index ];
+
+  /*
+   * The expired watchdogs were inserted with an expiration time less than or
+   * equal to the time of the last processed tick.  Those which expire now were
+   * inserted after the watchdogs of the slot.
+   */
+  while ( true ) {
+    Chain_Control                  *chain;
+    Watchdog_Control               *the_watchdog;
+    Watchdog_Service_routine_entry  routine;
+
+    if (
+      !_Chain_Is_empty( &wheel->Expired )
+        && ( (Watchdog_Control *) _Chain_First( &wheel->Expired ) )->expire
+          < now
+    ) {
+      chain = &wheel->Expired;
+    } else if ( !_Chain_Is_empty( slot ) ) {
+      chain = slot;
+    } else if ( !_Chain_Is_empty( &wheel->Expired ) ) {
+      chain = &wheel->Expired;
+    } else {
+      break;
+    }
+
+    the_watchdog = (Watchdog_Control *) _Chain_Get_first_unprotected( chain );
+    _Assert( the_watchdog->expire <= now );
+    _Watchdog_Set_state( the_watchdog, WATCHDOG_INACTIVE );
+    routine = the_watchdog->routine;
+
+    _ISR_lock_Release_and_ISR_enable( lock, lock_context );
+    ( *routine )( the_watchdog );
+    _ISR_lock_ISR_disable_and_acquire( lock, lock_context );
+  }
+
+  wheel->occupied[ 0 ] &= ~( (uint64_t) 1 << index );
+}
+
+bool _Watchdog_Wheel_next_expire( Watchdog_Wheel *wheel, uint64_t *expire )
+{
+  unsigned int level;
+  bool         found;
+
+  if ( !_Chain_Is_empty( &wheel->Expired ) ) {
+    *expire = ( (Watchdog_Control *) _Chain_First( &wheel->Expired ) )->expire;
+    return true;
+  }
+
+  found = false;
+
+  for ( level = 0; level < WATCHDOG_WHEEL_LEVEL_COUNT; ++level ) {
+    unsigned int shift;
+    uint64_t     base;
+    unsigned int start;
+
+    shift = WATCHDOG_WHEEL_SLOT_BITS * level;
+    base = wheel->ticks >> shift;
+    start = (unsigned int) ( base + 1 ) & WATCHDOG_WHEEL_SLOT_MASK;
+
+    while ( wheel->occupied[ level ] != 0 ) {
+      uint64_t     occupied;
+      unsigned int distance;
+      unsigned int index;
+      uint64_t     next;
+
+      /* Rotate the bit field, so that the slot after the current is first */
+      occupied = wheel->occupied[ level ];
+      occupied >>= start;
+
+      if ( start != 0 ) {
+        occupied |= wheel->occupied[ level ]
+          << ( WATCHDOG_WHEEL_SLOT_COUNT - start );
+      }
+
+      distance = (unsigned int) __builtin_ctzll( occupied );
+      index = ( start + distance ) & WATCHDOG_WHEEL_SLOT_MASK;
+
+      if ( _Chain_Is_empty( &wheel->Slots[ level ][ index ] ) ) {
+        wheel->occupied[ level ] &= ~( (uint64_t) 1 << index );
+        continue;
+      }
+
+      /*
+       * For the first level this is the expiration time, for the higher
+       * levels this is the time of the cascade.
+       */
+      next = ( base + distance + 1 ) << shift;
+
+      if ( !found || next < *expire ) {
+        *expire = next;
+        found = true;
+      }
+
+      break;
+    }
+  }
+
+  return found;
+}
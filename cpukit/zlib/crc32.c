@@ -25,6 +25,12 @@
 #endif /* MAKECRCH */
 
 #include "zutil.h"      /* for STDC and FAR definitions */
+#ifdef __rtems__
+#include <rtems/crc32.h>
+
+/* The tables are only used by get_crc_table() */
+#define NOBYFOUR
+#endif /* __rtems__ */
 
 #define local static
 
@@ -223,6 +229,11 @@ unsigned long ZEXPORT crc32(crc, buf, len)
 {
     if (buf == Z_NULL) return 0UL;
 
+#ifdef __rtems__
+    /* Use the CRC-32 of RTEMS, it may use a CRC backend of the BSP */
+    return rtems_crc32_update((uint32_t)crc ^ 0xffffffffUL, buf, len)
+        ^ 0xffffffffUL;
+#else /* __rtems__ */
 #ifdef DYNAMIC_CRC_TABLE
     if (crc_table_empty)
         make_crc_table();
@@ -248,6 +259,7 @@ unsigned long ZEXPORT crc32(crc, buf, len)
         DO1;
     } while (--len);
     return crc ^ 0xffffffffUL;
+#endif /* __rtems__ */
 }
 
 #ifdef BYFOUR
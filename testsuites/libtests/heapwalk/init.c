@@ -70,6 +70,20 @@ static void test_heap_init_custom(void)
   test_heap_init_with_page_size( TEST_DEFAULT_PAGESIZE );
 }
 
+static void test_heap_init_tlsf(void)
+{
+  uintptr_t rv;
+
+  memset( TestHeapMemory, 0xFF, sizeof(TestHeapMemory) );
+  rv = _Heap_Initialize_TLSF(
+    &TestHeap,
+    TestHeapMemory,
+    sizeof(TestHeapMemory),
+    TEST_DEFAULT_PAGESIZE
+  );
+  rtems_test_assert( rv > 0 );
+}
+
 static void test_call_heap_walk( bool expectet_retval )
 {
   bool retval = _Heap_Walk( &TestHeap, 0, DUMP );
@@ -215,6 +229,57 @@ static void test_check_free_list(void)
   test_call_heap_walk( false );
 }
 
+static void test_check_tlsf(void)
+{
+  Heap_TLSF_Control *tlsf = NULL;
+  Heap_Block *free_block = NULL;
+  uintptr_t fl = HEAP_TLSF_FL_INDEX_COUNT - 1;
+  uintptr_t sl = HEAP_TLSF_SL_INDEX_COUNT - 1;
+
+  puts( "testing the _Heap_Walk_check_tlsf() function" );
+
+  puts( "\twalk a TLSF heap with gaps" );
+  test_heap_init_tlsf();
+  test_create_heap_with_gaps();
+  test_call_heap_walk( true );
+
+  puts( "\twalk a full TLSF heap" );
+  test_heap_init_tlsf();
+  test_fill_heap();
+  test_call_heap_walk( true );
+
+  puts( "\tclear the first level bitmap" );
+  test_heap_init_tlsf();
+  TestHeap.tlsf->fl_bitmap = 0;
+  test_call_heap_walk( false );
+
+  puts( "\tset a second level bit for an empty list" );
+  test_heap_init_tlsf();
+  TestHeap.tlsf->fl_bitmap |= 1;
+  TestHeap.tlsf->sl_bitmap[ 0 ] |= 1;
+  test_call_heap_walk( false );
+
+  puts( "\tput a free block into the list of another size class" );
+  test_heap_init_tlsf();
+  test_create_heap_with_gaps();
+  tlsf = TestHeap.tlsf;
+  free_block = _Heap_Free_block_first( &TestHeap, 0 );
+  _Heap_TLSF_Remove( tlsf, free_block );
+  free_block->next = tlsf->blocks[ fl ][ sl ];
+  free_block->prev = NULL;
+  tlsf->blocks[ fl ][ sl ] = free_block;
+  tlsf->fl_bitmap |= UINT32_C( 1 ) << fl;
+  tlsf->sl_bitmap[ fl ] |= UINT32_C( 1 ) << sl;
+  test_call_heap_walk( false );
+
+  puts( "\ttake a free block out of the TLSF index" );
+  test_heap_init_tlsf();
+  test_create_heap_with_gaps();
+  free_block = _Heap_Free_block_first( &TestHeap, 0 );
+  _Heap_TLSF_Remove( TestHeap.tlsf, free_block );
+  test_call_heap_walk( false );
+}
+
 static void test_freshly_initialized(void)
 {
   puts( "Walk freshly initialized heap" );
@@ -345,6 +410,7 @@ rtems_task Init(
   test_system_not_up();
   test_check_control();
   test_check_free_list();
+  test_check_tlsf();
   test_freshly_initialized();
   test_main_loop();
   test_check_free_block();
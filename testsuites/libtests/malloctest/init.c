@@ -1327,6 +1327,162 @@ static void test_greedy_allocate(void)
   rtems_test_assert( p == NULL );
 }
 
+#define TEST_TLSF_HEAP_SIZE 16384
+
+static uint8_t TestTLSFHeapMemory[TEST_TLSF_HEAP_SIZE]
+  RTEMS_ALIGNED(CPU_ALIGNMENT);
+
+static uint32_t test_tlsf_random(uint32_t *state)
+{
+  *state = *state * 1664525 + 1013904223;
+
+  return *state >> 8;
+}
+
+static void test_tlsf_check(Heap_Control *heap)
+{
+  Heap_Information_block info;
+
+  rtems_test_assert( _Heap_Walk( heap, 0, false ) );
+
+  _Heap_Get_information( heap, &info );
+  rtems_test_assert( info.Free.number == heap->stats.free_blocks );
+  rtems_test_assert( info.Free.total == heap->stats.free_size );
+}
+
+static void test_heap_tlsf(void)
+{
+  Heap_Control *heap = &TestHeap;
+  uint8_t *area = &TestTLSFHeapMemory[0];
+  uintptr_t area_size = sizeof(TestTLSFHeapMemory) / 2;
+  Heap_Information_block info;
+  Heap_Resize_status rsc;
+  uintptr_t space;
+  uintptr_t free_size;
+  uintptr_t old_size;
+  uintptr_t new_size;
+  uintptr_t block_size;
+  uint32_t state;
+  void *p[64];
+  void *q;
+  int i;
+  int j;
+
+  /* Area too small for the TLSF index */
+  space = _Heap_Initialize_TLSF( heap, area, sizeof(Heap_TLSF_Control), 0 );
+  rtems_test_assert( space == 0 );
+
+  space = _Heap_Initialize_TLSF( heap, area, area_size, 0 );
+  rtems_test_assert( space > 0 );
+  rtems_test_assert( space < area_size - sizeof(Heap_TLSF_Control) );
+  rtems_test_assert( _Heap_Is_TLSF( heap ) );
+  rtems_test_assert( heap->area_begin > (uintptr_t) area );
+  test_tlsf_check( heap );
+  free_size = heap->stats.free_size;
+
+  /* A block of the smallest suitable size class is preferred (good fit) */
+  p[0] = _Heap_Allocate( heap, 512 );
+  p[1] = _Heap_Allocate( heap, 16 );
+  p[2] = _Heap_Allocate( heap, 64 );
+  p[3] = _Heap_Allocate( heap, 16 );
+  rtems_test_assert( p[0] && p[1] && p[2] && p[3] );
+  test_free( p[2] );
+  test_free( p[0] );
+  q = _Heap_Allocate( heap, 48 );
+  rtems_test_assert( q == p[2] );
+  test_free( q );
+  test_free( p[1] );
+  test_free( p[3] );
+  test_tlsf_check( heap );
+  rtems_test_assert( heap->stats.free_blocks == 1 );
+  rtems_test_assert( heap->stats.free_size == free_size );
+
+  /* Allocations with alignment and boundary constraints */
+  for ( i = 1; i <= 4096; i *= 2 ) {
+    for ( j = 0; j < 3; ++j ) {
+      uintptr_t alloc_size = (uintptr_t) i + (uintptr_t) j * 24;
+      uintptr_t alignment = j == 1 ? 64 : 0;
+      uintptr_t boundary = j == 2 ? 8192 : 0;
+
+      q = _Heap_Allocate_aligned_with_boundary(
+        heap,
+        alloc_size,
+        alignment,
+        boundary
+      );
+      rtems_test_assert( q != NULL );
+      test_check_alloc_simple( q, alloc_size, alignment, boundary );
+      test_free( q );
+    }
+  }
+
+  test_tlsf_check( heap );
+  rtems_test_assert( heap->stats.free_size == free_size );
+
+  /* Random allocations, resizes, and frees */
+  memset( p, 0, sizeof(p) );
+  state = 1;
+
+  for ( i = 0; i < 4096; ++i ) {
+    uint32_t r = test_tlsf_random( &state );
+
+    j = (int) ( r % RTEMS_ARRAY_SIZE( p ) );
+    r >>= 6;
+
+    if ( p[j] == NULL ) {
+      p[j] = _Heap_Allocate( heap, 1 + r % 256 );
+    } else if ( ( r & 0x3 ) == 0 ) {
+      rsc = _Heap_Resize_block(
+        heap,
+        p[j],
+        1 + ( r >> 2 ) % 512,
+        &old_size,
+        &new_size
+      );
+      rtems_test_assert( rsc != HEAP_RESIZE_FATAL_ERROR );
+    } else {
+      test_free( p[j] );
+      p[j] = NULL;
+    }
+
+    if ( ( i % 256 ) == 0 ) {
+      test_tlsf_check( heap );
+    }
+  }
+
+  for ( j = 0; j < (int) RTEMS_ARRAY_SIZE( p ); ++j ) {
+    if ( p[j] != NULL ) {
+      test_free( p[j] );
+    }
+  }
+
+  test_tlsf_check( heap );
+  rtems_test_assert( heap->stats.free_blocks == 1 );
+  rtems_test_assert( heap->stats.free_size == free_size );
+
+  /* Extend the heap with a disjoint area and use all the memory */
+  space = _Heap_Extend( heap, area + area_size + 64, area_size - 64, 0 );
+  rtems_test_assert( space > 0 );
+  test_tlsf_check( heap );
+  rtems_test_assert( heap->stats.free_blocks == 2 );
+
+  _Heap_Get_free_information( heap, &info.Free );
+  q = _Heap_Allocate( heap, info.Free.largest - HEAP_BLOCK_HEADER_SIZE );
+  rtems_test_assert( q != NULL );
+  test_free( q );
+
+  block_size = 1;
+  _Heap_Greedy_allocate( heap, &block_size, 1 );
+  test_tlsf_check( heap );
+  rtems_test_assert( heap->stats.free_blocks == 1 );
+
+  q = _Heap_Allocate( heap, 1 );
+  rtems_test_assert( q != NULL );
+
+  q = _Heap_Allocate( heap, 1 );
+  rtems_test_assert( q == NULL );
+}
+
 static void test_alloc_zero_size(void)
 {
   size_t size;
@@ -1430,6 +1586,7 @@ rtems_task Init(
   test_rtems_malloc();
   test_rtems_calloc();
   test_greedy_allocate();
+  test_heap_tlsf();
   test_alloc_zero_size();
 
   test_posix_memalign();
@@ -0,0 +1,305 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (c) 2026 Dave Rush.  All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <rtems.h>
+#include <rtems/malloc.h>
+#include <rtems/score/protectedheap.h>
+#include <rtems/test-info.h>
+
+#include "tmacros.h"
+
+const char rtems_test_name[] = "SMPMALLOC 1";
+
+#define TASK_PRIORITY 1
+
+#define CPU_COUNT 32
+
+#define TEST_COUNT 3
+
+#define OBJECT_COUNT 16
+
+typedef struct {
+  rtems_test_parallel_context base;
+  unsigned long local_counter[CPU_COUNT][TEST_COUNT][CPU_COUNT];
+} test_context;
+
+static test_context test_instance;
+
+static const size_t object_sizes[OBJECT_COUNT] = {
+  16, 24, 32, 48, 64, 8, 96, 128, 40, 192, 256, 16, 72, 32, 160, 12
+};
+
+static rtems_interval test_duration(void)
+{
+  return rtems_clock_get_ticks_per_second();
+}
+
+static rtems_interval test_init(
+  rtems_test_parallel_context *base,
+  void *arg,
+  size_t active_workers
+)
+{
+  return test_duration();
+}
+
+static void test_fini(
+  test_context *ctx,
+  const char *name,
+  size_t test,
+  size_t active_workers
+)
+{
+  Heap_Information_block info;
+  unsigned long sum = 0;
+  unsigned long n = active_workers;
+  unsigned long i;
+
+  printf("  <%s activeWorker=\"%lu\">\n", name, n);
+
+  for (i = 0; i < n; ++i) {
+    unsigned long local_counter =
+      ctx->local_counter[active_workers - 1][test][i];
+
+    sum += local_counter;
+
+    printf(
+      "    <LocalCounter worker=\"%lu\">%lu</LocalCounter>\n",
+      i,
+      local_counter
+    );
+  }
+
+  /* The cached memory is returned to the heap for the information */
+  rtems_test_assert(malloc_info(&info) == 0);
+  rtems_test_assert(info.Free.number == info.Stats.free_blocks);
+  rtems_test_assert(info.Free.total == info.Stats.free_size);
+  rtems_test_assert(malloc_walk(0, false));
+
+  printf(
+    "    <SumOfLocalCounter>%lu</SumOfLocalCounter>\n"
+    "    <FreeBlocks>%" PRIu32 "</FreeBlocks>\n"
+    "  </%s>\n",
+    sum,
+    info.Free.number,
+    name
+  );
+}
+
+static void test_0_body(
+  rtems_test_parallel_context *base,
+  void *arg,
+  size_t active_workers,
+  size_t worker_index
+)
+{
+  test_context *ctx = (test_context *) base;
+  size_t test = 0;
+  unsigned long counter = 0;
+  Heap_Control *heap = malloc_get_heap_pointer();
+  void *p[OBJECT_COUNT];
+  size_t i;
+
+  while (!rtems_test_parallel_stop_job(&ctx->base)) {
+    for (i = 0; i < OBJECT_COUNT; ++i) {
+      p[i] = _Protected_heap_Allocate(heap, object_sizes[i]);
+      rtems_test_assert(p[i] != NULL);
+    }
+
+    for (i = 0; i < OBJECT_COUNT; ++i) {
+      rtems_test_assert(_Protected_heap_Free(heap, p[i]));
+    }
+
+    counter += OBJECT_COUNT;
+  }
+
+  ctx->local_counter[active_workers - 1][test][worker_index] = counter;
+}
+
+static void test_0_fini(
+  rtems_test_parallel_context *base,
+  void *arg,
+  size_t active_workers
+)
+{
+  test_context *ctx = (test_context *) base;
+
+  test_fini(ctx, "ProtectedHeap", 0, active_workers);
+}
+
+static void test_1_body(
+  rtems_test_parallel_context *base,
+  void *arg,
+  size_t active_workers,
+  size_t worker_index
+)
+{
+  test_context *ctx = (test_context *) base;
+  size_t test = 1;
+  unsigned long counter = 0;
+  void *p[OBJECT_COUNT];
+  size_t i;
+
+  while (!rtems_test_parallel_stop_job(&ctx->base)) {
+    for (i = 0; i < OBJECT_COUNT; ++i) {
+      p[i] = malloc(object_sizes[i]);
+      rtems_test_assert(p[i] != NULL);
+    }
+
+    for (i = 0; i < OBJECT_COUNT; ++i) {
+      free(p[i]);
+    }
+
+    counter += OBJECT_COUNT;
+  }
+
+  ctx->local_counter[active_workers - 1][test][worker_index] = counter;
+}
+
+static void test_1_fini(
+  rtems_test_parallel_context *base,
+  void *arg,
+  size_t active_workers
+)
+{
+  test_context *ctx = (test_context *) base;
+
+  test_fini(ctx, "PerCPUCache", 1, active_workers);
+}
+
+static void test_2_body(
+  rtems_test_parallel_context *base,
+  void *arg,
+  size_t active_workers,
+  size_t worker_index
+)
+{
+  test_context *ctx = (test_context *) base;
+  size_t test = 2;
+  unsigned long counter = 0;
+  void *p[OBJECT_COUNT];
+  size_t i;
+
+  /* Sizes beyond the size classes bypass the cache */
+  while (!rtems_test_parallel_stop_job(&ctx->base)) {
+    for (i = 0; i < OBJECT_COUNT; ++i) {
+      p[i] = malloc(object_sizes[i] + 512);
+      rtems_test_assert(p[i] != NULL);
+    }
+
+    for (i = 0; i < OBJECT_COUNT; ++i) {
+      free(p[i]);
+    }
+
+    counter += OBJECT_COUNT;
+  }
+
+  ctx->local_counter[active_workers - 1][test][worker_index] = counter;
+}
+
+static void test_2_fini(
+  rtems_test_parallel_context *base,
+  void *arg,
+  size_t active_workers
+)
+{
+  test_context *ctx = (test_context *) base;
+
+  test_fini(ctx, "LargeObjects", 2, active_workers);
+}
+
+static const rtems_test_parallel_job test_jobs[TEST_COUNT] = {
+  {
+    .init = test_init,
+    .body = test_0_body,
+    .fini = test_0_fini,
+    .cascade = true
+  }, {
+    .init = test_init,
+    .body = test_1_body,
+    .fini = test_1_fini,
+    .cascade = true
+  }, {
+    .init = test_init,
+    .body = test_2_body,
+    .fini = test_2_fini,
+    .cascade = true
+  }
+};
+
+static void test(void)
+{
+  test_context *ctx = &test_instance;
+  const char *test = "SMPMalloc01";
+
+  printf("<%s>\n", test);
+  rtems_test_parallel(&ctx->base, NULL, &test_jobs[0], TEST_COUNT);
+  printf("</%s>\n", test);
+}
+
+static void Init(rtems_task_argument arg)
+{
+  TEST_BEGIN();
+
+  test();
+
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+
+#define CONFIGURE_MALLOC_PER_CPU_CACHE
+
+#define CONFIGURE_MAXIMUM_PROCESSORS CPU_COUNT
+
+#define CONFIGURE_MAXIMUM_TASKS CPU_COUNT
+
+#define CONFIGURE_MAXIMUM_SEMAPHORES 1
+
+#define CONFIGURE_MAXIMUM_TIMERS 1
+
+#define CONFIGURE_INIT_TASK_PRIORITY TASK_PRIORITY
+#define CONFIGURE_INIT_TASK_INITIAL_MODES RTEMS_DEFAULT_MODES
+#define CONFIGURE_INIT_TASK_ATTRIBUTES RTEMS_DEFAULT_ATTRIBUTES
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
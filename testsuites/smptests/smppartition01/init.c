@@ -0,0 +1,305 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (c) 2026 Dave Rush.  All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <inttypes.h>
+#include <stdio.h>
+
+#include <rtems.h>
+#include <rtems/test-info.h>
+
+#include "tmacros.h"
+
+const char rtems_test_name[] = "SMPPARTITION 1";
+
+#define TASK_PRIORITY 1
+
+#define CPU_COUNT 32
+
+#define TEST_COUNT 2
+
+#define OBJECT_COUNT 16
+
+#define BUFFER_SIZE 32
+
+#define BUFFER_COUNT (2 * CPU_COUNT * OBJECT_COUNT)
+
+typedef struct {
+  rtems_test_parallel_context base;
+  rtems_id partition[TEST_COUNT];
+  void *buffers[BUFFER_COUNT];
+  unsigned long local_counter[CPU_COUNT][TEST_COUNT][CPU_COUNT];
+} test_context;
+
+static test_context test_instance;
+
+static RTEMS_ALIGNED(RTEMS_PARTITION_ALIGNMENT) char
+  buffer_areas[TEST_COUNT][BUFFER_COUNT][BUFFER_SIZE];
+
+static const rtems_attribute partition_attributes[TEST_COUNT] = {
+  RTEMS_DEFAULT_ATTRIBUTES,
+  RTEMS_PARTITION_PER_CPU_CACHE
+};
+
+static rtems_interval test_duration(void)
+{
+  return rtems_clock_get_ticks_per_second();
+}
+
+static rtems_interval test_init(
+  rtems_test_parallel_context *base,
+  void *arg,
+  size_t active_workers
+)
+{
+  return test_duration();
+}
+
+static void test_get_all_buffers(test_context *ctx, rtems_id id)
+{
+  rtems_status_code sc;
+  void *p;
+  size_t i;
+
+  /* The buffers cached by the workers are available to this processor */
+  for (i = 0; i < BUFFER_COUNT; ++i) {
+    sc = rtems_partition_get_buffer(id, &ctx->buffers[i]);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  }
+
+  sc = rtems_partition_get_buffer(id, &p);
+  rtems_test_assert(sc == RTEMS_UNSATISFIED);
+
+  for (i = 0; i < BUFFER_COUNT; ++i) {
+    sc = rtems_partition_return_buffer(id, ctx->buffers[i]);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  }
+}
+
+static void test_fini(
+  test_context *ctx,
+  const char *name,
+  size_t test,
+  size_t active_workers
+)
+{
+  rtems_partition_information info;
+  rtems_status_code sc;
+  unsigned long sum = 0;
+  unsigned long n = active_workers;
+  unsigned long i;
+
+  printf("  <%s activeWorker=\"%lu\">\n", name, n);
+
+  for (i = 0; i < n; ++i) {
+    unsigned long local_counter =
+      ctx->local_counter[active_workers - 1][test][i];
+
+    sum += local_counter;
+
+    printf(
+      "    <LocalCounter worker=\"%lu\">%lu</LocalCounter>\n",
+      i,
+      local_counter
+    );
+  }
+
+  test_get_all_buffers(ctx, ctx->partition[test]);
+
+  sc = rtems_partition_get_information(ctx->partition[test], &info);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  rtems_test_assert(info.buffer_count == BUFFER_COUNT);
+  rtems_test_assert(info.used_buffers == 0);
+  rtems_test_assert(info.free_buffers == BUFFER_COUNT);
+
+  printf(
+    "    <SumOfLocalCounter>%lu</SumOfLocalCounter>\n"
+    "    <LockAcquisitions>%" PRIu32 "</LockAcquisitions>\n"
+    "    <CacheRefills>%" PRIu32 "</CacheRefills>\n"
+    "    <CacheDrains>%" PRIu32 "</CacheDrains>\n"
+    "  </%s>\n",
+    sum,
+    info.lock_acquisitions,
+    info.cache_refills,
+    info.cache_drains,
+    name
+  );
+}
+
+static void test_body(
+  test_context *ctx,
+  size_t test,
+  size_t active_workers,
+  size_t worker_index
+)
+{
+  rtems_id id = ctx->partition[test];
+  unsigned long counter = 0;
+  void *p[OBJECT_COUNT];
+  size_t i;
+
+  while (!rtems_test_parallel_stop_job(&ctx->base)) {
+    rtems_status_code sc;
+
+    for (i = 0; i < OBJECT_COUNT; ++i) {
+      sc = rtems_partition_get_buffer(id, &p[i]);
+      rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+    }
+
+    for (i = 0; i < OBJECT_COUNT; ++i) {
+      sc = rtems_partition_return_buffer(id, p[i]);
+      rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+    }
+
+    counter += OBJECT_COUNT;
+  }
+
+  ctx->local_counter[active_workers - 1][test][worker_index] = counter;
+}
+
+static void test_0_body(
+  rtems_test_parallel_context *base,
+  void *arg,
+  size_t active_workers,
+  size_t worker_index
+)
+{
+  test_body((test_context *) base, 0, active_workers, worker_index);
+}
+
+static void test_0_fini(
+  rtems_test_parallel_context *base,
+  void *arg,
+  size_t active_workers
+)
+{
+  test_context *ctx = (test_context *) base;
+
+  test_fini(ctx, "PartitionLock", 0, active_workers);
+}
+
+static void test_1_body(
+  rtems_test_parallel_context *base,
+  void *arg,
+  size_t active_workers,
+  size_t worker_index
+)
+{
+  test_body((test_context *) base, 1, active_workers, worker_index);
+}
+
+static void test_1_fini(
+  rtems_test_parallel_context *base,
+  void *arg,
+  size_t active_workers
+)
+{
+  test_context *ctx = (test_context *) base;
+
+  test_fini(ctx, "PerCPUCache", 1, active_workers);
+}
+
+static const rtems_test_parallel_job test_jobs[TEST_COUNT] = {
+  {
+    .init = test_init,
+    .body = test_0_body,
+    .fini = test_0_fini,
+    .cascade = true
+  }, {
+    .init = test_init,
+    .body = test_1_body,
+    .fini = test_1_fini,
+    .cascade = true
+  }
+};
+
+static void test(void)
+{
+  test_context *ctx = &test_instance;
+  const char *test = "SMPPartition01";
+  rtems_status_code sc;
+  size_t i;
+
+  for (i = 0; i < TEST_COUNT; ++i) {
+    sc = rtems_partition_create(
+      rtems_build_name('P', 'A', 'R', '0' + i),
+      buffer_areas[i],
+      sizeof(buffer_areas[i]),
+      BUFFER_SIZE,
+      partition_attributes[i],
+      &ctx->partition[i]
+    );
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  }
+
+  printf("<%s>\n", test);
+  rtems_test_parallel(&ctx->base, NULL, &test_jobs[0], TEST_COUNT);
+  printf("</%s>\n", test);
+
+  for (i = 0; i < TEST_COUNT; ++i) {
+    sc = rtems_partition_delete(ctx->partition[i]);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  }
+}
+
+static void Init(rtems_task_argument arg)
+{
+  TEST_BEGIN();
+
+  test();
+
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+
+#define CONFIGURE_MAXIMUM_PROCESSORS CPU_COUNT
+
+#define CONFIGURE_MAXIMUM_TASKS CPU_COUNT
+
+#define CONFIGURE_MAXIMUM_PARTITIONS TEST_COUNT
+
+#define CONFIGURE_MAXIMUM_SEMAPHORES 1
+
+#define CONFIGURE_MAXIMUM_TIMERS 1
+
+#define CONFIGURE_INIT_TASK_PRIORITY TASK_PRIORITY
+#define CONFIGURE_INIT_TASK_INITIAL_MODES RTEMS_DEFAULT_MODES
+#define CONFIGURE_INIT_TASK_ATTRIBUTES RTEMS_DEFAULT_ATTRIBUTES
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
@@ -0,0 +1,192 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (c) 2026 Dave Rush.  All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <time.h>
+
+#include <rtems.h>
+
+#include <bsp.h>
+
+#ifdef BSP_ARMV7M_SYSTICK_TICKLESS_IDLE
+#include <bsp/clock-armv7m.h>
+#endif
+
+#include "tmacros.h"
+
+const char rtems_test_name[] = "SPCLOCKTICKLESS 1";
+
+static const rtems_interval sleep_ticks[] = { 2, 10, 100, 1000, 5000 };
+
+static uint64_t ns_per_tick(void)
+{
+  return (uint64_t) rtems_configuration_get_microseconds_per_tick() * 1000;
+}
+
+static void check_elapsed(
+  const char *what,
+  uint64_t expected_ns,
+  uint64_t t0,
+  uint64_t t1,
+  rtems_interval ticks
+)
+{
+  uint64_t elapsed;
+
+  elapsed = t1 - t0;
+  printf(
+    "%s: expected %" PRIu64 "ns, elapsed %" PRIu64 "ns, %" PRIu32 " ticks\n",
+    what,
+    expected_ns,
+    elapsed,
+    ticks
+  );
+
+  /*
+   * The sleep starts somewhere within the current clock tick, so it may be up
+   * to one clock tick shorter than requested.
+   */
+  rtems_test_assert(elapsed + ns_per_tick() >= expected_ns);
+  rtems_test_assert(elapsed <= expected_ns + 2 * ns_per_tick());
+}
+
+static void test_wake_after(rtems_interval ticks)
+{
+  rtems_status_code sc;
+  rtems_interval ticks_0;
+  rtems_interval ticks_1;
+  uint64_t t0;
+  uint64_t t1;
+
+  ticks_0 = rtems_clock_get_ticks_since_boot();
+  t0 = rtems_clock_get_uptime_nanoseconds();
+
+  sc = rtems_task_wake_after(ticks);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  t1 = rtems_clock_get_uptime_nanoseconds();
+  ticks_1 = rtems_clock_get_ticks_since_boot();
+
+  /* The clock ticks caught up after the idle period are all accounted */
+  rtems_test_assert(ticks_1 - ticks_0 >= ticks);
+  rtems_test_assert(ticks_1 - ticks_0 <= ticks + 1);
+
+  check_elapsed(
+    "wake after",
+    ticks * ns_per_tick(),
+    t0,
+    t1,
+    ticks_1 - ticks_0
+  );
+}
+
+static void test_nanosleep(uint64_t ns)
+{
+  struct timespec ts;
+  rtems_interval ticks_0;
+  rtems_interval ticks_1;
+  uint64_t t0;
+  uint64_t t1;
+  int rv;
+
+  ts.tv_sec = (time_t) (ns / 1000000000);
+  ts.tv_nsec = (long) (ns % 1000000000);
+
+  ticks_0 = rtems_clock_get_ticks_since_boot();
+  t0 = rtems_clock_get_uptime_nanoseconds();
+
+  rv = clock_nanosleep(CLOCK_MONOTONIC, 0, &ts, NULL);
+  rtems_test_assert(rv == 0);
+
+  t1 = rtems_clock_get_uptime_nanoseconds();
+  ticks_1 = rtems_clock_get_ticks_since_boot();
+
+  rtems_test_assert(t1 - t0 >= ns);
+  check_elapsed("nanosleep", ns, t0, t1, ticks_1 - ticks_0);
+}
+
+static void test(void)
+{
+  size_t i;
+#ifdef BSP_ARMV7M_SYSTICK_TICKLESS_IDLE
+  ARMV7M_Clock_tickless_statistics s0;
+  ARMV7M_Clock_tickless_statistics s1;
+
+  _ARMV7M_Clock_get_tickless_statistics(&s0);
+#endif
+
+  for (i = 0; i < RTEMS_ARRAY_SIZE(sleep_ticks); ++i) {
+    test_wake_after(sleep_ticks[i]);
+  }
+
+  test_nanosleep(123456789);
+  test_nanosleep(2500000000);
+
+#ifdef BSP_ARMV7M_SYSTICK_TICKLESS_IDLE
+  _ARMV7M_Clock_get_tickless_statistics(&s1);
+
+  printf(
+    "tickless idle periods: %" PRIu32 "\n"
+    "avoided clock tick interrupts: %" PRIu64 "\n",
+    s1.idle_periods - s0.idle_periods,
+    s1.suppressed_ticks - s0.suppressed_ticks
+  );
+
+  rtems_test_assert(s1.idle_periods > s0.idle_periods);
+  rtems_test_assert(s1.suppressed_ticks > s0.suppressed_ticks);
+#else
+  printf("tickless idle mode is not enabled\n");
+#endif
+}
+
+static void Init(rtems_task_argument arg)
+{
+  TEST_BEGIN();
+
+  test();
+
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+
+#define CONFIGURE_MAXIMUM_TASKS 1
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
@@ -0,0 +1,229 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (c) 2026 Dave Rush.  All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems.h>
+
+#include <tmacros.h>
+
+const char rtems_test_name[] = "SPPARTITION 1";
+
+#define BUFFER_COUNT 4
+
+#define BUFFER_SIZE 32
+
+static RTEMS_ALIGNED(RTEMS_PARTITION_ALIGNMENT) char
+  buffer_area[BUFFER_COUNT][BUFFER_SIZE];
+
+static rtems_id create_partition(rtems_attribute attribute_set)
+{
+  rtems_status_code sc;
+  rtems_id id;
+
+  sc = rtems_partition_create(
+    rtems_build_name('P', 'A', 'R', 'T'),
+    buffer_area,
+    sizeof(buffer_area),
+    BUFFER_SIZE,
+    attribute_set,
+    &id
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  return id;
+}
+
+static void delete_partition(rtems_id id)
+{
+  rtems_status_code sc;
+
+  sc = rtems_partition_delete(id);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+}
+
+static void *get_buffer(rtems_id id)
+{
+  rtems_status_code sc;
+  void *buffer;
+
+  sc = rtems_partition_get_buffer(id, &buffer);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  return buffer;
+}
+
+static void return_buffer(rtems_id id, void *buffer)
+{
+  rtems_status_code sc;
+
+  sc = rtems_partition_return_buffer(id, buffer);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+}
+
+static void check_information(
+  rtems_id id,
+  uintptr_t used_buffers,
+  uint32_t lock_acquisitions
+)
+{
+  rtems_partition_information info;
+  rtems_status_code sc;
+
+  sc = rtems_partition_get_information(id, &info);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  rtems_test_assert(info.buffer_count == BUFFER_COUNT);
+  rtems_test_assert(info.used_buffers == used_buffers);
+  rtems_test_assert(info.free_buffers == BUFFER_COUNT - used_buffers);
+  rtems_test_assert(info.lock_acquisitions == lock_acquisitions);
+  rtems_test_assert(info.cache_refills == 0);
+  rtems_test_assert(info.cache_drains == 0);
+}
+
+static void test_information_errors(void)
+{
+  rtems_partition_information info;
+  rtems_status_code sc;
+  rtems_id id;
+
+  id = create_partition(RTEMS_DEFAULT_ATTRIBUTES);
+
+  sc = rtems_partition_get_information(id, NULL);
+  rtems_test_assert(sc == RTEMS_INVALID_ADDRESS);
+
+  delete_partition(id);
+
+  sc = rtems_partition_get_information(id, &info);
+  rtems_test_assert(sc == RTEMS_INVALID_ID);
+}
+
+static void test_information(rtems_attribute attribute_set)
+{
+  rtems_status_code sc;
+  rtems_id id;
+  void *buffers[BUFFER_COUNT];
+  void *buffer;
+  size_t i;
+
+  id = create_partition(attribute_set);
+  check_information(id, 0, 0);
+
+  for (i = 0; i < BUFFER_COUNT; ++i) {
+    buffers[i] = get_buffer(id);
+    check_information(id, i + 1, i + 1);
+  }
+
+  /* A failed get obtains the partition lock as well */
+  sc = rtems_partition_get_buffer(id, &buffer);
+  rtems_test_assert(sc == RTEMS_UNSATISFIED);
+  check_information(id, BUFFER_COUNT, BUFFER_COUNT + 1);
+
+  /* An invalid buffer is not counted */
+  sc = rtems_partition_return_buffer(id, &buffer_area[0][1]);
+  rtems_test_assert(sc == RTEMS_INVALID_ADDRESS);
+  check_information(id, BUFFER_COUNT, BUFFER_COUNT + 1);
+
+  for (i = 0; i < BUFFER_COUNT; ++i) {
+    return_buffer(id, buffers[i]);
+    check_information(id, BUFFER_COUNT - i - 1, BUFFER_COUNT + i + 2);
+  }
+
+  delete_partition(id);
+}
+
+static void test_reuse_order(rtems_attribute attribute_set, bool lifo)
+{
+  rtems_id id;
+  void *buffer;
+  size_t i;
+
+  id = create_partition(attribute_set);
+
+  /* The free buffers are initially in address order */
+  buffer = get_buffer(id);
+  rtems_test_assert(buffer == buffer_area[0]);
+  return_buffer(id, buffer);
+
+  buffer = get_buffer(id);
+
+  if (lifo) {
+    rtems_test_assert(buffer == buffer_area[0]);
+  } else {
+    rtems_test_assert(buffer == buffer_area[1]);
+  }
+
+  return_buffer(id, buffer);
+
+  for (i = 0; i < BUFFER_COUNT; ++i) {
+    (void) get_buffer(id);
+  }
+
+  for (i = 0; i < BUFFER_COUNT; ++i) {
+    return_buffer(id, buffer_area[i]);
+  }
+
+  for (i = 0; i < BUFFER_COUNT; ++i) {
+    buffer = get_buffer(id);
+
+    if (lifo) {
+      rtems_test_assert(buffer == buffer_area[BUFFER_COUNT - i - 1]);
+    } else {
+      rtems_test_assert(buffer == buffer_area[i]);
+    }
+  }
+
+  delete_partition(id);
+}
+
+static void Init(rtems_task_argument arg)
+{
+  TEST_BEGIN();
+  test_information_errors();
+  test_information(RTEMS_DEFAULT_ATTRIBUTES);
+  test_information(RTEMS_PARTITION_PER_CPU_CACHE);
+  test_reuse_order(RTEMS_DEFAULT_ATTRIBUTES, false);
+  test_reuse_order(RTEMS_PARTITION_PER_CPU_CACHE, true);
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_DOES_NOT_NEED_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_MAXIMUM_PARTITIONS 1
+
+#define CONFIGURE_MAXIMUM_TASKS 1
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
@@ -250,6 +250,188 @@ static void test_watchdog_operations( void )
   _Watchdog_Header_destroy( &header );
 }
 
+static uint64_t test_watchdog_wheel_tick(
+  Watchdog_Header *header,
+  uint64_t now
+)
+{
+  ISR_LOCK_DEFINE( , lock, "Test" )
+  ISR_lock_Context lock_context;
+
+  _ISR_lock_ISR_disable_and_acquire( &lock, &lock_context );
+
+  ++now;
+  _Watchdog_Wheel_tickle( header->wheel, now, &lock, &lock_context );
+
+  _ISR_lock_Release_and_ISR_enable( &lock, &lock_context );
+  _ISR_lock_Destroy( &lock );
+
+  return now;
+}
+
+static const uint64_t test_watchdog_intervals[] = {
+  5, 70, 5, 4096, 1, 70, 300000, 4100, 64, 5, 0, 262144, 63, 4095, 64
+};
+
+#define TEST_WATCHDOG_COUNT RTEMS_ARRAY_SIZE( test_watchdog_intervals )
+
+static Watchdog_Wheel test_watchdog_wheel;
+
+static Watchdog_Control test_watchdog_tree_watchdogs[ TEST_WATCHDOG_COUNT ];
+
+static Watchdog_Control test_watchdog_wheel_watchdogs[ TEST_WATCHDOG_COUNT ];
+
+static size_t test_watchdog_tree_order[ TEST_WATCHDOG_COUNT ];
+
+static size_t test_watchdog_tree_order_count;
+
+static size_t test_watchdog_wheel_order[ TEST_WATCHDOG_COUNT ];
+
+static size_t test_watchdog_wheel_order_count;
+
+static void test_watchdog_order_routine( Watchdog_Control *base )
+{
+  size_t index;
+
+  index = (size_t) ( base - &test_watchdog_tree_watchdogs[ 0 ] );
+
+  if ( index < TEST_WATCHDOG_COUNT ) {
+    rtems_test_assert( test_watchdog_tree_order_count < TEST_WATCHDOG_COUNT );
+    test_watchdog_tree_order[ test_watchdog_tree_order_count ] = index;
+    ++test_watchdog_tree_order_count;
+  } else {
+    index = (size_t) ( base - &test_watchdog_wheel_watchdogs[ 0 ] );
+    rtems_test_assert( index < TEST_WATCHDOG_COUNT );
+    rtems_test_assert( test_watchdog_wheel_order_count < TEST_WATCHDOG_COUNT );
+    test_watchdog_wheel_order[ test_watchdog_wheel_order_count ] = index;
+    ++test_watchdog_wheel_order_count;
+  }
+}
+
+static void test_watchdog_wheel_operations( void )
+{
+  Watchdog_Header tree_header;
+  Watchdog_Header wheel_header;
+  uint64_t tree_now;
+  uint64_t now;
+  uint64_t expire;
+  test_watchdog a;
+  test_watchdog b;
+  size_t i;
+
+  _Watchdog_Header_initialize( &tree_header );
+  _Watchdog_Header_initialize( &wheel_header );
+  rtems_test_assert( wheel_header.wheel == NULL );
+  _Watchdog_Wheel_initialize( &test_watchdog_wheel, 0 );
+  wheel_header.wheel = &test_watchdog_wheel;
+  rtems_test_assert( !_Watchdog_Header_next_expire( &wheel_header, &expire ) );
+
+  test_watchdog_init( &a, 10 );
+  test_watchdog_init( &b, 20 );
+
+  _Watchdog_Insert( &wheel_header, &a.Base, 2 );
+  rtems_test_assert( _RBTree_Is_empty( &wheel_header.Watchdogs ) );
+  rtems_test_assert( wheel_header.first == NULL );
+  rtems_test_assert( !test_watchdog_is_inactive( &a ) );
+  rtems_test_assert( a.Base.expire == 2 );
+  rtems_test_assert( _Watchdog_Header_next_expire( &wheel_header, &expire ) );
+  rtems_test_assert( expire == 2 );
+
+  _Watchdog_Remove( &wheel_header, &a.Base );
+  rtems_test_assert( test_watchdog_is_inactive( &a ) );
+  rtems_test_assert( !_Watchdog_Header_next_expire( &wheel_header, &expire ) );
+
+  _Watchdog_Remove( &wheel_header, &a.Base );
+  rtems_test_assert( test_watchdog_is_inactive( &a ) );
+
+  _Watchdog_Insert( &wheel_header, &a.Base, 2 );
+  _Watchdog_Insert( &wheel_header, &b.Base, 100 );
+  rtems_test_assert( _Watchdog_Header_next_expire( &wheel_header, &expire ) );
+  rtems_test_assert( expire == 2 );
+
+  now = test_watchdog_wheel_tick( &wheel_header, 0 );
+  rtems_test_assert( !test_watchdog_is_inactive( &a ) );
+  rtems_test_assert( a.counter == 10 );
+
+  now = test_watchdog_wheel_tick( &wheel_header, now );
+  rtems_test_assert( test_watchdog_is_inactive( &a ) );
+  rtems_test_assert( a.counter == 11 );
+
+  /* The lower bound is the cascade of the second level slot */
+  rtems_test_assert( _Watchdog_Header_next_expire( &wheel_header, &expire ) );
+  rtems_test_assert( expire == 64 );
+
+  /* A watchdog which is already expired fires with the next tick */
+  _Watchdog_Insert( &wheel_header, &a.Base, now );
+  rtems_test_assert( _Watchdog_Header_next_expire( &wheel_header, &expire ) );
+  rtems_test_assert( expire == now );
+
+  now = test_watchdog_wheel_tick( &wheel_header, now );
+  rtems_test_assert( test_watchdog_is_inactive( &a ) );
+  rtems_test_assert( a.counter == 12 );
+
+  while ( now < 99 ) {
+    now = test_watchdog_wheel_tick( &wheel_header, now );
+  }
+
+  rtems_test_assert( !test_watchdog_is_inactive( &b ) );
+  rtems_test_assert( b.counter == 20 );
+  rtems_test_assert( _Watchdog_Header_next_expire( &wheel_header, &expire ) );
+  rtems_test_assert( expire == 100 );
+
+  now = test_watchdog_wheel_tick( &wheel_header, now );
+  rtems_test_assert( test_watchdog_is_inactive( &b ) );
+  rtems_test_assert( b.counter == 21 );
+  rtems_test_assert( !_Watchdog_Header_next_expire( &wheel_header, &expire ) );
+
+  /* The expiration order must be equal to the order of the red-black tree */
+  tree_now = now;
+
+  for ( i = 0; i < TEST_WATCHDOG_COUNT; ++i ) {
+    Watchdog_Control *tree_watchdog;
+    Watchdog_Control *wheel_watchdog;
+
+    tree_watchdog = &test_watchdog_tree_watchdogs[ i ];
+    _Watchdog_Preinitialize( tree_watchdog, _Per_CPU_Get_snapshot() );
+    _Watchdog_Initialize( tree_watchdog, test_watchdog_order_routine );
+    _Watchdog_Insert(
+      &tree_header,
+      tree_watchdog,
+      now + test_watchdog_intervals[ i ]
+    );
+
+    wheel_watchdog = &test_watchdog_wheel_watchdogs[ i ];
+    _Watchdog_Preinitialize( wheel_watchdog, _Per_CPU_Get_snapshot() );
+    _Watchdog_Initialize( wheel_watchdog, test_watchdog_order_routine );
+    _Watchdog_Insert(
+      &wheel_header,
+      wheel_watchdog,
+      now + test_watchdog_intervals[ i ]
+    );
+  }
+
+  while ( test_watchdog_wheel_order_count < TEST_WATCHDOG_COUNT ) {
+    tree_now = test_watchdog_tick( &tree_header, tree_now );
+    now = test_watchdog_wheel_tick( &wheel_header, now );
+    rtems_test_assert( tree_now == now );
+    rtems_test_assert(
+      test_watchdog_tree_order_count == test_watchdog_wheel_order_count
+    );
+  }
+
+  rtems_test_assert( _RBTree_Is_empty( &tree_header.Watchdogs ) );
+  rtems_test_assert( !_Watchdog_Header_next_expire( &wheel_header, &expire ) );
+
+  for ( i = 0; i < TEST_WATCHDOG_COUNT; ++i ) {
+    rtems_test_assert(
+      test_watchdog_tree_order[ i ] == test_watchdog_wheel_order[ i ]
+    );
+  }
+
+  _Watchdog_Header_destroy( &tree_header );
+  _Watchdog_Header_destroy( &wheel_header );
+}
+
 rtems_task Init(
   rtems_task_argument argument
 )
@@ -260,6 +442,7 @@ rtems_task Init(
   TEST_BEGIN();
 
   test_watchdog_operations();
+  test_watchdog_wheel_operations();
   test_watchdog_static_init();
   test_watchdog_config();
 
@@ -0,0 +1,211 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (c) 2026 Dave Rush.  All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "tmacros.h"
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+
+#include <rtems.h>
+#include <rtems/counter.h>
+#include <rtems/printer.h>
+
+#include <bsp.h>
+#include <bsp/boot-profile.h>
+#include <bsp/deferred-init.h>
+#include <bsp/start.h>
+
+const char rtems_test_name[] = "TMBOOT 1";
+
+#define SAMPLE_COUNT 16
+
+#define MAX_SIZE 4096
+
+typedef struct {
+  int src[MAX_SIZE / sizeof(int) + 8];
+  int dst[MAX_SIZE / sizeof(int) + 8];
+} test_context;
+
+static test_context test_instance;
+
+static const size_t sizes[] = { 4, 12, 16, 20, 60, 64, 256, MAX_SIZE };
+
+static void test_copy(test_context *ctx, size_t size)
+{
+  size_t words;
+  size_t i;
+
+  words = size / sizeof(int);
+
+  for (i = 0; i < RTEMS_ARRAY_SIZE(ctx->src); ++i) {
+    ctx->src[i] = (int) (i * 0x01010101U + 1);
+    ctx->dst[i] = -1;
+  }
+
+  bsp_start_memcpy(ctx->dst, ctx->src, size);
+
+  for (i = 0; i < words; ++i) {
+    rtems_test_assert(ctx->dst[i] == ctx->src[i]);
+  }
+
+  /* Nothing is written past the end */
+  for (; i < RTEMS_ARRAY_SIZE(ctx->dst); ++i) {
+    rtems_test_assert(ctx->dst[i] == -1);
+  }
+}
+
+static void measure_copy(test_context *ctx, size_t size)
+{
+  uint32_t start_min;
+  uint32_t libc_min;
+  int i;
+
+  start_min = UINT32_MAX;
+  libc_min = UINT32_MAX;
+
+  for (i = 0; i < SAMPLE_COUNT; ++i) {
+    rtems_counter_ticks begin;
+    uint32_t ns;
+
+    begin = rtems_counter_read();
+    bsp_start_memcpy(ctx->dst, ctx->src, size);
+    ns = (uint32_t) rtems_counter_ticks_to_nanoseconds(
+      rtems_counter_difference(rtems_counter_read(), begin)
+    );
+
+    if (ns < start_min) {
+      start_min = ns;
+    }
+
+    begin = rtems_counter_read();
+    memcpy(ctx->dst, ctx->src, size);
+    ns = (uint32_t) rtems_counter_ticks_to_nanoseconds(
+      rtems_counter_difference(rtems_counter_read(), begin)
+    );
+
+    if (ns < libc_min) {
+      libc_min = ns;
+    }
+  }
+
+  printf(
+    "  <Copy><Size>%zu</Size>"
+    "<StartMemcpy unit=\"ns\">%" PRIu32 "</StartMemcpy>"
+    "<Memcpy unit=\"ns\">%" PRIu32 "</Memcpy></Copy>\n",
+    size,
+    start_min,
+    libc_min
+  );
+}
+
+static void test_deferred_init(void)
+{
+#ifdef MK64F12_DEFERRED_INIT
+  rtems_status_code sc;
+  int ticks;
+
+  /* The idle thread calls the deferred handlers while this task waits */
+  for (ticks = 0; !mk64f12_deferred_init_is_done(); ++ticks) {
+    sc = rtems_task_wake_after(1);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+    rtems_test_assert(ticks < 1000);
+  }
+
+  printf("  <DeferredInit><Ticks>%i</Ticks></DeferredInit>\n", ticks);
+#endif
+}
+
+static void print_boot_profile(void)
+{
+#ifdef MK64F12_BOOT_PROFILE
+  const mk64f12_boot_profile_step *steps;
+  rtems_printer printer;
+  size_t count;
+  size_t i;
+  uint32_t end;
+
+  count = mk64f12_boot_profile_get_steps(&steps);
+  rtems_test_assert(count > 3);
+
+  /* The end times of the start and system initialization steps increase */
+  end = 0;
+
+  for (i = 0; i < count; ++i) {
+    if (!steps[i].deferred) {
+      rtems_test_assert(steps[i].end_ns >= end);
+      end = steps[i].end_ns;
+    }
+  }
+
+  rtems_print_printer_printf(&printer);
+  mk64f12_boot_profile_print(&printer);
+#endif
+}
+
+static void Init(rtems_task_argument arg)
+{
+  test_context *ctx;
+  size_t i;
+
+  TEST_BEGIN();
+
+  ctx = &test_instance;
+
+  printf("<TMBOOT01>\n");
+
+  for (i = 0; i < RTEMS_ARRAY_SIZE(sizes); ++i) {
+    test_copy(ctx, sizes[i]);
+    measure_copy(ctx, sizes[i]);
+  }
+
+  test_deferred_init();
+  printf("</TMBOOT01>\n");
+  print_boot_profile();
+
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_CONSOLE_DRIVER
+
+#define CONFIGURE_MAXIMUM_TASKS 1
+
+#define CONFIGURE_INIT_TASK_INITIAL_MODES RTEMS_DEFAULT_MODES
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
@@ -0,0 +1,311 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (c) 2026 Dave Rush.  All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "tmacros.h"
+
+#include <inttypes.h>
+#include <stdio.h>
+
+#include <rtems.h>
+
+#include <bsp.h>
+#include <bsp/clock-scaling.h>
+#include <bsp/mk64f12.h>
+
+const char rtems_test_name[] = "TMCLOCK 1";
+
+#define SAMPLE_COUNT 16
+
+#define SLEEP_TICKS 10
+
+typedef struct {
+  mk64f12_clock_listener listener;
+  uint32_t prepare;
+  uint32_t update;
+  uint32_t complete;
+  uint32_t core_clock;
+  bool order_ok;
+} test_context;
+
+static test_context test_instance;
+
+typedef struct {
+  const char *name;
+  mk64f12_clock_mode from;
+  mk64f12_clock_mode to;
+} transition;
+
+static const transition transitions[] = {
+  { "Run120ToRun60", MK64F12_CLOCK_MODE_RUN_120MHZ,
+    MK64F12_CLOCK_MODE_RUN_60MHZ },
+  { "Run60ToRun120", MK64F12_CLOCK_MODE_RUN_60MHZ,
+    MK64F12_CLOCK_MODE_RUN_120MHZ },
+  { "Run120ToVLPR", MK64F12_CLOCK_MODE_RUN_120MHZ,
+    MK64F12_CLOCK_MODE_VLPR_4MHZ },
+  { "VLPRToRun120", MK64F12_CLOCK_MODE_VLPR_4MHZ,
+    MK64F12_CLOCK_MODE_RUN_120MHZ }
+};
+
+static void listener_prepare(mk64f12_clock_listener *listener)
+{
+  test_context *ctx = RTEMS_CONTAINER_OF(listener, test_context, listener);
+
+  if (ctx->prepare != ctx->update || ctx->prepare != ctx->complete) {
+    ctx->order_ok = false;
+  }
+
+  ++ctx->prepare;
+}
+
+static void listener_update(mk64f12_clock_listener *listener)
+{
+  test_context *ctx = RTEMS_CONTAINER_OF(listener, test_context, listener);
+
+  if (ctx->prepare != ctx->update + 1) {
+    ctx->order_ok = false;
+  }
+
+  ctx->core_clock = SystemCoreClock;
+  ++ctx->update;
+}
+
+static void listener_complete(mk64f12_clock_listener *listener)
+{
+  test_context *ctx = RTEMS_CONTAINER_OF(listener, test_context, listener);
+
+  if (ctx->update != ctx->complete + 1) {
+    ctx->order_ok = false;
+  }
+
+  ++ctx->complete;
+}
+
+static void set_mode(mk64f12_clock_mode mode)
+{
+  rtems_status_code sc;
+  uint64_t before;
+  uint64_t after;
+
+  before = rtems_clock_get_uptime_nanoseconds();
+  sc = mk64f12_clock_set_mode(mode);
+  after = rtems_clock_get_uptime_nanoseconds();
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  rtems_test_assert(mk64f12_clock_get_mode() == mode);
+  rtems_test_assert(SystemCoreClock == CLOCK_GetCoreSysClkFreq());
+  rtems_test_assert(after >= before);
+}
+
+static void test_invalid(void)
+{
+  mk64f12_clock_statistics before;
+  mk64f12_clock_statistics after;
+  rtems_status_code sc;
+
+  rtems_test_assert(mk64f12_clock_get_mode() == MK64F12_CLOCK_MODE_RUN_120MHZ);
+  rtems_test_assert(SystemCoreClock == 120000000);
+
+  sc = mk64f12_clock_set_mode(MK64F12_CLOCK_MODE_COUNT);
+  rtems_test_assert(sc == RTEMS_INVALID_NUMBER);
+
+  mk64f12_clock_get_statistics(&before);
+  sc = mk64f12_clock_set_mode(MK64F12_CLOCK_MODE_RUN_120MHZ);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  mk64f12_clock_get_statistics(&after);
+  rtems_test_assert(after.switches == before.switches);
+}
+
+static void test_listener(test_context *ctx)
+{
+  ctx->listener.prepare = listener_prepare;
+  ctx->listener.update = listener_update;
+  ctx->listener.complete = listener_complete;
+  ctx->order_ok = true;
+  mk64f12_clock_add_listener(&ctx->listener);
+
+  set_mode(MK64F12_CLOCK_MODE_RUN_60MHZ);
+  rtems_test_assert(ctx->core_clock == 60000000);
+  set_mode(MK64F12_CLOCK_MODE_RUN_120MHZ);
+  rtems_test_assert(ctx->core_clock == 120000000);
+
+  mk64f12_clock_remove_listener(&ctx->listener);
+  set_mode(MK64F12_CLOCK_MODE_RUN_60MHZ);
+  set_mode(MK64F12_CLOCK_MODE_RUN_120MHZ);
+
+  rtems_test_assert(ctx->order_ok);
+  rtems_test_assert(ctx->prepare == 2);
+  rtems_test_assert(ctx->update == 2);
+  rtems_test_assert(ctx->complete == 2);
+}
+
+static void test_tick_interval(mk64f12_clock_mode mode)
+{
+  rtems_status_code sc;
+  uint64_t interval;
+  uint64_t before;
+  uint64_t elapsed;
+
+  set_mode(mode);
+  interval = (uint64_t) rtems_configuration_get_nanoseconds_per_tick();
+
+  /* Start right after a clock tick */
+  sc = rtems_task_wake_after(1);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  before = rtems_clock_get_uptime_nanoseconds();
+  sc = rtems_task_wake_after(SLEEP_TICKS);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  elapsed = rtems_clock_get_uptime_nanoseconds() - before;
+
+  printf(
+    "  <TickInterval><Mode>%i</Mode><SystemCoreClock>%" PRIu32
+    "</SystemCoreClock><Elapsed unit=\"ns\">%" PRIu64 "</Elapsed>"
+    "</TickInterval>\n",
+    (int) mode,
+    SystemCoreClock,
+    elapsed
+  );
+  rtems_test_assert(elapsed >= (SLEEP_TICKS - 1) * interval);
+  rtems_test_assert(elapsed <= (SLEEP_TICKS + 1) * interval);
+}
+
+static void measure_transition(const transition *t)
+{
+  uint32_t switch_min;
+  uint32_t switch_max;
+  uint32_t disabled_min;
+  uint32_t disabled_max;
+  int i;
+
+  switch_min = UINT32_MAX;
+  switch_max = 0;
+  disabled_min = UINT32_MAX;
+  disabled_max = 0;
+
+  for (i = 0; i < SAMPLE_COUNT; ++i) {
+    mk64f12_clock_statistics stats;
+
+    set_mode(t->from);
+    set_mode(t->to);
+    mk64f12_clock_get_statistics(&stats);
+
+    if (stats.last_switch_ns < switch_min) {
+      switch_min = stats.last_switch_ns;
+    }
+
+    if (stats.last_switch_ns > switch_max) {
+      switch_max = stats.last_switch_ns;
+    }
+
+    if (stats.last_disabled_ns < disabled_min) {
+      disabled_min = stats.last_disabled_ns;
+    }
+
+    if (stats.last_disabled_ns > disabled_max) {
+      disabled_max = stats.last_disabled_ns;
+    }
+  }
+
+  printf(
+    "  <%s><Switch><Min unit=\"ns\">%" PRIu32 "</Min>"
+    "<Max unit=\"ns\">%" PRIu32 "</Max></Switch>"
+    "<InterruptsDisabled><Min unit=\"ns\">%" PRIu32 "</Min>"
+    "<Max unit=\"ns\">%" PRIu32 "</Max></InterruptsDisabled></%s>\n",
+    t->name,
+    switch_min,
+    switch_max,
+    disabled_min,
+    disabled_max,
+    t->name
+  );
+}
+
+static void print_statistics(void)
+{
+  mk64f12_clock_statistics stats;
+
+  mk64f12_clock_get_statistics(&stats);
+  printf(
+    "  <Statistics><Switches>%" PRIu32 "</Switches>"
+    "<Failures>%" PRIu32 "</Failures>"
+    "<MaxSwitch unit=\"ns\">%" PRIu32 "</MaxSwitch>"
+    "<MaxInterruptsDisabled unit=\"ns\">%" PRIu32 "</MaxInterruptsDisabled>"
+    "</Statistics>\n",
+    stats.switches,
+    stats.failures,
+    stats.max_switch_ns,
+    stats.max_disabled_ns
+  );
+  rtems_test_assert(stats.failures == 0);
+}
+
+static void Init(rtems_task_argument arg)
+{
+  test_context *ctx;
+  size_t i;
+
+  TEST_BEGIN();
+
+  ctx = &test_instance;
+
+  printf("<TMCLOCK01>\n");
+  test_invalid();
+  test_listener(ctx);
+  test_tick_interval(MK64F12_CLOCK_MODE_RUN_60MHZ);
+  test_tick_interval(MK64F12_CLOCK_MODE_VLPR_4MHZ);
+  test_tick_interval(MK64F12_CLOCK_MODE_RUN_120MHZ);
+
+  for (i = 0; i < RTEMS_ARRAY_SIZE(transitions); ++i) {
+    measure_transition(&transitions[i]);
+  }
+
+  set_mode(MK64F12_CLOCK_MODE_RUN_120MHZ);
+  print_statistics();
+  printf("</TMCLOCK01>\n");
+
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_CONSOLE_DRIVER
+
+#define CONFIGURE_MAXIMUM_TASKS 1
+
+#define CONFIGURE_INIT_TASK_INITIAL_MODES RTEMS_DEFAULT_MODES
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
@@ -59,6 +59,26 @@ static volatile int *main_data;
 
 static Context_Control ctx;
 
+typedef enum {
+  FP_SWITCH_NONE,
+  FP_SWITCH_MIXED,
+  FP_SWITCH_ALL
+} fp_switch_variant;
+
+static const char * const fp_switch_names[] = {
+  "none",
+  "mixed",
+  "all"
+};
+
+static rtems_id fp_switch_init_id;
+
+static volatile rtems_counter_ticks fp_switch_begin;
+
+static volatile int fp_switch_sample;
+
+static volatile float fp_switch_value;
+
 static int dirty_data_cache(volatile int *data, size_t n, size_t clsz, int j)
 {
   size_t m = n / sizeof(*data);
@@ -149,29 +169,14 @@ static void sort_t(void)
   qsort(&t[0], SAMPLES, sizeof(t[0]), cmp);
 }
 
-static void test_by_function_level(int fl, bool dirty)
+static void print_quartiles(void)
 {
-  RTEMS_INTERRUPT_LOCK_DECLARE(, lock)
-  rtems_interrupt_lock_context lock_context;
-  int s;
   uint64_t min;
   uint64_t q1;
   uint64_t q2;
   uint64_t q3;
   uint64_t max;
 
-  fl += prevent_optimization;
-
-  rtems_interrupt_lock_initialize(&lock, "test");
-  rtems_interrupt_lock_acquire(&lock, &lock_context);
-
-  for (s = 0; s < SAMPLES; ++s) {
-    call_at_level(fl, fl, s, dirty);
-  }
-
-  rtems_interrupt_lock_release(&lock, &lock_context);
-  rtems_interrupt_lock_destroy(&lock);
-
   sort_t();
 
   min = t[0];
@@ -181,14 +186,11 @@ static void test_by_function_level(int fl, bool dirty)
   max = t[SAMPLES - 1];
 
   printf(
-    "    <Sample functionNestLevel=\"%i\">\n"
     "      <Min unit=\"ns\">%" PRIu64 "</Min>"
       "<Q1 unit=\"ns\">%" PRIu64 "</Q1>"
       "<Q2 unit=\"ns\">%" PRIu64 "</Q2>"
       "<Q3 unit=\"ns\">%" PRIu64 "</Q3>"
-      "<Max unit=\"ns\">%" PRIu64 "</Max>\n"
-    "    </Sample>\n",
-    fl,
+      "<Max unit=\"ns\">%" PRIu64 "</Max>\n",
     rtems_counter_ticks_to_nanoseconds(min),
     rtems_counter_ticks_to_nanoseconds(q1),
     rtems_counter_ticks_to_nanoseconds(q2),
@@ -197,6 +199,29 @@ static void test_by_function_level(int fl, bool dirty)
   );
 }
 
+static void test_by_function_level(int fl, bool dirty)
+{
+  RTEMS_INTERRUPT_LOCK_DECLARE(, lock)
+  rtems_interrupt_lock_context lock_context;
+  int s;
+
+  fl += prevent_optimization;
+
+  rtems_interrupt_lock_initialize(&lock, "test");
+  rtems_interrupt_lock_acquire(&lock, &lock_context);
+
+  for (s = 0; s < SAMPLES; ++s) {
+    call_at_level(fl, fl, s, dirty);
+  }
+
+  rtems_interrupt_lock_release(&lock, &lock_context);
+  rtems_interrupt_lock_destroy(&lock);
+
+  printf("    <Sample functionNestLevel=\"%i\">\n", fl);
+  print_quartiles();
+  printf("    </Sample>\n");
+}
+
 static void test(bool dirty, uint32_t load)
 {
   int fl;
@@ -219,6 +244,89 @@ static void test(bool dirty, uint32_t load)
   printf("  </ContextSwitchTest>\n");
 }
 
+static void fp_switch_task(rtems_task_argument uses_fp)
+{
+  while (true) {
+    rtems_counter_ticks b;
+    int s;
+
+    if (uses_fp) {
+      fp_switch_value = fp_switch_value * 0.5f + 1.0f;
+    }
+
+    fp_switch_begin = rtems_counter_read();
+    rtems_task_wake_after(RTEMS_YIELD_PROCESSOR);
+    b = rtems_counter_read();
+
+    s = fp_switch_sample;
+    if (s < SAMPLES) {
+      t[s] = rtems_counter_difference(b, fp_switch_begin);
+      fp_switch_sample = s + 1;
+    } else {
+      rtems_event_transient_send(fp_switch_init_id);
+    }
+  }
+}
+
+static rtems_id fp_switch_start(bool uses_fp)
+{
+  rtems_status_code sc;
+  rtems_id id;
+
+  sc = rtems_task_create(
+    rtems_build_name('F', 'P', 'S', 'W'),
+    2,
+    RTEMS_MINIMUM_STACK_SIZE,
+    RTEMS_DEFAULT_MODES,
+    uses_fp ? RTEMS_FLOATING_POINT : RTEMS_DEFAULT_ATTRIBUTES,
+    &id
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_task_start(id, fp_switch_task, uses_fp);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  return id;
+}
+
+/*
+ * Measure the time from a yield of one task until the other task resumes.
+ * On targets with a lazy floating point context switch, only the tasks which
+ * use the floating point unit pay for the save and restore.
+ */
+static void test_fp_switch(fp_switch_variant variant)
+{
+  rtems_status_code sc;
+  rtems_id a;
+  rtems_id b;
+
+  fp_switch_init_id = rtems_task_self();
+  fp_switch_sample = 0;
+
+  a = fp_switch_start(variant != FP_SWITCH_NONE);
+  b = fp_switch_start(variant == FP_SWITCH_ALL);
+
+  sc = rtems_event_transient_receive(RTEMS_WAIT, RTEMS_NO_TIMEOUT);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_task_delete(a);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_task_delete(b);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  printf(
+    "  <FloatingPointSwitchTest tasks=\"%s\">\n"
+    "    <Sample>\n",
+    fp_switch_names[variant]
+  );
+  print_quartiles();
+  printf(
+    "    </Sample>\n"
+    "  </FloatingPointSwitchTest>\n"
+  );
+}
+
 static void Init(rtems_task_argument arg)
 {
   uint32_t load = 0;
@@ -243,6 +351,12 @@ static void Init(rtems_task_argument arg)
   test(false, load);
   test(true, load);
 
+  if (rtems_scheduler_get_processor_maximum() == 1) {
+    test_fp_switch(FP_SWITCH_NONE);
+    test_fp_switch(FP_SWITCH_MIXED);
+    test_fp_switch(FP_SWITCH_ALL);
+  }
+
   for (load = 1; load < rtems_scheduler_get_processor_maximum(); ++load) {
     rtems_status_code sc;
     rtems_id id;
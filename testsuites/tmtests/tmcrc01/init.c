@@ -0,0 +1,368 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (c) 2026 Dave Rush.  All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "tmacros.h"
+
+#include <fcntl.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <rtems.h>
+#include <rtems/counter.h>
+#include <rtems/crc32.h>
+#include <rtems/jffs2.h>
+#include <rtems/libio.h>
+
+#include <bsp/crc.h>
+#include <bsp/flash.h>
+
+const char rtems_test_name[] = "TMCRC 1";
+
+#define DATA_SIZE (16 * 1024)
+
+#define SAMPLE_COUNT 4
+
+#define SECTOR_COUNT 8
+
+#define AREA_SIZE (SECTOR_COUNT * MK64F12_FLASH_SECTOR_SIZE)
+
+#define FILE_COUNT 8
+
+#define MOUNT_POINT "/flash"
+
+typedef struct {
+  rtems_crc32_backend backend;
+  uint8_t data[DATA_SIZE + 3];
+  mk64f12_flash_sim sim;
+  mk64f12_flash_jffs2_control jffs2;
+  rtems_jffs2_mount_data mount_data;
+  uint8_t sim_memory[AREA_SIZE];
+} test_context;
+
+static test_context test_instance;
+
+static rtems_jffs2_compressor_control compressor_instance = {
+  .compress = rtems_jffs2_compressor_rtime_compress,
+  .decompress = rtems_jffs2_compressor_rtime_decompress
+};
+
+static const size_t sizes[] = { 16, 64, 256, 1024, 4096, DATA_SIZE };
+
+static void print_throughput(
+  const char *name,
+  size_t bytes,
+  rtems_counter_ticks ticks
+)
+{
+  uint64_t ns;
+  uint64_t kbs;
+
+  ns = rtems_counter_ticks_to_nanoseconds(ticks);
+  kbs = ((uint64_t) bytes * 1000000) / ns;
+  printf(
+    "    <%s><Bytes>%zu</Bytes><Time unit=\"ns\">%" PRIu64 "</Time>"
+    "<Throughput unit=\"MB/s\">%" PRIu64 ".%03" PRIu64 "</Throughput>"
+    "</%s>\n",
+    name,
+    bytes,
+    ns,
+    kbs / 1000,
+    kbs % 1000,
+    name
+  );
+}
+
+static void print_time(const char *name, rtems_counter_ticks ticks)
+{
+  printf(
+    "    <%s><Time unit=\"ns\">%" PRIu64 "</Time></%s>\n",
+    name,
+    rtems_counter_ticks_to_nanoseconds(ticks),
+    name
+  );
+}
+
+static void test_known_answers(void)
+{
+  static const char check[] = "123456789";
+  uint32_t crc;
+
+  crc = rtems_crc32_update_generic(0xffffffff, check, sizeof(check) - 1);
+  rtems_test_assert((crc ^ 0xffffffff) == 0xcbf43926);
+
+  crc = rtems_crc32_update(0xffffffff, check, sizeof(check) - 1);
+  rtems_test_assert((crc ^ 0xffffffff) == 0xcbf43926);
+}
+
+static void test_backend(test_context *ctx)
+{
+  size_t offset;
+  size_t len;
+
+  if (ctx->backend == NULL) {
+    return;
+  }
+
+  /*
+   * Cover all alignments, the sizes below the minimum of the backend, the
+   * processor feed and the eDMA feed with a remainder.
+   */
+  for (offset = 0; offset < 4; ++offset) {
+    for (len = 0; len <= DATA_SIZE; len = len < 128 ? len + 1 : len * 2 + 7) {
+      uint32_t expected;
+      uint32_t actual;
+
+      expected = rtems_crc32_update_generic(
+        0x12345678,
+        &ctx->data[offset],
+        len
+      );
+      actual = 0x12345678;
+
+      if (!(*ctx->backend)(&actual, &ctx->data[offset], len)) {
+        actual = expected;
+      }
+
+      rtems_test_assert(actual == expected);
+      rtems_test_assert(
+        rtems_crc32_update(0x12345678, &ctx->data[offset], len) == expected
+      );
+    }
+  }
+}
+
+static void measure_variant(
+  test_context *ctx,
+  const char *name,
+  rtems_crc32_backend backend
+)
+{
+  size_t i;
+
+  printf("  <Variant name=\"%s\">\n", name);
+  rtems_crc32_set_backend(backend);
+
+  for (i = 0; i < RTEMS_ARRAY_SIZE(sizes); ++i) {
+    char sample[32];
+    rtems_counter_ticks best;
+    int j;
+
+    best = 0;
+
+    for (j = 0; j < SAMPLE_COUNT; ++j) {
+      rtems_counter_ticks a;
+      rtems_counter_ticks b;
+      rtems_counter_ticks d;
+
+      a = rtems_counter_read();
+      (void) rtems_crc32_update(0xffffffff, ctx->data, sizes[i]);
+      b = rtems_counter_read();
+      d = rtems_counter_difference(b, a);
+
+      if (j == 0 || d < best) {
+        best = d;
+      }
+    }
+
+    snprintf(sample, sizeof(sample), "CRC32-%zu", sizes[i]);
+    print_throughput(sample, sizes[i], best);
+  }
+
+  printf("  </Variant>\n");
+}
+
+static void mount_flash(test_context *ctx)
+{
+  int rv;
+
+  rv = mount(
+    NULL,
+    MOUNT_POINT,
+    RTEMS_FILESYSTEM_TYPE_JFFS2,
+    RTEMS_FILESYSTEM_READ_WRITE,
+    &ctx->mount_data
+  );
+  rtems_test_assert(rv == 0);
+}
+
+static void unmount_flash(void)
+{
+  int rv;
+
+  rv = unmount(MOUNT_POINT);
+  rtems_test_assert(rv == 0);
+}
+
+static void populate_flash(test_context *ctx)
+{
+  int rv;
+  int i;
+
+  mk64f12_flash_sim_initialize(&ctx->sim, ctx->sim_memory, AREA_SIZE);
+  mk64f12_flash_jffs2_initialize(&ctx->jffs2, &ctx->sim.device, 0, AREA_SIZE);
+
+  memset(&ctx->mount_data, 0, sizeof(ctx->mount_data));
+  ctx->mount_data.flash_control = &ctx->jffs2.super;
+  ctx->mount_data.compressor_control = &compressor_instance;
+
+  rv = mount_and_make_target_path(
+    NULL,
+    MOUNT_POINT,
+    RTEMS_FILESYSTEM_TYPE_JFFS2,
+    RTEMS_FILESYSTEM_READ_WRITE,
+    &ctx->mount_data
+  );
+  rtems_test_assert(rv == 0);
+
+  for (i = 0; i < FILE_COUNT; ++i) {
+    char path[32];
+    ssize_t n;
+    int fd;
+
+    snprintf(path, sizeof(path), MOUNT_POINT "/file-%i", i);
+    fd = open(path, O_WRONLY | O_CREAT | O_TRUNC, S_IRWXU);
+    rtems_test_assert(fd >= 0);
+
+    n = write(fd, ctx->data, AREA_SIZE / (2 * FILE_COUNT));
+    rtems_test_assert(n == AREA_SIZE / (2 * FILE_COUNT));
+
+    rv = close(fd);
+    rtems_test_assert(rv == 0);
+  }
+
+  unmount_flash();
+}
+
+static void measure_mount(
+  test_context *ctx,
+  const char *name,
+  rtems_crc32_backend backend
+)
+{
+  rtems_counter_ticks best;
+  int i;
+
+  rtems_crc32_set_backend(backend);
+  best = 0;
+
+  for (i = 0; i < SAMPLE_COUNT; ++i) {
+    rtems_counter_ticks a;
+    rtems_counter_ticks b;
+    rtems_counter_ticks d;
+    struct stat st;
+    int rv;
+
+    a = rtems_counter_read();
+    mount_flash(ctx);
+    b = rtems_counter_read();
+    d = rtems_counter_difference(b, a);
+
+    if (i == 0 || d < best) {
+      best = d;
+    }
+
+    rv = stat(MOUNT_POINT "/file-0", &st);
+    rtems_test_assert(rv == 0);
+    rtems_test_assert(st.st_size == AREA_SIZE / (2 * FILE_COUNT));
+
+    unmount_flash();
+  }
+
+  printf("  <Variant name=\"%s\">\n", name);
+  print_time("JFFS2SimMount", best);
+  printf("  </Variant>\n");
+}
+
+static void Init(rtems_task_argument arg)
+{
+  test_context *ctx;
+  size_t i;
+
+  TEST_BEGIN();
+
+  ctx = &test_instance;
+
+  for (i = 0; i < sizeof(ctx->data); ++i) {
+    ctx->data[i] = (uint8_t) (i * 13 + (i >> 9));
+  }
+
+  /* The backend installed by the BSP */
+  ctx->backend = _CRC32_Backend;
+  printf(
+    "<TMCRC01>\n  <InstalledBackend>%s</InstalledBackend>\n",
+    ctx->backend == mk64f12_crc32_backend ? "CRC" : "None"
+  );
+  test_known_answers();
+  test_backend(ctx);
+
+  measure_variant(ctx, "Generic", NULL);
+
+  if (ctx->backend != NULL) {
+    measure_variant(ctx, "CRC", ctx->backend);
+  }
+
+  populate_flash(ctx);
+  measure_mount(ctx, "Generic", NULL);
+
+  if (ctx->backend != NULL) {
+    measure_mount(ctx, "CRC", ctx->backend);
+  }
+
+  rtems_crc32_set_backend(ctx->backend);
+  printf("</TMCRC01>\n");
+
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_CONSOLE_DRIVER
+
+#define CONFIGURE_FILESYSTEM_JFFS2
+
+#define CONFIGURE_MAXIMUM_FILE_DESCRIPTORS 5
+
+#define CONFIGURE_MAXIMUM_TASKS 1
+
+#define CONFIGURE_INIT_TASK_STACK_SIZE (8 * 1024)
+
+#define CONFIGURE_INIT_TASK_INITIAL_MODES RTEMS_DEFAULT_MODES
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
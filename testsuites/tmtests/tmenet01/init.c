@@ -0,0 +1,396 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (c) 2026 Dave Rush.  All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "tmacros.h"
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+
+#include <rtems.h>
+#include <rtems/counter.h>
+
+#include <bsp/enet.h>
+
+const char rtems_test_name[] = "TMENET 1";
+
+#define FRAME_COUNT 1000
+
+#define LATENCY_SAMPLES 100
+
+#define ETH_HEADER_SIZE 14
+
+#define IP_HEADER_SIZE 20
+
+#define UDP_HEADER_SIZE 8
+
+#define MAX_FRAME_SIZE 1514
+
+#define EVENT_RX RTEMS_EVENT_0
+
+#define EVENT_TX RTEMS_EVENT_1
+
+typedef struct {
+  rtems_id master;
+  size_t tx_pending;
+  size_t mismatches;
+  uint8_t frame[MAX_FRAME_SIZE] RTEMS_ALIGNED(CPU_CACHE_LINE_BYTES);
+} test_context;
+
+static test_context test_instance;
+
+static const uint8_t mac_address[6] = { 0x02, 0x00, 0x00, 0x4b, 0x36, 0x34 };
+
+static void rx_notify(void *arg)
+{
+  test_context *ctx = arg;
+
+  (void) rtems_event_send(ctx->master, EVENT_RX);
+}
+
+static void tx_done(void *arg, const void *frame, bool error)
+{
+  test_context *ctx = arg;
+
+  (void) frame;
+  rtems_test_assert(!error);
+  --ctx->tx_pending;
+  (void) rtems_event_send(ctx->master, EVENT_TX);
+}
+
+static void wait(rtems_event_set events)
+{
+  rtems_event_set out;
+  rtems_status_code sc;
+
+  sc = rtems_event_receive(
+    events,
+    RTEMS_EVENT_ANY | RTEMS_WAIT,
+    RTEMS_NO_TIMEOUT,
+    &out
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+}
+
+static void put_be16(uint8_t *p, uint16_t v)
+{
+  p[0] = (uint8_t) (v >> 8);
+  p[1] = (uint8_t) v;
+}
+
+/*
+ * Builds an IPv4/UDP frame to ourself with zero checksum fields, the MAC
+ * inserts them.
+ */
+static void build_frame(test_context *ctx, size_t size)
+{
+  uint8_t *eth = &ctx->frame[0];
+  uint8_t *ip = eth + ETH_HEADER_SIZE;
+  uint8_t *udp = ip + IP_HEADER_SIZE;
+  size_t ip_size;
+  size_t i;
+
+  ip_size = size - ETH_HEADER_SIZE;
+  memset(eth, 0, ETH_HEADER_SIZE + IP_HEADER_SIZE + UDP_HEADER_SIZE);
+  memcpy(&eth[0], mac_address, sizeof(mac_address));
+  memcpy(&eth[6], mac_address, sizeof(mac_address));
+  put_be16(&eth[12], 0x0800);
+
+  ip[0] = 0x45;
+  put_be16(&ip[2], (uint16_t) ip_size);
+  ip[8] = 64;
+  ip[9] = 17;
+  ip[12] = 10;
+  ip[15] = 1;
+  ip[16] = 10;
+  ip[19] = 1;
+
+  put_be16(&udp[0], 7);
+  put_be16(&udp[2], 7);
+  put_be16(&udp[4], (uint16_t) (ip_size - IP_HEADER_SIZE));
+
+  for (i = ETH_HEADER_SIZE + IP_HEADER_SIZE + UDP_HEADER_SIZE; i < size; ++i) {
+    ctx->frame[i] = (uint8_t) (i * 7 + (i >> 8));
+  }
+}
+
+static void transmit(test_context *ctx, size_t size)
+{
+  rtems_status_code sc;
+
+  while (true) {
+    rtems_interrupt_level level;
+
+    rtems_interrupt_local_disable(level);
+    ++ctx->tx_pending;
+    rtems_interrupt_local_enable(level);
+
+    sc = mk64f12_enet_transmit(
+      ctx->frame,
+      size,
+      MK64F12_ENET_TX_INSERT_IP_CHECKSUM
+        | MK64F12_ENET_TX_INSERT_PROTOCOL_CHECKSUM,
+      tx_done,
+      ctx
+    );
+
+    if (sc == RTEMS_SUCCESSFUL) {
+      break;
+    }
+
+    rtems_interrupt_local_disable(level);
+    --ctx->tx_pending;
+    rtems_interrupt_local_enable(level);
+
+    rtems_test_assert(sc == RTEMS_TOO_MANY);
+    wait(EVENT_TX);
+  }
+}
+
+static bool receive(test_context *ctx, size_t size)
+{
+  void *frame;
+  size_t rx_size;
+  uint32_t flags;
+  uint32_t expected_flags;
+  size_t payload;
+
+  frame = mk64f12_enet_receive(&rx_size, &flags);
+
+  if (frame == NULL) {
+    return false;
+  }
+
+  expected_flags = MK64F12_ENET_RX_IPV4 | MK64F12_ENET_RX_IP_CHECKSUM_OK
+    | MK64F12_ENET_RX_PROTOCOL_CHECKSUM_OK;
+  payload = ETH_HEADER_SIZE + IP_HEADER_SIZE + UDP_HEADER_SIZE;
+
+  if (
+    rx_size != size
+      || (flags & expected_flags) != expected_flags
+      || memcmp(
+        (const uint8_t *) frame + payload,
+        &ctx->frame[payload],
+        size - payload
+      ) != 0
+  ) {
+    ++ctx->mismatches;
+  }
+
+  mk64f12_enet_rx_buffer_return(frame);
+  return true;
+}
+
+static void test_throughput(test_context *ctx, size_t size)
+{
+  mk64f12_enet_statistics s0;
+  mk64f12_enet_statistics s1;
+  rtems_counter_ticks a;
+  rtems_counter_ticks b;
+  uint64_t ns;
+  size_t sent;
+  size_t received;
+
+  build_frame(ctx, size);
+  mk64f12_enet_get_statistics(&s0);
+  sent = 0;
+  received = 0;
+
+  a = rtems_counter_read();
+
+  while (received < FRAME_COUNT) {
+    while (sent < FRAME_COUNT && ctx->tx_pending < MK64F12_ENET_TX_RING_SIZE) {
+      transmit(ctx, size);
+      ++sent;
+    }
+
+    while (receive(ctx, size)) {
+      ++received;
+    }
+
+    if (received < FRAME_COUNT) {
+      wait(EVENT_RX | EVENT_TX);
+    }
+  }
+
+  b = rtems_counter_read();
+  mk64f12_enet_get_statistics(&s1);
+
+  while (ctx->tx_pending > 0) {
+    wait(EVENT_TX);
+  }
+
+  ns = rtems_counter_ticks_to_nanoseconds(rtems_counter_difference(b, a));
+
+  printf(
+    "  <Throughput>\n"
+    "    <FrameSize>%zu</FrameSize><Frames>%d</Frames>"
+    "<Time unit=\"ns\">%" PRIu64 "</Time>"
+    "<Rate unit=\"frames/s\">%" PRIu64 "</Rate>"
+    "<InterruptsPerFrame>%" PRIu32 ".%02" PRIu32 "</InterruptsPerFrame>"
+    "<RxErrors>%" PRIu32 "</RxErrors>\n"
+    "  </Throughput>\n",
+    size,
+    FRAME_COUNT,
+    ns,
+    ((uint64_t) FRAME_COUNT * 1000000000) / ns,
+    (s1.interrupts - s0.interrupts) / FRAME_COUNT,
+    ((s1.interrupts - s0.interrupts) % FRAME_COUNT) * 100 / FRAME_COUNT,
+    s1.rx_errors - s0.rx_errors
+  );
+}
+
+static void test_latency(test_context *ctx, size_t size)
+{
+  uint64_t min;
+  uint64_t max;
+  uint64_t sum;
+  size_t i;
+
+  build_frame(ctx, size);
+  min = UINT64_MAX;
+  max = 0;
+  sum = 0;
+
+  for (i = 0; i < LATENCY_SAMPLES; ++i) {
+    rtems_counter_ticks a;
+    rtems_counter_ticks b;
+    uint64_t ns;
+
+    a = rtems_counter_read();
+    transmit(ctx, size);
+
+    while (!receive(ctx, size)) {
+      wait(EVENT_RX);
+    }
+
+    b = rtems_counter_read();
+    ns = rtems_counter_ticks_to_nanoseconds(rtems_counter_difference(b, a));
+
+    if (ns < min) {
+      min = ns;
+    }
+
+    if (ns > max) {
+      max = ns;
+    }
+
+    sum += ns;
+
+    while (ctx->tx_pending > 0) {
+      wait(EVENT_TX);
+    }
+  }
+
+  printf(
+    "  <Latency>\n"
+    "    <FrameSize>%zu</FrameSize>"
+    "<Min unit=\"ns\">%" PRIu64 "</Min>"
+    "<Avg unit=\"ns\">%" PRIu64 "</Avg>"
+    "<Max unit=\"ns\">%" PRIu64 "</Max>\n"
+    "  </Latency>\n",
+    size,
+    min,
+    sum / LATENCY_SAMPLES,
+    max
+  );
+}
+
+static void test(void)
+{
+  static const size_t sizes[] = { 64, 512, MAX_FRAME_SIZE };
+  test_context *ctx = &test_instance;
+  mk64f12_enet_config config;
+  rtems_status_code sc;
+  size_t i;
+
+  ctx->master = rtems_task_self();
+
+  memset(&config, 0, sizeof(config));
+  memcpy(config.mac_address, mac_address, sizeof(mac_address));
+  config.checksum_offload = true;
+  config.loopback = true;
+  config.rx_notify = rx_notify;
+  config.rx_notify_arg = ctx;
+
+  sc = mk64f12_enet_initialize(&config);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = mk64f12_enet_initialize(&config);
+  rtems_test_assert(sc == RTEMS_INCORRECT_STATE);
+
+  sc = mk64f12_enet_transmit(ctx->frame, 0, 0, NULL, NULL);
+  rtems_test_assert(sc == RTEMS_INVALID_SIZE);
+
+  printf("<TMEnet01>\n");
+
+  for (i = 0; i < RTEMS_ARRAY_SIZE(sizes); ++i) {
+    test_latency(ctx, sizes[i]);
+  }
+
+  for (i = 0; i < RTEMS_ARRAY_SIZE(sizes); ++i) {
+    test_throughput(ctx, sizes[i]);
+  }
+
+  printf("</TMEnet01>\n");
+
+  rtems_test_assert(ctx->mismatches == 0);
+
+  mk64f12_enet_shutdown();
+
+  sc = mk64f12_enet_transmit(ctx->frame, 64, 0, NULL, NULL);
+  rtems_test_assert(sc == RTEMS_INCORRECT_STATE);
+}
+
+static void Init(rtems_task_argument arg)
+{
+  TEST_BEGIN();
+
+  test();
+
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_CONSOLE_DRIVER
+
+#define CONFIGURE_MAXIMUM_TASKS 1
+
+#define CONFIGURE_INIT_TASK_INITIAL_MODES RTEMS_DEFAULT_MODES
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
@@ -0,0 +1,358 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (c) 2026 Dave Rush.  All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "tmacros.h"
+
+#include <fcntl.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <rtems.h>
+#include <rtems/counter.h>
+#include <rtems/jffs2.h>
+#include <rtems/libio.h>
+
+#include <bsp/flash.h>
+
+const char rtems_test_name[] = "TMFLASH 1";
+
+#define SECTOR_COUNT 8
+
+#define AREA_SIZE (SECTOR_COUNT * MK64F12_FLASH_SECTOR_SIZE)
+
+/* The last sectors of the program flash, they are in the second block */
+#define AREA_BEGIN (MK64F12_FLASH_SIZE - AREA_SIZE)
+
+/* Size of the small writes, a phrase may be programmed only once */
+#define SMALL_SIZE (2 * MK64F12_FLASH_PHRASE_SIZE)
+
+#define MOUNT_POINT "/flash"
+
+typedef struct {
+  uint8_t data[AREA_SIZE];
+  mk64f12_flash_sim sim;
+  mk64f12_flash_jffs2_control jffs2;
+  uint8_t sim_memory[AREA_SIZE];
+} test_context;
+
+static test_context test_instance;
+
+static rtems_jffs2_compressor_control compressor_instance = {
+  .compress = rtems_jffs2_compressor_rtime_compress,
+  .decompress = rtems_jffs2_compressor_rtime_decompress
+};
+
+static void print_sample(
+  const char *name,
+  size_t bytes,
+  rtems_counter_ticks a,
+  rtems_counter_ticks b
+)
+{
+  uint64_t ns;
+
+  ns = rtems_counter_ticks_to_nanoseconds(rtems_counter_difference(b, a));
+  printf(
+    "  <%s><Bytes>%zu</Bytes><Time unit=\"ns\">%" PRIu64 "</Time>"
+    "<Throughput unit=\"B/s\">%" PRIu64 "</Throughput></%s>\n",
+    name,
+    bytes,
+    ns,
+    ((uint64_t) bytes * 1000000000) / ns,
+    name
+  );
+}
+
+static void test_internal(test_context *ctx)
+{
+  mk64f12_flash_device *device;
+  mk64f12_flash_statistics stats;
+  rtems_status_code sc;
+  rtems_counter_ticks a;
+  rtems_counter_ticks b;
+  size_t i;
+  uint8_t value;
+
+  device = &mk64f12_flash_internal;
+
+  sc = mk64f12_flash_initialize();
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  if (mk64f12_flash_image_end() > AREA_BEGIN) {
+    printf("  <Skipped>application image too large</Skipped>\n");
+    return;
+  }
+
+  printf(
+    "  <ReadWhileWrite>%s</ReadWhileWrite>\n",
+    mk64f12_flash_image_end() <= MK64F12_FLASH_BLOCK_SIZE ? "true" : "false"
+  );
+
+  sc = mk64f12_flash_erase(device, 0, MK64F12_FLASH_SECTOR_SIZE);
+  rtems_test_assert(sc == RTEMS_INVALID_ADDRESS);
+
+  a = rtems_counter_read();
+  sc = mk64f12_flash_erase(device, AREA_BEGIN, AREA_SIZE);
+  b = rtems_counter_read();
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  print_sample("Erase", AREA_SIZE, a, b);
+
+  for (i = 0; i < AREA_SIZE; ++i) {
+    rtems_test_assert(device->memory[AREA_BEGIN + i] == 0xff);
+  }
+
+  a = rtems_counter_read();
+  sc = mk64f12_flash_write(device, AREA_BEGIN, ctx->data, AREA_SIZE / 2);
+  b = rtems_counter_read();
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  print_sample("WriteAligned", AREA_SIZE / 2, a, b);
+
+  a = rtems_counter_read();
+
+  for (i = AREA_SIZE / 2; i + SMALL_SIZE <= AREA_SIZE; i += SMALL_SIZE) {
+    sc = mk64f12_flash_write(
+      device,
+      AREA_BEGIN + i,
+      &ctx->data[i],
+      SMALL_SIZE
+    );
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  }
+
+  b = rtems_counter_read();
+  print_sample("WriteSmall", i - AREA_SIZE / 2, a, b);
+
+  rtems_test_assert(memcmp(&device->memory[AREA_BEGIN], ctx->data, i) == 0);
+
+  /* A phrase must not be programmed a second time */
+  value = 0;
+  rtems_test_assert(ctx->data[1] != value);
+  sc = mk64f12_flash_write(device, AREA_BEGIN + 1, &value, 1);
+  rtems_test_assert(sc == RTEMS_IO_ERROR);
+  rtems_test_assert(device->memory[AREA_BEGIN + 1] == ctx->data[1]);
+
+  mk64f12_flash_get_statistics(device, &stats);
+  printf(
+    "  <Statistics><ErasedSectors>%" PRIu32 "</ErasedSectors>"
+    "<ProgrammedPhrases>%" PRIu32 "</ProgrammedPhrases>"
+    "<RefusedWrites>%" PRIu32 "</RefusedWrites></Statistics>\n",
+    stats.erased_sectors,
+    stats.programmed_phrases,
+    stats.refused_writes
+  );
+  rtems_test_assert(stats.errors == 0);
+
+  sc = mk64f12_flash_erase(device, AREA_BEGIN, AREA_SIZE);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+}
+
+static void test_sim(test_context *ctx)
+{
+  mk64f12_flash_device *device;
+  rtems_status_code sc;
+  uint8_t phrase[MK64F12_FLASH_PHRASE_SIZE];
+  uint8_t value;
+
+  mk64f12_flash_sim_initialize(&ctx->sim, ctx->sim_memory, AREA_SIZE);
+  device = &ctx->sim.device;
+
+  sc = mk64f12_flash_erase(device, 1, MK64F12_FLASH_SECTOR_SIZE);
+  rtems_test_assert(sc == RTEMS_INVALID_ADDRESS);
+
+  sc = mk64f12_flash_erase(device, AREA_SIZE, MK64F12_FLASH_SECTOR_SIZE);
+  rtems_test_assert(sc == RTEMS_INVALID_ADDRESS);
+
+  /* Writes have NOR semantics */
+  value = 0xf0;
+  sc = mk64f12_flash_write(device, 3, &value, 1);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  value = 0xf3;
+  sc = mk64f12_flash_write(device, 3, &value, 1);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  rtems_test_assert(device->stats.programmed_phrases == 1);
+
+  /* A phrase is programmed only once after the erase */
+  value = 0x3c;
+  sc = mk64f12_flash_write(device, 3, &value, 1);
+  rtems_test_assert(sc == RTEMS_IO_ERROR);
+  value = 0x00;
+  sc = mk64f12_flash_write(device, 4, &value, 1);
+  rtems_test_assert(sc == RTEMS_IO_ERROR);
+  sc = mk64f12_flash_read(device, 0, phrase, sizeof(phrase));
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  rtems_test_assert(phrase[2] == 0xff);
+  rtems_test_assert(phrase[3] == 0xf0);
+  rtems_test_assert(phrase[4] == 0xff);
+  rtems_test_assert(device->stats.programmed_phrases == 1);
+  rtems_test_assert(device->stats.refused_writes == 2);
+  rtems_test_assert(device->stats.errors == 0);
+
+  /* The next phrase is still erased */
+  value = 0x00;
+  sc = mk64f12_flash_write(device, 8, &value, 1);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  rtems_test_assert(device->stats.programmed_phrases == 2);
+
+  sc = mk64f12_flash_erase(device, 0, MK64F12_FLASH_SECTOR_SIZE);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  rtems_test_assert(ctx->sim_memory[3] == 0xff);
+}
+
+static void test_jffs2(test_context *ctx)
+{
+  rtems_jffs2_mount_data mount_data;
+  mk64f12_flash_statistics stats;
+  rtems_counter_ticks a;
+  rtems_counter_ticks b;
+  ssize_t n;
+  int fd;
+  int rv;
+
+  mk64f12_flash_sim_initialize(&ctx->sim, ctx->sim_memory, AREA_SIZE);
+  mk64f12_flash_jffs2_initialize(&ctx->jffs2, &ctx->sim.device, 0, AREA_SIZE);
+
+  memset(&mount_data, 0, sizeof(mount_data));
+  mount_data.flash_control = &ctx->jffs2.super;
+  mount_data.compressor_control = &compressor_instance;
+
+  rv = mount_and_make_target_path(
+    NULL,
+    MOUNT_POINT,
+    RTEMS_FILESYSTEM_TYPE_JFFS2,
+    RTEMS_FILESYSTEM_READ_WRITE,
+    &mount_data
+  );
+  rtems_test_assert(rv == 0);
+
+  fd = open(MOUNT_POINT "/file", O_WRONLY | O_CREAT | O_TRUNC, S_IRWXU);
+  rtems_test_assert(fd >= 0);
+
+  a = rtems_counter_read();
+  n = write(fd, ctx->data, AREA_SIZE / 4);
+  b = rtems_counter_read();
+  rtems_test_assert(n == AREA_SIZE / 4);
+  print_sample("JFFS2SimWrite", AREA_SIZE / 4, a, b);
+
+  rv = close(fd);
+  rtems_test_assert(rv == 0);
+
+  rv = unmount(MOUNT_POINT);
+  rtems_test_assert(rv == 0);
+
+  rv = mount(
+    NULL,
+    MOUNT_POINT,
+    RTEMS_FILESYSTEM_TYPE_JFFS2,
+    RTEMS_FILESYSTEM_READ_WRITE,
+    &mount_data
+  );
+  rtems_test_assert(rv == 0);
+
+  fd = open(MOUNT_POINT "/file", O_RDONLY);
+  rtems_test_assert(fd >= 0);
+
+  memset(&ctx->data[AREA_SIZE / 2], 0, AREA_SIZE / 4);
+  n = read(fd, &ctx->data[AREA_SIZE / 2], AREA_SIZE / 4);
+  rtems_test_assert(n == AREA_SIZE / 4);
+  rtems_test_assert(
+    memcmp(&ctx->data[AREA_SIZE / 2], ctx->data, AREA_SIZE / 4) == 0
+  );
+
+  rv = close(fd);
+  rtems_test_assert(rv == 0);
+
+  /* The deletion after the remount writes next to the last node */
+  rv = unlink(MOUNT_POINT "/file");
+  rtems_test_assert(rv == 0);
+
+  rv = unmount(MOUNT_POINT);
+  rtems_test_assert(rv == 0);
+
+  mk64f12_flash_get_statistics(&ctx->sim.device, &stats);
+  printf(
+    "  <JFFS2SimStatistics><ErasedSectors>%" PRIu32 "</ErasedSectors>"
+    "<ProgrammedPhrases>%" PRIu32 "</ProgrammedPhrases>"
+    "<RefusedWrites>%" PRIu32 "</RefusedWrites>"
+    "</JFFS2SimStatistics>\n",
+    stats.erased_sectors,
+    stats.programmed_phrases,
+    stats.refused_writes
+  );
+  rtems_test_assert(stats.refused_writes == 0);
+  rtems_test_assert(stats.errors == 0);
+}
+
+static void Init(rtems_task_argument arg)
+{
+  test_context *ctx;
+  size_t i;
+
+  TEST_BEGIN();
+
+  ctx = &test_instance;
+
+  for (i = 0; i < AREA_SIZE; ++i) {
+    ctx->data[i] = (uint8_t) (i * 13 + (i >> 9));
+  }
+
+  printf("<TMFlash01>\n");
+  test_internal(ctx);
+  test_sim(ctx);
+  test_jffs2(ctx);
+  printf("</TMFlash01>\n");
+
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_CONSOLE_DRIVER
+
+#define CONFIGURE_FILESYSTEM_JFFS2
+
+#define CONFIGURE_MAXIMUM_FILE_DESCRIPTORS 5
+
+#define CONFIGURE_MAXIMUM_TASKS 1
+
+#define CONFIGURE_INIT_TASK_STACK_SIZE (8 * 1024)
+
+#define CONFIGURE_INIT_TASK_INITIAL_MODES RTEMS_DEFAULT_MODES
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
@@ -0,0 +1,336 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (c) 2026 Dave Rush.  All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "tmacros.h"
+
+#include <crypt.h>
+#include <inttypes.h>
+#include <md5.h>
+#include <sha256.h>
+#include <stdio.h>
+#include <string.h>
+
+#include <rtems.h>
+#include <rtems/counter.h>
+#include <rtems/mdtransform.h>
+
+#include <bsp/mmcau.h>
+
+const char rtems_test_name[] = "TMHASH 1";
+
+#define BLOCK_COUNT 256
+
+#define DATA_SIZE (BLOCK_COUNT * 64)
+
+#define SAMPLE_COUNT 4
+
+typedef struct {
+  const char *name;
+  rtems_md_transform md5;
+  rtems_md_transform sha256;
+} transform_variant;
+
+typedef struct {
+  bool mmcau;
+  unsigned char data[DATA_SIZE + 1];
+  unsigned char md5_digest[MD5_DIGEST_LENGTH];
+  unsigned char sha256_digest[32];
+  struct crypt_data crypt_data;
+  char md5_crypt[sizeof(((struct crypt_data *) 0)->buffer)];
+  char sha256_crypt[sizeof(((struct crypt_data *) 0)->buffer)];
+} test_context;
+
+static test_context test_instance;
+
+static const transform_variant variants[] = {
+  {
+    "Generic",
+    rtems_md5_transform_generic,
+    rtems_sha256_transform_generic
+  }, {
+    "ARMv7E-M",
+    mk64f12_armv7em_md5_transform,
+    mk64f12_armv7em_sha256_transform
+  }, {
+    "MMCAU",
+    mk64f12_mmcau_md5_transform,
+    mk64f12_mmcau_sha256_transform
+  }
+};
+
+static void print_throughput(
+  const char *name,
+  size_t bytes,
+  rtems_counter_ticks ticks
+)
+{
+  uint64_t ns;
+  uint64_t kbs;
+
+  ns = rtems_counter_ticks_to_nanoseconds(ticks);
+  kbs = ((uint64_t) bytes * 1000000) / ns;
+  printf(
+    "    <%s><Bytes>%zu</Bytes><Time unit=\"ns\">%" PRIu64 "</Time>"
+    "<Throughput unit=\"MB/s\">%" PRIu64 ".%03" PRIu64 "</Throughput>"
+    "</%s>\n",
+    name,
+    bytes,
+    ns,
+    kbs / 1000,
+    kbs % 1000,
+    name
+  );
+}
+
+static void print_time(const char *name, rtems_counter_ticks ticks)
+{
+  printf(
+    "    <%s><Time unit=\"ns\">%" PRIu64 "</Time></%s>\n",
+    name,
+    rtems_counter_ticks_to_nanoseconds(ticks),
+    name
+  );
+}
+
+static rtems_counter_ticks measure_transform(
+  rtems_md_transform transform,
+  const unsigned char *data
+)
+{
+  rtems_counter_ticks best;
+  int i;
+
+  best = 0;
+
+  for (i = 0; i < SAMPLE_COUNT; ++i) {
+    uint32_t state[8];
+    rtems_counter_ticks a;
+    rtems_counter_ticks b;
+    rtems_counter_ticks d;
+
+    memset(state, 0, sizeof(state));
+    a = rtems_counter_read();
+    (*transform)(state, data, BLOCK_COUNT);
+    b = rtems_counter_read();
+    d = rtems_counter_difference(b, a);
+
+    if (i == 0 || d < best) {
+      best = d;
+    }
+  }
+
+  return best;
+}
+
+static void test_variant(test_context *ctx, const transform_variant *variant)
+{
+  MD5_CTX md5;
+  SHA256_CTX sha256;
+  unsigned char digest[32];
+  rtems_counter_ticks a;
+  rtems_counter_ticks b;
+  char *s;
+
+  printf("  <%s>\n", variant->name);
+
+  /* The MMCAU transforms are not installed if the known answer test failed */
+  if (variant->md5 == mk64f12_mmcau_md5_transform && !ctx->mmcau) {
+    printf("    <Skipped>known answer test failed</Skipped>\n");
+    printf("  </%s>\n", variant->name);
+    return;
+  }
+
+  print_throughput(
+    "MD5",
+    DATA_SIZE,
+    measure_transform(variant->md5, ctx->data)
+  );
+  print_throughput(
+    "MD5Unaligned",
+    DATA_SIZE,
+    measure_transform(variant->md5, &ctx->data[1])
+  );
+  print_throughput(
+    "SHA256",
+    DATA_SIZE,
+    measure_transform(variant->sha256, ctx->data)
+  );
+  print_throughput(
+    "SHA256Unaligned",
+    DATA_SIZE,
+    measure_transform(variant->sha256, &ctx->data[1])
+  );
+
+  /* The update functions and libcrypt pick up the installed transforms */
+  rtems_md5_set_transform(variant->md5);
+  rtems_sha256_set_transform(variant->sha256);
+
+  MD5Init(&md5);
+  MD5Update(&md5, &ctx->data[1], 3);
+  MD5Update(&md5, &ctx->data[4], DATA_SIZE - 3);
+  MD5Final(digest, &md5);
+  rtems_test_assert(memcmp(digest, ctx->md5_digest, MD5_DIGEST_LENGTH) == 0);
+
+  SHA256_Init(&sha256);
+  SHA256_Update(&sha256, &ctx->data[1], 3);
+  SHA256_Update(&sha256, &ctx->data[4], DATA_SIZE - 3);
+  SHA256_Final(digest, &sha256);
+  rtems_test_assert(memcmp(digest, ctx->sha256_digest, 32) == 0);
+
+  a = rtems_counter_read();
+  s = crypt_r("password", "$1$saltsalt$", &ctx->crypt_data);
+  b = rtems_counter_read();
+  rtems_test_assert(s != NULL && strcmp(s, ctx->md5_crypt) == 0);
+  print_time("MD5Crypt", rtems_counter_difference(b, a));
+
+  a = rtems_counter_read();
+  s = crypt_r("password", "$5$saltsalt$", &ctx->crypt_data);
+  b = rtems_counter_read();
+  rtems_test_assert(s != NULL && strcmp(s, ctx->sha256_crypt) == 0);
+  print_time("SHA256Crypt", rtems_counter_difference(b, a));
+
+  printf("  </%s>\n", variant->name);
+}
+
+static void compute_reference(test_context *ctx)
+{
+  rtems_md_transform md5_transform;
+  rtems_md_transform sha256_transform;
+  MD5_CTX md5;
+  SHA256_CTX sha256;
+  char *s;
+
+  md5_transform = _MD5_Transform_hook;
+  sha256_transform = _SHA256_Transform_hook;
+  rtems_md5_set_transform(NULL);
+  rtems_sha256_set_transform(NULL);
+
+  MD5Init(&md5);
+  MD5Update(&md5, &ctx->data[1], DATA_SIZE);
+  MD5Final(ctx->md5_digest, &md5);
+
+  SHA256_Init(&sha256);
+  SHA256_Update(&sha256, &ctx->data[1], DATA_SIZE);
+  SHA256_Final(ctx->sha256_digest, &sha256);
+
+  s = crypt_r("password", "$1$saltsalt$", &ctx->crypt_data);
+  rtems_test_assert(s != NULL);
+  strlcpy(ctx->md5_crypt, s, sizeof(ctx->md5_crypt));
+
+  s = crypt_r("password", "$5$saltsalt$", &ctx->crypt_data);
+  rtems_test_assert(s != NULL);
+  strlcpy(ctx->sha256_crypt, s, sizeof(ctx->sha256_crypt));
+
+  rtems_md5_set_transform(md5_transform);
+  rtems_sha256_set_transform(sha256_transform);
+}
+
+static void test_known_answers(void)
+{
+  static const unsigned char md5_abc[MD5_DIGEST_LENGTH] = {
+    0x90, 0x01, 0x50, 0x98, 0x3c, 0xd2, 0x4f, 0xb0,
+    0xd6, 0x96, 0x3f, 0x7d, 0x28, 0xe1, 0x7f, 0x72
+  };
+  static const unsigned char sha256_abc[32] = {
+    0xba, 0x78, 0x16, 0xbf, 0x8f, 0x01, 0xcf, 0xea,
+    0x41, 0x41, 0x40, 0xde, 0x5d, 0xae, 0x22, 0x23,
+    0xb0, 0x03, 0x61, 0xa3, 0x96, 0x17, 0x7a, 0x9c,
+    0xb4, 0x10, 0xff, 0x61, 0xf2, 0x00, 0x15, 0xad
+  };
+  MD5_CTX md5;
+  SHA256_CTX sha256;
+  unsigned char digest[32];
+
+  MD5Init(&md5);
+  MD5Update(&md5, "abc", 3);
+  MD5Final(digest, &md5);
+  rtems_test_assert(memcmp(digest, md5_abc, sizeof(md5_abc)) == 0);
+
+  SHA256_Init(&sha256);
+  SHA256_Update(&sha256, "abc", 3);
+  SHA256_Final(digest, &sha256);
+  rtems_test_assert(memcmp(digest, sha256_abc, sizeof(sha256_abc)) == 0);
+}
+
+static void Init(rtems_task_argument arg)
+{
+  test_context *ctx;
+  size_t i;
+
+  TEST_BEGIN();
+
+  ctx = &test_instance;
+
+  for (i = 0; i < sizeof(ctx->data); ++i) {
+    ctx->data[i] = (unsigned char) (i * 13 + (i >> 8));
+  }
+
+  crypt_add_format(&crypt_md5_format);
+  crypt_add_format(&crypt_sha256_format);
+
+  /* The transforms installed by the BSP start */
+  ctx->mmcau = _MD5_Transform_hook == mk64f12_mmcau_md5_transform
+    && _SHA256_Transform_hook == mk64f12_mmcau_sha256_transform;
+  printf(
+    "<TMHash01>\n  <InstalledTransforms>%s</InstalledTransforms>\n",
+    ctx->mmcau ? "MMCAU" : "ARMv7E-M"
+  );
+  test_known_answers();
+
+  compute_reference(ctx);
+
+  for (i = 0; i < RTEMS_ARRAY_SIZE(variants); ++i) {
+    test_variant(ctx, &variants[i]);
+  }
+
+  printf("</TMHash01>\n");
+
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_CONSOLE_DRIVER
+
+#define CONFIGURE_MAXIMUM_TASKS 1
+
+#define CONFIGURE_INIT_TASK_STACK_SIZE (4 * 1024)
+
+#define CONFIGURE_INIT_TASK_INITIAL_MODES RTEMS_DEFAULT_MODES
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
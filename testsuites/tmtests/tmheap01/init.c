@@ -0,0 +1,338 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (c) 2026 Dave Rush.  All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "tmacros.h"
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+
+#include <rtems.h>
+#include <rtems/counter.h>
+#include <rtems/score/heapimpl.h>
+
+const char rtems_test_name[] = "TMHEAP 1";
+
+#define HEAP_SIZE (32 * 1024)
+
+#define SLOT_COUNT 128
+
+#define OPERATION_COUNT 20000
+
+typedef uintptr_t (*heap_initializer)(
+  Heap_Control *heap,
+  void *area_begin,
+  uintptr_t area_size,
+  uintptr_t page_size
+);
+
+typedef struct {
+  const char *name;
+  heap_initializer initialize;
+} heap_variant;
+
+typedef struct {
+  uint32_t allocs;
+  uint32_t failed_allocs;
+  uint32_t frees;
+  rtems_counter_ticks alloc_sum;
+  rtems_counter_ticks alloc_max;
+  rtems_counter_ticks free_sum;
+  rtems_counter_ticks free_max;
+  uint32_t searches;
+  uintptr_t free_total;
+  uintptr_t free_largest;
+  uint32_t free_blocks;
+} heap_results;
+
+typedef struct {
+  Heap_Control heap;
+  uint32_t random;
+  void *slots[SLOT_COUNT];
+  heap_results results;
+  uint8_t area[HEAP_SIZE] RTEMS_ALIGNED(CPU_ALIGNMENT);
+} test_context;
+
+static test_context test_instance;
+
+static const heap_variant variants[] = {
+  { "FirstFit", _Heap_Initialize },
+  { "TLSF", _Heap_Initialize_TLSF }
+};
+
+static uint32_t next_random(test_context *ctx)
+{
+  ctx->random = ctx->random * 1664525 + 1013904223;
+
+  return ctx->random >> 8;
+}
+
+/*
+ * Most requests are small, some are medium sized and a few are big, so that
+ * the free blocks get fragmented over time.
+ */
+static uintptr_t next_size(test_context *ctx)
+{
+  uint32_t r;
+
+  r = next_random(ctx);
+
+  switch (r % 16) {
+    case 0:
+      return 1024 + (r >> 4) % 2048;
+    case 1:
+    case 2:
+    case 3:
+      return 128 + (r >> 4) % 512;
+    default:
+      return 8 + (r >> 4) % 120;
+  }
+}
+
+static void do_alloc(test_context *ctx, size_t i)
+{
+  heap_results *results;
+  uintptr_t size;
+  rtems_interrupt_level level;
+  rtems_counter_ticks a;
+  rtems_counter_ticks b;
+  rtems_counter_ticks d;
+  void *p;
+
+  results = &ctx->results;
+  size = next_size(ctx);
+
+  rtems_interrupt_local_disable(level);
+  a = rtems_counter_read();
+  p = _Heap_Allocate(&ctx->heap, size);
+  b = rtems_counter_read();
+  rtems_interrupt_local_enable(level);
+
+  d = rtems_counter_difference(b, a);
+  results->alloc_sum += d;
+
+  if (d > results->alloc_max) {
+    results->alloc_max = d;
+  }
+
+  ++results->allocs;
+
+  if (p == NULL) {
+    ++results->failed_allocs;
+  }
+
+  ctx->slots[i] = p;
+}
+
+static void do_free(test_context *ctx, size_t i)
+{
+  heap_results *results;
+  rtems_interrupt_level level;
+  rtems_counter_ticks a;
+  rtems_counter_ticks b;
+  rtems_counter_ticks d;
+  bool ok;
+
+  results = &ctx->results;
+
+  rtems_interrupt_local_disable(level);
+  a = rtems_counter_read();
+  ok = _Heap_Free(&ctx->heap, ctx->slots[i]);
+  b = rtems_counter_read();
+  rtems_interrupt_local_enable(level);
+
+  rtems_test_assert(ok);
+
+  d = rtems_counter_difference(b, a);
+  results->free_sum += d;
+
+  if (d > results->free_max) {
+    results->free_max = d;
+  }
+
+  ++results->frees;
+  ctx->slots[i] = NULL;
+}
+
+static void run_workload(test_context *ctx, const heap_variant *variant)
+{
+  Heap_Information info;
+  uintptr_t space;
+  size_t i;
+  int op;
+
+  memset(ctx->slots, 0, sizeof(ctx->slots));
+  memset(&ctx->results, 0, sizeof(ctx->results));
+  ctx->random = 1;
+
+  space = (*variant->initialize)(&ctx->heap, ctx->area, sizeof(ctx->area), 0);
+  rtems_test_assert(space > 0);
+
+  for (op = 0; op < OPERATION_COUNT; ++op) {
+    i = next_random(ctx) % SLOT_COUNT;
+
+    if (ctx->slots[i] == NULL) {
+      do_alloc(ctx, i);
+    } else {
+      do_free(ctx, i);
+    }
+  }
+
+  rtems_test_assert(_Heap_Walk(&ctx->heap, 0, false));
+
+  _Heap_Get_free_information(&ctx->heap, &info);
+  ctx->results.free_total = info.total;
+  ctx->results.free_largest = info.largest;
+  ctx->results.free_blocks = info.number;
+  ctx->results.searches = ctx->heap.stats.searches;
+
+  for (i = 0; i < SLOT_COUNT; ++i) {
+    if (ctx->slots[i] != NULL) {
+      do_free(ctx, i);
+    }
+  }
+
+  rtems_test_assert(ctx->heap.stats.free_blocks == 1);
+}
+
+static void print_time(
+  const char *name,
+  rtems_counter_ticks sum,
+  uint32_t count,
+  rtems_counter_ticks max
+)
+{
+  printf(
+    "    <%s><Avg unit=\"ns\">%" PRIu64 "</Avg>"
+    "<Max unit=\"ns\">%" PRIu64 "</Max></%s>\n",
+    name,
+    count > 0 ? rtems_counter_ticks_to_nanoseconds(sum) / count : 0,
+    rtems_counter_ticks_to_nanoseconds(max),
+    name
+  );
+}
+
+static void print_results(test_context *ctx, const heap_variant *variant)
+{
+  const heap_results *results;
+  uint32_t fragmentation;
+
+  results = &ctx->results;
+
+  if (results->free_total > 0) {
+    fragmentation = (uint32_t) (1000
+      - ((uint64_t) results->free_largest * 1000) / results->free_total);
+  } else {
+    fragmentation = 0;
+  }
+
+  printf(
+    "  <%s>\n"
+    "    <Allocs>%" PRIu32 "</Allocs>\n"
+    "    <FailedAllocs>%" PRIu32 "</FailedAllocs>\n"
+    "    <Frees>%" PRIu32 "</Frees>\n"
+    "    <SearchesPerAlloc>%" PRIu32 ".%02" PRIu32 "</SearchesPerAlloc>\n"
+    "    <FreeBlocks>%" PRIu32 "</FreeBlocks>\n"
+    "    <FreeTotal>%" PRIuPTR "</FreeTotal>\n"
+    "    <FreeLargest>%" PRIuPTR "</FreeLargest>\n"
+    "    <Fragmentation unit=\"permille\">%" PRIu32 "</Fragmentation>\n",
+    variant->name,
+    results->allocs,
+    results->failed_allocs,
+    results->frees,
+    results->searches / results->allocs,
+    (results->searches % results->allocs) * 100 / results->allocs,
+    results->free_blocks,
+    results->free_total,
+    results->free_largest,
+    fragmentation
+  );
+  print_time(
+    "Alloc",
+    results->alloc_sum,
+    results->allocs,
+    results->alloc_max
+  );
+  print_time(
+    "Free",
+    results->free_sum,
+    results->frees,
+    results->free_max
+  );
+  printf("  </%s>\n", variant->name);
+}
+
+static void Init(rtems_task_argument arg)
+{
+  test_context *ctx;
+  size_t i;
+
+  ctx = &test_instance;
+
+  TEST_BEGIN();
+
+  printf(
+    "<TMHeap01>\n"
+    "  <HeapSize>%zu</HeapSize>\n"
+    "  <Slots>%d</Slots>\n"
+    "  <Operations>%d</Operations>\n",
+    sizeof(ctx->area),
+    SLOT_COUNT,
+    OPERATION_COUNT
+  );
+
+  for (i = 0; i < RTEMS_ARRAY_SIZE(variants); ++i) {
+    run_workload(ctx, &variants[i]);
+    print_results(ctx, &variants[i]);
+  }
+
+  printf("</TMHeap01>\n");
+
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_CONSOLE_DRIVER
+
+#define CONFIGURE_MAXIMUM_TASKS 1
+
+#define CONFIGURE_INIT_TASK_STACK_SIZE (4 * 1024)
+
+#define CONFIGURE_INIT_TASK_INITIAL_MODES RTEMS_DEFAULT_MODES
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
@@ -0,0 +1,229 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (c) 2026 Dave Rush.  All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "tmacros.h"
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include <rtems.h>
+#include <rtems/score/watchdogimpl.h>
+
+const char rtems_test_name[] = "TMHRTIMER 1";
+
+#define SAMPLE_COUNT 32
+
+typedef struct {
+  int64_t sum;
+  int64_t min;
+  int64_t max;
+} error_results;
+
+static const uint32_t intervals_us[] = { 50, 100, 250, 1000, 2500, 25000 };
+
+static uint64_t timespec_to_ns(const struct timespec *ts)
+{
+  return (uint64_t) ts->tv_sec * 1000000000 + (uint64_t) ts->tv_nsec;
+}
+
+static void ns_to_timespec(uint64_t ns, struct timespec *ts)
+{
+  ts->tv_sec = (time_t) (ns / 1000000000);
+  ts->tv_nsec = (long) (ns % 1000000000);
+}
+
+static uint64_t now_ns(clockid_t clock_id)
+{
+  struct timespec now;
+  int rv;
+
+  rv = clock_gettime(clock_id, &now);
+  rtems_test_assert(rv == 0);
+
+  return timespec_to_ns(&now);
+}
+
+static void account(error_results *results, int64_t late)
+{
+  /*
+   * Without a one-shot comparator, the relative timeout starts at the time of
+   * the last clock tick, so the sleep may end early.
+   */
+  if (_Watchdog_Comparator != NULL) {
+    rtems_test_assert(late >= 0);
+  }
+
+  results->sum += late;
+
+  if (late < results->min) {
+    results->min = late;
+  }
+
+  if (late > results->max) {
+    results->max = late;
+  }
+}
+
+static void init_results(error_results *results)
+{
+  memset(results, 0, sizeof(*results));
+  results->min = INT64_MAX;
+}
+
+/*
+ * The error is the time after the requested end of the sleep.
+ */
+static void sleep_relative(
+  clockid_t clock_id,
+  uint32_t interval_us,
+  error_results *results
+)
+{
+  int i;
+
+  for (i = 0; i < SAMPLE_COUNT; ++i) {
+    struct timespec interval;
+    uint64_t begin;
+    uint64_t end;
+    int eno;
+
+    ns_to_timespec((uint64_t) interval_us * 1000, &interval);
+    begin = now_ns(clock_id);
+    eno = clock_nanosleep(clock_id, 0, &interval, NULL);
+    end = now_ns(clock_id);
+
+    rtems_test_assert(eno == 0);
+    account(results, (int64_t) (end - begin) - (int64_t) interval_us * 1000);
+  }
+}
+
+/*
+ * A periodic absolute sleep shows the wake up jitter independent of the time
+ * to set up the sleep.
+ */
+static void sleep_absolute(
+  clockid_t clock_id,
+  uint32_t interval_us,
+  error_results *results
+)
+{
+  uint64_t deadline;
+  int i;
+
+  deadline = now_ns(clock_id);
+
+  for (i = 0; i < SAMPLE_COUNT; ++i) {
+    struct timespec abstime;
+    uint64_t end;
+    int eno;
+
+    deadline += (uint64_t) interval_us * 1000;
+    ns_to_timespec(deadline, &abstime);
+    eno = clock_nanosleep(clock_id, TIMER_ABSTIME, &abstime, NULL);
+    end = now_ns(clock_id);
+
+    rtems_test_assert(eno == 0);
+    rtems_test_assert(end >= deadline);
+    account(results, (int64_t) (end - deadline));
+    deadline = end;
+  }
+}
+
+static void print_results(const char *name, const error_results *results)
+{
+  printf(
+    "      <%s><Avg unit=\"ns\">%" PRId64 "</Avg>"
+    "<Min unit=\"ns\">%" PRId64 "</Min>"
+    "<Max unit=\"ns\">%" PRId64 "</Max></%s>\n",
+    name,
+    results->sum / SAMPLE_COUNT,
+    results->min,
+    results->max,
+    name
+  );
+}
+
+static void measure(const char *name, clockid_t clock_id, uint32_t interval_us)
+{
+  error_results relative;
+  error_results absolute;
+
+  init_results(&relative);
+  init_results(&absolute);
+  sleep_relative(clock_id, interval_us, &relative);
+  sleep_absolute(clock_id, interval_us, &absolute);
+
+  printf("    <%s>\n", name);
+  print_results("Relative", &relative);
+  print_results("Absolute", &absolute);
+  printf("    </%s>\n", name);
+}
+
+static void Init(rtems_task_argument arg)
+{
+  size_t i;
+
+  TEST_BEGIN();
+
+  printf(
+    "<TMHRTimer01 highResolution=\"%s\" tick=\"%" PRIu32 "us\">\n",
+    _Watchdog_Comparator != NULL ? "yes" : "no",
+    rtems_configuration_get_microseconds_per_tick()
+  );
+
+  for (i = 0; i < RTEMS_ARRAY_SIZE(intervals_us); ++i) {
+    printf("  <Interval unit=\"us\" value=\"%" PRIu32 "\">\n", intervals_us[i]);
+    measure("Monotonic", CLOCK_MONOTONIC, intervals_us[i]);
+    measure("Realtime", CLOCK_REALTIME, intervals_us[i]);
+    printf("  </Interval>\n");
+  }
+
+  printf("</TMHRTimer01>\n");
+
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_CONSOLE_DRIVER
+
+#define CONFIGURE_MAXIMUM_TASKS 1
+
+#define CONFIGURE_INIT_TASK_INITIAL_MODES RTEMS_DEFAULT_MODES
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
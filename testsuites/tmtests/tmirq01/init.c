@@ -0,0 +1,279 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (c) 2026 Dave Rush.  All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "tmacros.h"
+
+#include <inttypes.h>
+#include <stdio.h>
+
+#include <rtems.h>
+#include <rtems/score/armv7m.h>
+
+#include <bsp.h>
+#include <bsp/armv7m-irq.h>
+#include <bsp/irq.h>
+#include <bsp/mk64f12.h>
+
+const char rtems_test_name[] = "TMIRQ 1";
+
+#define SAMPLE_COUNT 1000
+
+/* Software interrupt, used by the direct and the generic handler */
+#define IRQ_MAIN SWI_IRQn
+
+/* Unused comparator interrupt, receives the work deferred by a handler */
+#define IRQ_DEFER CMP2_IRQn
+
+/* Not masked by rtems_interrupt_disable() */
+#define PRIORITY_ZERO_LATENCY (4 << 4)
+
+typedef struct {
+  volatile uint32_t entry;
+  volatile uint32_t exit;
+  volatile bool done;
+  volatile bool in_progress;
+  uint32_t min;
+  uint32_t max;
+  uint64_t sum;
+} test_context;
+
+static test_context test_instance;
+
+static uint32_t cycles(void)
+{
+  return _ARMV7M_DWT->cyccnt;
+}
+
+static void direct_handler(void)
+{
+  test_context *ctx = &test_instance;
+
+  ctx->entry = cycles();
+  ctx->in_progress = rtems_interrupt_is_in_progress();
+  ctx->done = true;
+}
+
+static void direct_defer_handler(void)
+{
+  armv7m_interrupt_direct_defer(IRQ_DEFER);
+}
+
+static void generic_handler(void *arg)
+{
+  test_context *ctx = arg;
+
+  ctx->entry = cycles();
+  ctx->in_progress = rtems_interrupt_is_in_progress();
+  ctx->done = true;
+}
+
+static void measure(test_context *ctx, const char *name)
+{
+  int i;
+
+  ctx->min = UINT32_MAX;
+  ctx->max = 0;
+  ctx->sum = 0;
+
+  for (i = 0; i < SAMPLE_COUNT; ++i) {
+    uint32_t start;
+    uint32_t d;
+
+    ctx->done = false;
+    start = cycles();
+    _ARMV7M_NVIC_Set_pending(IRQ_MAIN);
+
+    while (!ctx->done) {
+      /* Wait */
+    }
+
+    d = ctx->entry - start;
+    ctx->sum += d;
+
+    if (d < ctx->min) {
+      ctx->min = d;
+    }
+
+    if (d > ctx->max) {
+      ctx->max = d;
+    }
+  }
+
+  printf(
+    "  <%s><Min unit=\"cycles\">%" PRIu32 "</Min>"
+    "<Max unit=\"cycles\">%" PRIu32 "</Max>"
+    "<Mean unit=\"cycles\">%" PRIu64 "</Mean></%s>\n",
+    name,
+    ctx->min,
+    ctx->max,
+    ctx->sum / SAMPLE_COUNT,
+    name
+  );
+}
+
+static void test_generic(test_context *ctx)
+{
+  rtems_status_code sc;
+
+  sc = rtems_interrupt_handler_install(
+    IRQ_MAIN,
+    "Generic",
+    RTEMS_INTERRUPT_UNIQUE,
+    generic_handler,
+    ctx
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_interrupt_vector_enable(IRQ_MAIN);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  /* A direct handler cannot share the vector */
+  sc = armv7m_interrupt_direct_install(
+    IRQ_MAIN,
+    BSP_ARMV7M_IRQ_PRIORITY_DEFAULT,
+    direct_handler
+  );
+  rtems_test_assert(sc == RTEMS_RESOURCE_IN_USE);
+
+  measure(ctx, "Generic");
+  rtems_test_assert(ctx->in_progress);
+
+  sc = rtems_interrupt_handler_remove(IRQ_MAIN, generic_handler, ctx);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+}
+
+static void test_direct(test_context *ctx, const char *name, uint8_t priority)
+{
+  rtems_status_code sc;
+
+  sc = armv7m_interrupt_direct_install(IRQ_MAIN, priority, direct_handler);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = armv7m_interrupt_direct_install(IRQ_MAIN, priority, direct_handler);
+  rtems_test_assert(sc == RTEMS_RESOURCE_IN_USE);
+
+  measure(ctx, name);
+
+  /* A direct handler is invisible to RTEMS */
+  rtems_test_assert(!ctx->in_progress);
+
+  sc = armv7m_interrupt_direct_remove(IRQ_MAIN);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+}
+
+static void test_defer(test_context *ctx)
+{
+  rtems_status_code sc;
+
+  sc = rtems_interrupt_handler_install(
+    IRQ_DEFER,
+    "Defer",
+    RTEMS_INTERRUPT_UNIQUE,
+    generic_handler,
+    ctx
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_interrupt_vector_enable(IRQ_DEFER);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = armv7m_interrupt_direct_install(
+    IRQ_MAIN,
+    PRIORITY_ZERO_LATENCY,
+    direct_defer_handler
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  measure(ctx, "DirectDeferToGeneric");
+  rtems_test_assert(ctx->in_progress);
+
+  sc = armv7m_interrupt_direct_remove(IRQ_MAIN);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_interrupt_handler_remove(IRQ_DEFER, generic_handler, ctx);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+}
+
+static void test_errors(void)
+{
+  rtems_status_code sc;
+
+  sc = armv7m_interrupt_direct_install(IRQ_MAIN, 0, NULL);
+  rtems_test_assert(sc == RTEMS_INVALID_ADDRESS);
+
+  sc = armv7m_interrupt_direct_install(
+    BSP_INTERRUPT_VECTOR_COUNT,
+    0,
+    direct_handler
+  );
+  rtems_test_assert(sc == RTEMS_INVALID_ID);
+
+  sc = armv7m_interrupt_direct_remove(IRQ_MAIN);
+  rtems_test_assert(sc == RTEMS_UNSATISFIED);
+
+  sc = armv7m_interrupt_direct_remove(BSP_INTERRUPT_VECTOR_COUNT);
+  rtems_test_assert(sc == RTEMS_INVALID_ID);
+}
+
+static void Init(rtems_task_argument arg)
+{
+  test_context *ctx;
+
+  TEST_BEGIN();
+
+  ctx = &test_instance;
+
+  printf("<TMIRQ01>\n");
+  test_errors();
+  test_generic(ctx);
+  test_direct(ctx, "Direct", BSP_ARMV7M_IRQ_PRIORITY_DEFAULT);
+  test_direct(ctx, "DirectZeroLatency", PRIORITY_ZERO_LATENCY);
+  test_defer(ctx);
+  printf("</TMIRQ01>\n");
+
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_CONSOLE_DRIVER
+
+#define CONFIGURE_MAXIMUM_TASKS 1
+
+#define CONFIGURE_INIT_TASK_INITIAL_MODES RTEMS_DEFAULT_MODES
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
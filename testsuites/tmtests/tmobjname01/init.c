@@ -0,0 +1,277 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (c) 2026 Dave Rush.  All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "tmacros.h"
+
+#include <fcntl.h>
+#include <inttypes.h>
+#include <semaphore.h>
+#include <stdio.h>
+#include <string.h>
+
+#include <rtems.h>
+#include <rtems/counter.h>
+#include <rtems/posix/semaphore.h>
+#include <rtems/rtems/semdata.h>
+#include <rtems/score/objectimpl.h>
+#include <rtems/score/wkspace.h>
+
+const char rtems_test_name[] = "TMOBJNAME 1";
+
+#define OBJECT_MAXIMUM 512
+
+typedef struct {
+  rtems_counter_ticks sum;
+  rtems_counter_ticks max;
+} lookup_results;
+
+typedef struct {
+  size_t count;
+  rtems_id classic_ids[OBJECT_MAXIMUM];
+  sem_t *posix_sems[OBJECT_MAXIMUM];
+} test_context;
+
+static test_context test_instance;
+
+static const size_t object_counts[] = { 8, 32, 128, OBJECT_MAXIMUM };
+
+static rtems_name classic_name(size_t i)
+{
+  return rtems_build_name('S', 'M', (char) (i >> 8), (char) i);
+}
+
+static void posix_name(char *name, size_t size, size_t i)
+{
+  int n;
+
+  n = snprintf(name, size, "/sem%04zu", i);
+  rtems_test_assert(n > 0 && (size_t) n < size);
+}
+
+static void set_name_index(Objects_Information *information, bool enable)
+{
+  _Objects_Allocator_lock();
+
+  if (enable) {
+    bool ok;
+
+    ok = _Objects_Name_index_create(information);
+    rtems_test_assert(ok);
+  } else {
+    _Workspace_Free(information->name_index);
+    information->name_index = NULL;
+  }
+
+  _Objects_Allocator_unlock();
+}
+
+static void create_objects(test_context *ctx, size_t count)
+{
+  size_t i;
+
+  for (i = ctx->count; i < count; ++i) {
+    rtems_status_code sc;
+    char name[16];
+
+    sc = rtems_semaphore_create(
+      classic_name(i),
+      1,
+      RTEMS_COUNTING_SEMAPHORE,
+      0,
+      &ctx->classic_ids[i]
+    );
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+    posix_name(name, sizeof(name), i);
+    ctx->posix_sems[i] = sem_open(name, O_CREAT | O_EXCL, 0666, 1);
+    rtems_test_assert(ctx->posix_sems[i] != SEM_FAILED);
+  }
+
+  ctx->count = count;
+}
+
+static void account(
+  lookup_results *results,
+  rtems_counter_ticks a,
+  rtems_counter_ticks b
+)
+{
+  rtems_counter_ticks d;
+
+  d = rtems_counter_difference(b, a);
+  results->sum += d;
+
+  if (d > results->max) {
+    results->max = d;
+  }
+}
+
+static void lookup_classic(test_context *ctx, lookup_results *results)
+{
+  size_t i;
+
+  for (i = 0; i < ctx->count; ++i) {
+    rtems_status_code sc;
+    rtems_counter_ticks a;
+    rtems_counter_ticks b;
+    rtems_id id;
+
+    a = rtems_counter_read();
+    sc = rtems_semaphore_ident(classic_name(i), RTEMS_SEARCH_LOCAL_NODE, &id);
+    b = rtems_counter_read();
+
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+    rtems_test_assert(id == ctx->classic_ids[i]);
+    account(results, a, b);
+  }
+}
+
+static void lookup_posix(test_context *ctx, lookup_results *results)
+{
+  size_t i;
+
+  for (i = 0; i < ctx->count; ++i) {
+    rtems_counter_ticks a;
+    rtems_counter_ticks b;
+    char name[16];
+    sem_t *sem;
+    int rv;
+
+    posix_name(name, sizeof(name), i);
+
+    a = rtems_counter_read();
+    sem = sem_open(name, 0);
+    b = rtems_counter_read();
+
+    rtems_test_assert(sem == ctx->posix_sems[i]);
+    account(results, a, b);
+
+    rv = sem_close(sem);
+    rtems_test_assert(rv == 0);
+  }
+}
+
+static void print_results(
+  const char *name,
+  const lookup_results *results,
+  size_t count
+)
+{
+  printf(
+    "      <%s><Avg unit=\"ns\">%" PRIu64 "</Avg>"
+    "<Max unit=\"ns\">%" PRIu64 "</Max></%s>\n",
+    name,
+    rtems_counter_ticks_to_nanoseconds(results->sum) / count,
+    rtems_counter_ticks_to_nanoseconds(results->max),
+    name
+  );
+}
+
+static void measure(
+  test_context *ctx,
+  const char *name,
+  Objects_Information *information,
+  void (*lookup)(test_context *, lookup_results *)
+)
+{
+  lookup_results linear;
+  lookup_results indexed;
+
+  memset(&linear, 0, sizeof(linear));
+  memset(&indexed, 0, sizeof(indexed));
+
+  set_name_index(information, false);
+  (*lookup)(ctx, &linear);
+  set_name_index(information, true);
+  (*lookup)(ctx, &indexed);
+
+  printf("    <%s>\n", name);
+  print_results("Linear", &linear, ctx->count);
+  print_results("Index", &indexed, ctx->count);
+  printf("    </%s>\n", name);
+}
+
+static void Init(rtems_task_argument arg)
+{
+  test_context *ctx;
+  size_t i;
+
+  ctx = &test_instance;
+
+  TEST_BEGIN();
+
+  rtems_test_assert(_Semaphore_Information.name_index != NULL);
+  rtems_test_assert(_POSIX_Semaphore_Information.name_index != NULL);
+
+  printf("<TMObjName01>\n");
+
+  for (i = 0; i < RTEMS_ARRAY_SIZE(object_counts); ++i) {
+    create_objects(ctx, object_counts[i]);
+
+    printf("  <Objects count=\"%zu\">\n", ctx->count);
+    measure(ctx, "SemaphoreIdent", &_Semaphore_Information, lookup_classic);
+    measure(
+      ctx,
+      "SemOpen",
+      &_POSIX_Semaphore_Information,
+      lookup_posix
+    );
+    printf("  </Objects>\n");
+  }
+
+  printf("</TMObjName01>\n");
+
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_CONSOLE_DRIVER
+
+#define CONFIGURE_MAXIMUM_TASKS 1
+
+#define CONFIGURE_MAXIMUM_SEMAPHORES rtems_resource_unlimited(32)
+
+#define CONFIGURE_MAXIMUM_POSIX_SEMAPHORES rtems_resource_unlimited(32)
+
+#define CONFIGURE_UNIFIED_WORK_AREAS
+
+#define CONFIGURE_OBJECTS_NAME_INDEX
+
+#define CONFIGURE_INIT_TASK_INITIAL_MODES RTEMS_DEFAULT_MODES
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
@@ -0,0 +1,279 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (c) 2026 Dave Rush.  All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "tmacros.h"
+
+#include <inttypes.h>
+#include <stdio.h>
+
+#include <rtems.h>
+#include <rtems/bspIo.h>
+#include <rtems/counter.h>
+
+#include <bsp.h>
+#include <bsp/printk-buffer.h>
+#include <bsp/usart.h>
+
+const char rtems_test_name[] = "TMPRINTK 1";
+
+#define SAMPLE_COUNT 32
+
+#define ISR_SAMPLE_COUNT 8
+
+#define MESSAGE "tmprintk01: 0123456789abcdef\n"
+
+typedef struct {
+  uint32_t min;
+  uint32_t max;
+} sample_range;
+
+typedef struct {
+  sample_range isr;
+  uint32_t isr_count;
+  rtems_id timer;
+  rtems_id task;
+} test_context;
+
+static test_context test_instance;
+
+static void range_init(sample_range *range)
+{
+  range->min = UINT32_MAX;
+  range->max = 0;
+}
+
+static void range_add(sample_range *range, rtems_counter_ticks ticks)
+{
+  uint32_t ns;
+
+  ns = (uint32_t) rtems_counter_ticks_to_nanoseconds(ticks);
+
+  if (ns < range->min) {
+    range->min = ns;
+  }
+
+  if (ns > range->max) {
+    range->max = ns;
+  }
+}
+
+static void print_range(const char *name, const sample_range *range)
+{
+  printf(
+    "  <%s><Min unit=\"ns\">%" PRIu32 "</Min>"
+    "<Max unit=\"ns\">%" PRIu32 "</Max></%s>\n",
+    name,
+    range->min,
+    range->max,
+    name
+  );
+}
+
+static void wait_for_drain(void)
+{
+#if MK64F12_PRINTK_BUFFER_SIZE > 0
+  while (!mk64f12_printk_is_empty()) {
+    rtems_status_code sc;
+
+    sc = rtems_task_wake_after(1);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  }
+#endif
+}
+
+static void direct_output(const char *s)
+{
+  while (*s != '\0') {
+    mk64f12_console_output_char(*s);
+    ++s;
+  }
+}
+
+static void measure_task(void)
+{
+  sample_range buffered;
+  sample_range direct;
+  int i;
+
+  range_init(&buffered);
+  range_init(&direct);
+
+  for (i = 0; i < SAMPLE_COUNT; ++i) {
+    rtems_counter_ticks begin;
+
+    wait_for_drain();
+
+    begin = rtems_counter_read();
+    printk(MESSAGE);
+    range_add(&buffered, rtems_counter_difference(rtems_counter_read(), begin));
+
+    wait_for_drain();
+
+    begin = rtems_counter_read();
+    direct_output(MESSAGE);
+    range_add(&direct, rtems_counter_difference(rtems_counter_read(), begin));
+  }
+
+  print_range("Printk", &buffered);
+  print_range("DirectOutput", &direct);
+}
+
+static void timer(rtems_id id, void *arg)
+{
+  test_context *ctx;
+  rtems_counter_ticks begin;
+
+  ctx = arg;
+  begin = rtems_counter_read();
+  printk(MESSAGE);
+  range_add(&ctx->isr, rtems_counter_difference(rtems_counter_read(), begin));
+
+  if (++ctx->isr_count < ISR_SAMPLE_COUNT) {
+    (void) rtems_timer_reset(id);
+  } else {
+    (void) rtems_event_transient_send(ctx->task);
+  }
+}
+
+static void measure_isr(test_context *ctx)
+{
+  rtems_status_code sc;
+
+  range_init(&ctx->isr);
+  ctx->isr_count = 0;
+  ctx->task = rtems_task_self();
+
+  sc = rtems_timer_create(rtems_build_name('P', 'R', 'N', 'K'), &ctx->timer);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_timer_fire_after(ctx->timer, 1, timer, ctx);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_event_transient_receive(RTEMS_WAIT, RTEMS_NO_TIMEOUT);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_timer_delete(ctx->timer);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  print_range("PrintkInterrupt", &ctx->isr);
+}
+
+static void test_overflow(void)
+{
+#if MK64F12_PRINTK_BUFFER_SIZE > 0
+  mk64f12_printk_statistics before;
+  mk64f12_printk_statistics after;
+  uint32_t n;
+  int i;
+
+  wait_for_drain();
+  mk64f12_printk_get_statistics(&before);
+
+  /* The idle thread cannot drain the buffer while this task runs */
+  n = MK64F12_PRINTK_BUFFER_SIZE / (sizeof(MESSAGE) - 1) + 2;
+
+  for (i = 0; i < (int) n; ++i) {
+    printk(MESSAGE);
+  }
+
+  mk64f12_printk_get_statistics(&after);
+  rtems_test_assert(after.dropped > before.dropped);
+
+  wait_for_drain();
+  mk64f12_printk_get_statistics(&after);
+  rtems_test_assert(after.max_fill == MK64F12_PRINTK_BUFFER_SIZE);
+
+  printf(
+    "  <Overflow><Written>%" PRIu32 "</Written>"
+    "<Dropped>%" PRIu32 "</Dropped></Overflow>\n",
+    n * (uint32_t) (sizeof(MESSAGE) - 1),
+    after.dropped - before.dropped
+  );
+#endif
+}
+
+static void print_statistics(void)
+{
+#if MK64F12_PRINTK_BUFFER_SIZE > 0
+  mk64f12_printk_statistics stats;
+
+  mk64f12_printk_get_statistics(&stats);
+  printf(
+    "  <Statistics><Size>%" PRIu32 "</Size>"
+    "<Chars>%" PRIu32 "</Chars>"
+    "<Dropped>%" PRIu32 "</Dropped>"
+    "<MaxFill>%" PRIu32 "</MaxFill></Statistics>\n",
+    (uint32_t) MK64F12_PRINTK_BUFFER_SIZE,
+    stats.chars,
+    stats.dropped,
+    stats.max_fill
+  );
+#else
+  printf("  <Statistics><Size>0</Size></Statistics>\n");
+#endif
+}
+
+static void Init(rtems_task_argument arg)
+{
+  test_context *ctx;
+
+  TEST_BEGIN();
+
+  ctx = &test_instance;
+
+  printf("<TMPRINTK01>\n");
+  measure_task();
+  measure_isr(ctx);
+  wait_for_drain();
+  test_overflow();
+  print_statistics();
+  printf("</TMPRINTK01>\n");
+
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_CONSOLE_DRIVER
+
+#define CONFIGURE_MAXIMUM_TASKS 1
+
+#define CONFIGURE_MAXIMUM_TIMERS 1
+
+#define CONFIGURE_INIT_TASK_INITIAL_MODES RTEMS_DEFAULT_MODES
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
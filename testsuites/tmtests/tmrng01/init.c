@@ -0,0 +1,245 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (c) 2026 Dave Rush.  All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "tmacros.h"
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <rtems.h>
+#include <rtems/counter.h>
+
+#include <bsp.h>
+#include <bsp/mk64f12.h>
+#include <bsp/rng.h>
+
+const char rtems_test_name[] = "TMRNG 1";
+
+#define SAMPLE_COUNT 64
+
+#define MAX_SIZE 256
+
+typedef struct {
+  uint8_t a[MAX_SIZE];
+  uint8_t b[MAX_SIZE];
+} test_context;
+
+static test_context test_instance;
+
+static const size_t sizes[] = { 4, 32, MAX_SIZE };
+
+static void print_latency(
+  const char *name,
+  size_t bytes,
+  rtems_counter_ticks best,
+  rtems_counter_ticks worst
+)
+{
+  printf(
+    "    <%s><Bytes>%zu</Bytes><Min unit=\"ns\">%" PRIu64 "</Min>"
+    "<Max unit=\"ns\">%" PRIu64 "</Max></%s>\n",
+    name,
+    bytes,
+    rtems_counter_ticks_to_nanoseconds(best),
+    rtems_counter_ticks_to_nanoseconds(worst),
+    name
+  );
+}
+
+static void measure_getentropy(test_context *ctx, size_t size)
+{
+  rtems_counter_ticks best;
+  rtems_counter_ticks worst;
+  int i;
+
+  best = 0;
+  worst = 0;
+
+  for (i = 0; i < SAMPLE_COUNT; ++i) {
+    rtems_counter_ticks a;
+    rtems_counter_ticks b;
+    rtems_counter_ticks d;
+    int rv;
+
+    a = rtems_counter_read();
+    rv = getentropy(ctx->a, size);
+    b = rtems_counter_read();
+    rtems_test_assert(rv == 0);
+    d = rtems_counter_difference(b, a);
+
+    if (i == 0 || d < best) {
+      best = d;
+    }
+
+    if (d > worst) {
+      worst = d;
+    }
+  }
+
+  print_latency("GetEntropy", size, best, worst);
+}
+
+static void measure_rnga(test_context *ctx, size_t size)
+{
+  rtems_counter_ticks best;
+  rtems_counter_ticks worst;
+  int i;
+
+  best = 0;
+  worst = 0;
+
+  for (i = 0; i < SAMPLE_COUNT; ++i) {
+    rtems_counter_ticks a;
+    rtems_counter_ticks b;
+    rtems_counter_ticks d;
+    status_t status;
+
+    a = rtems_counter_read();
+    status = RNGA_GetRandomData(RNG, ctx->a, size);
+    b = rtems_counter_read();
+    rtems_test_assert(status == kStatus_Success);
+    d = rtems_counter_difference(b, a);
+
+    if (i == 0 || d < best) {
+      best = d;
+    }
+
+    if (d > worst) {
+      worst = d;
+    }
+  }
+
+  print_latency("RNGA", size, best, worst);
+}
+
+static void test_output(test_context *ctx)
+{
+  int rv;
+
+  memset(ctx->a, 0, sizeof(ctx->a));
+  memset(ctx->b, 0, sizeof(ctx->b));
+
+  rv = getentropy(ctx->a, sizeof(ctx->a));
+  rtems_test_assert(rv == 0);
+
+  rv = getentropy(ctx->b, sizeof(ctx->b));
+  rtems_test_assert(rv == 0);
+
+  rtems_test_assert(memcmp(ctx->a, ctx->b, sizeof(ctx->a)) != 0);
+
+  rv = getentropy(ctx->a, 0);
+  rtems_test_assert(rv == 0);
+}
+
+static void test_reseed(test_context *ctx)
+{
+  mk64f12_rng_statistics before;
+  mk64f12_rng_statistics after;
+  uint64_t limit;
+
+  mk64f12_rng_get_statistics(&before);
+  limit = before.bytes + 2 * (uint64_t) MK64F12_RNG_RESEED_INTERVAL
+    + 64 * MAX_SIZE;
+
+  do {
+    int rv;
+
+    rv = getentropy(ctx->a, MAX_SIZE);
+    rtems_test_assert(rv == 0);
+    mk64f12_rng_get_statistics(&after);
+  } while (after.reseeds == before.reseeds && after.bytes < limit);
+
+  rtems_test_assert(after.reseeds > before.reseeds);
+  rtems_test_assert(after.refills > before.refills);
+}
+
+static void print_statistics(void)
+{
+  mk64f12_rng_statistics stats;
+
+  mk64f12_rng_get_statistics(&stats);
+  printf(
+    "  <Statistics><Bytes>%" PRIu64 "</Bytes>"
+    "<Refills>%" PRIu32 "</Refills><Reseeds>%" PRIu32 "</Reseeds>"
+    "<RNGAWords>%" PRIu32 "</RNGAWords>"
+    "<HealthFailures>%" PRIu32 "</HealthFailures></Statistics>\n",
+    stats.bytes,
+    stats.refills,
+    stats.reseeds,
+    stats.rnga_words,
+    stats.health_failures
+  );
+  rtems_test_assert(stats.rnga_words > stats.health_failures);
+}
+
+static void Init(rtems_task_argument arg)
+{
+  test_context *ctx;
+  size_t i;
+
+  TEST_BEGIN();
+
+  ctx = &test_instance;
+
+  printf("<TMRNG01>\n");
+  test_output(ctx);
+  test_reseed(ctx);
+
+  for (i = 0; i < RTEMS_ARRAY_SIZE(sizes); ++i) {
+    printf("  <Latency>\n");
+    measure_getentropy(ctx, sizes[i]);
+    measure_rnga(ctx, sizes[i]);
+    printf("  </Latency>\n");
+  }
+
+  print_statistics();
+  printf("</TMRNG01>\n");
+
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_CONSOLE_DRIVER
+
+#define CONFIGURE_MAXIMUM_TASKS 1
+
+#define CONFIGURE_INIT_TASK_INITIAL_MODES RTEMS_DEFAULT_MODES
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
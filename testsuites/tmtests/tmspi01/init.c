@@ -0,0 +1,221 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (c) 2026 Dave Rush.  All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "tmacros.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/ioctl.h>
+#include <unistd.h>
+
+#include <dev/spi/spi.h>
+#include <rtems.h>
+#include <rtems/counter.h>
+
+#include <bsp/dspi.h>
+
+const char rtems_test_name[] = "TMSPI 1";
+
+/*
+ * Connect SPI0_SOUT (PTD2, J2 pin 8) with SPI0_SIN (PTD3, J2 pin 10) on the
+ * FRDM-K64F, so that the received data equals the transmitted data.
+ */
+#define BUS_PATH "/dev/spi-0"
+
+#define BLOCK_SIZE 4096
+
+#define CHAIN_COUNT 4
+
+typedef struct {
+  int fd;
+  size_t mismatches;
+  uint8_t tx[BLOCK_SIZE];
+  uint8_t rx[BLOCK_SIZE];
+} test_context;
+
+static test_context test_instance;
+
+static void init_msg(
+  test_context *ctx,
+  spi_ioc_transfer *msg,
+  size_t offset,
+  size_t size,
+  uint32_t speed_hz,
+  bool cs_change
+)
+{
+  memset(msg, 0, sizeof(*msg));
+  msg->tx_buf = &ctx->tx[offset];
+  msg->rx_buf = &ctx->rx[offset];
+  msg->len = size;
+  msg->speed_hz = speed_hz;
+  msg->bits_per_word = 8;
+  msg->cs_change = cs_change;
+}
+
+static void test_transfer(
+  test_context *ctx,
+  uint32_t speed_hz,
+  size_t size,
+  size_t count
+)
+{
+  spi_ioc_transfer msgs[CHAIN_COUNT];
+  mk64f12_dspi_statistics s0;
+  mk64f12_dspi_statistics s1;
+  rtems_counter_ticks a;
+  rtems_counter_ticks b;
+  uint64_t ns;
+  size_t total;
+  size_t i;
+  int rv;
+
+  rtems_test_assert(count <= CHAIN_COUNT && size * count <= BLOCK_SIZE);
+  total = size * count;
+
+  for (i = 0; i < count; ++i) {
+    init_msg(ctx, &msgs[i], i * size, size, speed_hz, i == count - 1);
+  }
+
+  memset(ctx->rx, 0, total);
+
+  rv = ioctl(ctx->fd, MK64F12_DSPI_GET_STATISTICS, &s0);
+  rtems_test_assert(rv == 0);
+
+  a = rtems_counter_read();
+  rv = ioctl(ctx->fd, SPI_IOC_MESSAGE(count), &msgs[0]);
+  b = rtems_counter_read();
+  rtems_test_assert(rv == 0);
+
+  rv = ioctl(ctx->fd, MK64F12_DSPI_GET_STATISTICS, &s1);
+  rtems_test_assert(rv == 0);
+
+  if (memcmp(ctx->rx, ctx->tx, total) != 0) {
+    ++ctx->mismatches;
+  }
+
+  ns = rtems_counter_ticks_to_nanoseconds(rtems_counter_difference(b, a));
+
+  printf(
+    "  <Sample>\n"
+    "    <Speed unit=\"Hz\">%" PRIu32 "</Speed><Messages>%zu</Messages>"
+    "<Bytes>%zu</Bytes><Time unit=\"ns\">%" PRIu64 "</Time>"
+    "<Throughput unit=\"B/s\">%" PRIu64 "</Throughput>"
+    "<Interrupts>%" PRIu32 "</Interrupts>"
+    "<DMAMessages>%" PRIu32 "</DMAMessages>\n"
+    "  </Sample>\n",
+    speed_hz,
+    count,
+    total,
+    ns,
+    ((uint64_t) total * 1000000000) / ns,
+    (s1.interrupts - s0.interrupts) + (s1.dma_interrupts - s0.dma_interrupts),
+    s1.dma_messages - s0.dma_messages
+  );
+}
+
+static void test(void)
+{
+  static const uint32_t speeds[] = { 1000000, 5000000, 10000000, 30000000 };
+  static const size_t sizes[] = { 4, 64, 1024, BLOCK_SIZE };
+  test_context *ctx = &test_instance;
+  spi_ioc_transfer msg;
+  size_t i;
+  size_t j;
+  int rv;
+
+  for (i = 0; i < sizeof(ctx->tx); ++i) {
+    ctx->tx[i] = (uint8_t) (i * 7 + (i >> 8));
+  }
+
+  rv = mk64f12_dspi_register(0, BUS_PATH);
+  rtems_test_assert(rv == 0);
+
+  ctx->fd = open(BUS_PATH, O_RDWR);
+  rtems_test_assert(ctx->fd >= 0);
+
+  /* The DSPI has no internal loop back mode */
+  init_msg(ctx, &msg, 0, 1, 1000000, true);
+  msg.mode = SPI_LOOP;
+  rv = ioctl(ctx->fd, SPI_IOC_MESSAGE(1), &msg);
+  rtems_test_assert(rv == -1);
+  rtems_test_assert(errno == EINVAL);
+
+  printf("<TMSpi01>\n");
+
+  for (i = 0; i < RTEMS_ARRAY_SIZE(speeds); ++i) {
+    for (j = 0; j < RTEMS_ARRAY_SIZE(sizes); ++j) {
+      test_transfer(ctx, speeds[i], sizes[j], 1);
+    }
+
+    test_transfer(ctx, speeds[i], BLOCK_SIZE / CHAIN_COUNT, CHAIN_COUNT);
+  }
+
+  printf("</TMSpi01>\n");
+
+  rtems_test_assert(ctx->mismatches == 0);
+
+  rv = close(ctx->fd);
+  rtems_test_assert(rv == 0);
+
+  rv = unlink(BUS_PATH);
+  rtems_test_assert(rv == 0);
+}
+
+static void Init(rtems_task_argument arg)
+{
+  TEST_BEGIN();
+
+  test();
+
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_CONSOLE_DRIVER
+
+#define CONFIGURE_MAXIMUM_FILE_DESCRIPTORS 5
+
+#define CONFIGURE_MAXIMUM_TASKS 1
+
+#define CONFIGURE_INIT_TASK_INITIAL_MODES RTEMS_DEFAULT_MODES
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
@@ -0,0 +1,213 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (c) 2026 Dave Rush.  All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "tmacros.h"
+
+#include <inttypes.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <string.h>
+
+#include <rtems.h>
+#include <rtems/counter.h>
+#include <rtems/libcsupport.h>
+#include <rtems/score/apimutex.h>
+#include <rtems/score/threadimpl.h>
+
+const char rtems_test_name[] = "TMSTACKCACHE 1";
+
+#define SAMPLE_COUNT 64
+
+typedef struct {
+  uint64_t sum;
+  uint64_t max;
+} time_results;
+
+static void account(time_results *results, rtems_counter_ticks begin)
+{
+  uint64_t ns;
+
+  ns = rtems_counter_ticks_to_nanoseconds(
+    rtems_counter_difference(rtems_counter_read(), begin)
+  );
+  results->sum += ns;
+
+  if (ns > results->max) {
+    results->max = ns;
+  }
+}
+
+/*
+ * Free the stacks of the deleted threads and then all cached stacks, so that
+ * the next thread create allocates its stack from the stack allocator.
+ */
+static void flush_stack_cache(void)
+{
+  _RTEMS_Lock_allocator();
+  _Thread_Kill_zombies();
+  _RTEMS_Unlock_allocator();
+  _Stack_Cache_flush();
+}
+
+static void worker_task(rtems_task_argument arg)
+{
+  (void) arg;
+  rtems_task_exit();
+}
+
+static void *worker_thread(void *arg)
+{
+  return arg;
+}
+
+/*
+ * The worker has a higher priority than the initialization task, so it runs
+ * and terminates during the start.  The next create frees the zombie.
+ */
+static void task_cycle(time_results *results, bool flush)
+{
+  int i;
+
+  for (i = 0; i < SAMPLE_COUNT; ++i) {
+    rtems_counter_ticks begin;
+    rtems_status_code sc;
+    rtems_id id;
+
+    if (flush) {
+      flush_stack_cache();
+    }
+
+    begin = rtems_counter_read();
+    sc = rtems_task_create(
+      rtems_build_name('W', 'O', 'R', 'K'),
+      1,
+      RTEMS_MINIMUM_STACK_SIZE,
+      RTEMS_DEFAULT_MODES,
+      RTEMS_DEFAULT_ATTRIBUTES,
+      &id
+    );
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+    sc = rtems_task_start(id, worker_task, 0);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+    account(results, begin);
+  }
+}
+
+static void thread_cycle(time_results *results, bool flush)
+{
+  int i;
+
+  for (i = 0; i < SAMPLE_COUNT; ++i) {
+    rtems_counter_ticks begin;
+    pthread_t thread;
+    void *value;
+    int eno;
+
+    if (flush) {
+      flush_stack_cache();
+    }
+
+    begin = rtems_counter_read();
+    eno = pthread_create(&thread, NULL, worker_thread, &value);
+    rtems_test_assert(eno == 0);
+
+    eno = pthread_join(thread, &value);
+    rtems_test_assert(eno == 0);
+    account(results, begin);
+    rtems_test_assert(value == &value);
+  }
+}
+
+static void print_results(const char *name, const time_results *results)
+{
+  printf(
+    "    <%s><Avg unit=\"ns\">%" PRIu64 "</Avg>"
+    "<Max unit=\"ns\">%" PRIu64 "</Max></%s>\n",
+    name,
+    results->sum / SAMPLE_COUNT,
+    results->max,
+    name
+  );
+}
+
+static void measure(const char *name, bool flush)
+{
+  time_results task;
+  time_results thread;
+
+  memset(&task, 0, sizeof(task));
+  memset(&thread, 0, sizeof(thread));
+  task_cycle(&task, flush);
+  thread_cycle(&thread, flush);
+
+  printf("  <%s>\n", name);
+  print_results("TaskCreateStartExit", &task);
+  print_results("ThreadCreateJoin", &thread);
+  printf("  </%s>\n", name);
+}
+
+static void Init(rtems_task_argument arg)
+{
+  rtems_resource_snapshot snapshot;
+
+  TEST_BEGIN();
+
+  rtems_resource_snapshot_take(&snapshot);
+
+  printf("<TMStackCache01>\n");
+  measure("Allocator", true);
+  measure("Cache", false);
+  printf("</TMStackCache01>\n");
+
+  rtems_test_assert(rtems_resource_snapshot_check(&snapshot));
+
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_DOES_NOT_NEED_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+
+#define CONFIGURE_MAXIMUM_TASKS 2
+
+#define CONFIGURE_MAXIMUM_POSIX_THREADS 1
+
+#define CONFIGURE_TASK_STACK_CACHE_CLASSES 2
+
+#define CONFIGURE_TASK_STACK_CACHE_MAXIMUM 2
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
@@ -0,0 +1,216 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (c) 2026 Dave Rush.  All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "tmacros.h"
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+#include <termios.h>
+#include <unistd.h>
+
+#include <rtems.h>
+#include <rtems/counter.h>
+
+const char rtems_test_name[] = "TMTERMIOS 1";
+
+#define LINE_LENGTH 64
+
+#define CALIBRATION_TICKS 100
+
+typedef struct {
+  rtems_id load;
+  volatile uint32_t load_count;
+  uint64_t calibration_count;
+  uint64_t calibration_ns;
+  char line[LINE_LENGTH];
+} test_context;
+
+static test_context test_instance;
+
+static void load_task(rtems_task_argument arg)
+{
+  test_context *ctx = (test_context *) arg;
+
+  while (true) {
+    ++ctx->load_count;
+  }
+}
+
+static uint64_t elapsed_ns(rtems_counter_ticks a, rtems_counter_ticks b)
+{
+  return rtems_counter_ticks_to_nanoseconds(rtems_counter_difference(b, a));
+}
+
+/*
+ * Determine the load task counter increments per time interval while the
+ * processor is otherwise idle.
+ */
+static void calibrate(test_context *ctx)
+{
+  rtems_status_code sc;
+  rtems_counter_ticks a;
+  rtems_counter_ticks b;
+  uint32_t c0;
+  uint32_t c1;
+
+  c0 = ctx->load_count;
+  a = rtems_counter_read();
+  sc = rtems_task_wake_after(CALIBRATION_TICKS);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  b = rtems_counter_read();
+  c1 = ctx->load_count;
+
+  ctx->calibration_count = c1 - c0;
+  ctx->calibration_ns = elapsed_ns(a, b);
+  rtems_test_assert(ctx->calibration_count > 0);
+}
+
+static void test_burst(test_context *ctx, size_t burst_size)
+{
+  rtems_counter_ticks a;
+  rtems_counter_ticks b;
+  rtems_counter_ticks c;
+  uint32_t c0;
+  uint32_t c1;
+  uint64_t write_ns;
+  uint64_t total_ns;
+  uint64_t idle_expected;
+  uint64_t cpu_load;
+  size_t done;
+  int rv;
+
+  c0 = ctx->load_count;
+  a = rtems_counter_read();
+
+  for (done = 0; done < burst_size; done += LINE_LENGTH) {
+    ssize_t n;
+
+    n = write(STDOUT_FILENO, ctx->line, sizeof(ctx->line));
+    rtems_test_assert(n == (ssize_t) sizeof(ctx->line));
+  }
+
+  b = rtems_counter_read();
+  rv = tcdrain(STDOUT_FILENO);
+  rtems_test_assert(rv == 0);
+  c = rtems_counter_read();
+  c1 = ctx->load_count;
+
+  write_ns = elapsed_ns(a, b);
+  total_ns = elapsed_ns(a, c);
+  idle_expected = (ctx->calibration_count * total_ns) / ctx->calibration_ns;
+
+  if (idle_expected > 0 && c1 - c0 < idle_expected) {
+    cpu_load = 100 - (100 * (uint64_t) (c1 - c0)) / idle_expected;
+  } else {
+    cpu_load = 0;
+  }
+
+  printf(
+    "  <Sample>\n"
+    "    <Bytes>%zu</Bytes><Write unit=\"ns\">%" PRIu64 "</Write>"
+    "<Total unit=\"ns\">%" PRIu64 "</Total>"
+    "<Throughput unit=\"B/s\">%" PRIu64 "</Throughput>"
+    "<CPULoad unit=\"%%\">%" PRIu64 "</CPULoad>\n"
+    "  </Sample>\n",
+    done,
+    write_ns,
+    total_ns,
+    ((uint64_t) done * 1000000000) / total_ns,
+    cpu_load
+  );
+}
+
+static void test(void)
+{
+  test_context *ctx = &test_instance;
+  rtems_status_code sc;
+  size_t i;
+  size_t burst_size;
+
+  for (i = 0; i < sizeof(ctx->line) - 1; ++i) {
+    ctx->line[i] = (char) ('!' + (i % ('~' - '!')));
+  }
+
+  ctx->line[sizeof(ctx->line) - 1] = '\n';
+
+  sc = rtems_task_create(
+    rtems_build_name('L', 'O', 'A', 'D'),
+    RTEMS_MAXIMUM_PRIORITY - 1,
+    RTEMS_MINIMUM_STACK_SIZE,
+    RTEMS_DEFAULT_MODES,
+    RTEMS_DEFAULT_ATTRIBUTES,
+    &ctx->load
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_task_start(ctx->load, load_task, (rtems_task_argument) ctx);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  calibrate(ctx);
+
+  printf("<TMTermios01>\n");
+
+  for (burst_size = LINE_LENGTH; burst_size <= 4096; burst_size *= 4) {
+    test_burst(ctx, burst_size);
+  }
+
+  printf("</TMTermios01>\n");
+
+  sc = rtems_task_delete(ctx->load);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+}
+
+static void Init(rtems_task_argument arg)
+{
+  TEST_BEGIN();
+
+  test();
+
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_CONSOLE_DRIVER
+
+#define CONFIGURE_MAXIMUM_FILE_DESCRIPTORS 4
+
+#define CONFIGURE_MAXIMUM_TASKS 2
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
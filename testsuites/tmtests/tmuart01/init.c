@@ -0,0 +1,287 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (c) 2026 Dave Rush.  All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "tmacros.h"
+
+#include <fcntl.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+#include <termios.h>
+#include <unistd.h>
+
+#include <rtems.h>
+#include <rtems/counter.h>
+
+#include <bsp/usart.h>
+
+const char rtems_test_name[] = "TMUART 1";
+
+#define DEVICE "/dev/ttyS0"
+
+#define DEVICE_MINOR 0
+
+#define BLOCK_SIZE 4096
+
+#define SAMPLE_COUNT 4
+
+typedef struct {
+  size_t bytes;
+  uint64_t ns;
+  uint32_t interrupts;
+  uint32_t rx_errors;
+} test_sample;
+
+typedef struct {
+  rtems_id master;
+  rtems_id reader;
+  int fd;
+  size_t expected;
+  size_t received;
+  size_t mismatches;
+  struct termios console_term;
+  test_sample samples[SAMPLE_COUNT];
+  uint8_t tx[BLOCK_SIZE];
+  uint8_t rx[BLOCK_SIZE];
+} test_context;
+
+static test_context test_instance;
+
+static void reader_task(rtems_task_argument arg)
+{
+  test_context *ctx = (test_context *) arg;
+
+  while (true) {
+    rtems_status_code sc;
+
+    sc = rtems_event_transient_receive(RTEMS_WAIT, RTEMS_NO_TIMEOUT);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+    while (ctx->received < ctx->expected) {
+      ssize_t n;
+
+      n = read(
+        ctx->fd,
+        &ctx->rx[ctx->received],
+        ctx->expected - ctx->received
+      );
+      rtems_test_assert(n > 0);
+      ctx->received += (size_t) n;
+    }
+
+    sc = rtems_event_transient_send(ctx->master);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  }
+}
+
+static void set_raw_mode(test_context *ctx, speed_t speed)
+{
+  struct termios term;
+  int rv;
+
+  rv = tcgetattr(ctx->fd, &term);
+  rtems_test_assert(rv == 0);
+
+  ctx->console_term = term;
+  cfmakeraw(&term);
+  term.c_cc[VMIN] = 1;
+  term.c_cc[VTIME] = 0;
+
+  rv = cfsetspeed(&term, speed);
+  rtems_test_assert(rv == 0);
+
+  rv = tcsetattr(ctx->fd, TCSADRAIN, &term);
+  rtems_test_assert(rv == 0);
+}
+
+static void restore_console_mode(test_context *ctx)
+{
+  int rv;
+
+  rv = tcsetattr(ctx->fd, TCSADRAIN, &ctx->console_term);
+  rtems_test_assert(rv == 0);
+}
+
+static void test_block(
+  test_context *ctx,
+  test_sample *sample,
+  size_t block_size
+)
+{
+  mk64f12_usart_statistics s0;
+  mk64f12_usart_statistics s1;
+  rtems_counter_ticks a;
+  rtems_counter_ticks b;
+  rtems_status_code sc;
+  ssize_t n;
+  size_t i;
+
+  memset(ctx->rx, 0, block_size);
+  ctx->received = 0;
+  ctx->expected = block_size;
+
+  mk64f12_usart_get_statistics(DEVICE_MINOR, &s0);
+  a = rtems_counter_read();
+
+  sc = rtems_event_transient_send(ctx->reader);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  n = write(ctx->fd, ctx->tx, block_size);
+  rtems_test_assert(n == (ssize_t) block_size);
+
+  sc = rtems_event_transient_receive(RTEMS_WAIT, RTEMS_NO_TIMEOUT);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  b = rtems_counter_read();
+  mk64f12_usart_get_statistics(DEVICE_MINOR, &s1);
+
+  sample->bytes = block_size;
+  sample->ns =
+    rtems_counter_ticks_to_nanoseconds(rtems_counter_difference(b, a));
+  sample->interrupts = (s1.interrupts - s0.interrupts)
+    + (s1.dma_interrupts - s0.dma_interrupts);
+  sample->rx_errors = s1.rx_errors - s0.rx_errors;
+
+  for (i = 0; i < block_size; ++i) {
+    if (ctx->rx[i] != ctx->tx[i]) {
+      ++ctx->mismatches;
+    }
+  }
+}
+
+static void print_sample(const test_sample *sample)
+{
+  printf(
+    "  <Sample>\n"
+    "    <Bytes>%zu</Bytes><Time unit=\"ns\">%" PRIu64 "</Time>"
+    "<Throughput unit=\"B/s\">%" PRIu64 "</Throughput>"
+    "<InterruptsPerKiB>%" PRIu32 "</InterruptsPerKiB>"
+    "<RxErrors>%" PRIu32 "</RxErrors>\n"
+    "  </Sample>\n",
+    sample->bytes,
+    sample->ns,
+    ((uint64_t) sample->bytes * 1000000000) / sample->ns,
+    (uint32_t) (((uint64_t) sample->interrupts * 1024) / sample->bytes),
+    sample->rx_errors
+  );
+}
+
+static void test(void)
+{
+  test_context *ctx = &test_instance;
+  rtems_status_code sc;
+  size_t i;
+  size_t block_size;
+  int rv;
+
+  ctx->master = rtems_task_self();
+
+  for (i = 0; i < sizeof(ctx->tx); ++i) {
+    ctx->tx[i] = (uint8_t) (i * 7 + (i >> 8));
+  }
+
+  ctx->fd = open(DEVICE, O_RDWR);
+  rtems_test_assert(ctx->fd >= 0);
+
+  /*
+   * The console UART runs in internal loop back mode, so nothing may be
+   * printed until the console mode is restored.
+   */
+  set_raw_mode(ctx, B921600);
+  mk64f12_usart_set_loopback(DEVICE_MINOR, true);
+
+  sc = rtems_task_create(
+    rtems_build_name('R', 'E', 'A', 'D'),
+    2,
+    RTEMS_MINIMUM_STACK_SIZE,
+    RTEMS_DEFAULT_MODES,
+    RTEMS_DEFAULT_ATTRIBUTES,
+    &ctx->reader
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_task_start(ctx->reader, reader_task, (rtems_task_argument) ctx);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  for (
+    i = 0, block_size = 64;
+    block_size <= BLOCK_SIZE;
+    ++i, block_size *= 4
+  ) {
+    test_block(ctx, &ctx->samples[i], block_size);
+  }
+
+  sc = rtems_task_delete(ctx->reader);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  mk64f12_usart_set_loopback(DEVICE_MINOR, false);
+  restore_console_mode(ctx);
+
+  printf("<TMUart01>\n");
+
+  for (i = 0; i < SAMPLE_COUNT; ++i) {
+    print_sample(&ctx->samples[i]);
+  }
+
+  printf("</TMUart01>\n");
+
+  rtems_test_assert(ctx->mismatches == 0);
+
+  rv = close(ctx->fd);
+  rtems_test_assert(rv == 0);
+}
+
+static void Init(rtems_task_argument arg)
+{
+  TEST_BEGIN();
+
+  test();
+
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_CONSOLE_DRIVER
+
+#define CONFIGURE_MAXIMUM_FILE_DESCRIPTORS 5
+
+#define CONFIGURE_MAXIMUM_TASKS 2
+
+#define CONFIGURE_INIT_TASK_INITIAL_MODES RTEMS_DEFAULT_MODES
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
@@ -0,0 +1,268 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (c) 2026 Dave Rush.  All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "tmacros.h"
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+
+#include <rtems.h>
+#include <rtems/counter.h>
+
+const char rtems_test_name[] = "TMUSEREXT 1";
+
+#define SAMPLE_COUNT 64
+
+#define SPARSE_EXTENSION_COUNT 16
+
+typedef struct {
+  uint64_t sum;
+  uint64_t max;
+} time_results;
+
+typedef struct {
+  time_results create;
+  time_results start;
+  time_results delete;
+} cycle_results;
+
+static rtems_id sparse_extensions[SPARSE_EXTENSION_COUNT];
+
+static uint32_t create_calls;
+
+static const size_t sparse_extension_steps[] = { 0, 4, 8, 16 };
+
+static bool count_create(rtems_tcb *executing, rtems_tcb *created)
+{
+  (void) executing;
+  (void) created;
+  ++create_calls;
+  return true;
+}
+
+static void sparse_fatal(
+  rtems_fatal_source source,
+  bool always_set_to_false,
+  rtems_fatal_code code
+)
+{
+  (void) source;
+  (void) always_set_to_false;
+  (void) code;
+}
+
+static void sparse_switch(rtems_tcb *executing, rtems_tcb *heir)
+{
+  (void) executing;
+  (void) heir;
+}
+
+/*
+ * The extensions of stack checkers, tracers, and the like usually implement
+ * only some of the hooks.  The thread create, start, and delete dispatch
+ * should not get slower because of them.
+ */
+static const rtems_extensions_table sparse_table = {
+  .fatal = sparse_fatal
+};
+
+static const rtems_extensions_table counting_table = {
+  .thread_create = count_create
+};
+
+#define SPARSE_INITIAL_EXTENSION { .thread_switch = sparse_switch }
+
+static void account(time_results *results, rtems_counter_ticks begin)
+{
+  uint64_t ns;
+
+  ns = rtems_counter_ticks_to_nanoseconds(
+    rtems_counter_difference(rtems_counter_read(), begin)
+  );
+  results->sum += ns;
+
+  if (ns > results->max) {
+    results->max = ns;
+  }
+}
+
+static void idle_task(rtems_task_argument arg)
+{
+  (void) arg;
+  rtems_test_assert(0);
+}
+
+static void create_start_delete(cycle_results *results)
+{
+  int i;
+
+  for (i = 0; i < SAMPLE_COUNT; ++i) {
+    rtems_counter_ticks begin;
+    rtems_status_code sc;
+    rtems_id id;
+    uint32_t calls;
+
+    calls = create_calls;
+
+    begin = rtems_counter_read();
+    sc = rtems_task_create(
+      rtems_build_name('W', 'O', 'R', 'K'),
+      RTEMS_MAXIMUM_PRIORITY - 1,
+      RTEMS_MINIMUM_STACK_SIZE,
+      RTEMS_DEFAULT_MODES,
+      RTEMS_DEFAULT_ATTRIBUTES,
+      &id
+    );
+    account(&results->create, begin);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+    rtems_test_assert(create_calls == calls + 1);
+
+    begin = rtems_counter_read();
+    sc = rtems_task_start(id, idle_task, 0);
+    account(&results->start, begin);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+    begin = rtems_counter_read();
+    sc = rtems_task_delete(id);
+    account(&results->delete, begin);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  }
+}
+
+static void print_results(const char *name, const time_results *results)
+{
+  printf(
+    "    <%s><Avg unit=\"ns\">%" PRIu64 "</Avg>"
+    "<Max unit=\"ns\">%" PRIu64 "</Max></%s>\n",
+    name,
+    results->sum / SAMPLE_COUNT,
+    results->max,
+    name
+  );
+}
+
+static void add_sparse_extensions(size_t begin, size_t end)
+{
+  size_t i;
+
+  for (i = begin; i < end; ++i) {
+    rtems_status_code sc;
+
+    sc = rtems_extension_create(
+      rtems_build_name('S', 'P', 'R', 'S'),
+      &sparse_table,
+      &sparse_extensions[i]
+    );
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  }
+}
+
+static void delete_sparse_extensions(size_t count)
+{
+  size_t i;
+
+  for (i = 0; i < count; ++i) {
+    rtems_status_code sc;
+
+    sc = rtems_extension_delete(sparse_extensions[i]);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  }
+}
+
+static void Init(rtems_task_argument arg)
+{
+  rtems_status_code sc;
+  rtems_id id;
+  size_t count;
+  size_t i;
+
+  TEST_BEGIN();
+
+  sc = rtems_extension_create(
+    rtems_build_name('C', 'N', 'T', ' '),
+    &counting_table,
+    &id
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  printf(
+    "<TMUserExt01 initialExtensions=\"%" PRIu32 "\">\n",
+    rtems_configuration_get_number_of_initial_extensions()
+  );
+
+  count = 0;
+
+  for (i = 0; i < RTEMS_ARRAY_SIZE(sparse_extension_steps); ++i) {
+    cycle_results results;
+
+    add_sparse_extensions(count, sparse_extension_steps[i]);
+    count = sparse_extension_steps[i];
+
+    memset(&results, 0, sizeof(results));
+    create_start_delete(&results);
+
+    printf("  <SparseExtensions count=\"%zu\">\n", count);
+    print_results("TaskCreate", &results.create);
+    print_results("TaskStart", &results.start);
+    print_results("TaskDelete", &results.delete);
+    printf("  </SparseExtensions>\n");
+  }
+
+  printf("</TMUserExt01>\n");
+
+  delete_sparse_extensions(count);
+
+  sc = rtems_extension_delete(id);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_DOES_NOT_NEED_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+
+#define CONFIGURE_MAXIMUM_TASKS 2
+
+#define CONFIGURE_MAXIMUM_USER_EXTENSIONS (SPARSE_EXTENSION_COUNT + 1)
+
+#define CONFIGURE_INITIAL_EXTENSIONS \
+  RTEMS_TEST_INITIAL_EXTENSION, \
+  SPARSE_INITIAL_EXTENSION, \
+  SPARSE_INITIAL_EXTENSION, \
+  SPARSE_INITIAL_EXTENSION, \
+  SPARSE_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
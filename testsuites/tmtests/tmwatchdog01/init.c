@@ -0,0 +1,254 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (c) 2026 Dave Rush.  All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "tmacros.h"
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+
+#include <rtems.h>
+#include <rtems/counter.h>
+#include <rtems/score/threaddispatch.h>
+#include <rtems/score/watchdogimpl.h>
+
+const char rtems_test_name[] = "TMWATCHDOG 1";
+
+#define WATCHDOG_MAXIMUM 1024
+
+#define TICK_COUNT 2000
+
+#define INTERVAL_MAXIMUM 1000
+
+typedef struct {
+  rtems_counter_ticks sum;
+  rtems_counter_ticks max;
+} operation_results;
+
+typedef struct {
+  uint32_t seed;
+  Watchdog_Control watchdogs[WATCHDOG_MAXIMUM];
+} test_context;
+
+static test_context test_instance;
+
+static const size_t watchdog_counts[] = { 16, 128, WATCHDOG_MAXIMUM };
+
+static Watchdog_Interval random_interval(test_context *ctx)
+{
+  ctx->seed = ctx->seed * 1103515245 + 12345;
+  return 1 + (ctx->seed >> 16) % INTERVAL_MAXIMUM;
+}
+
+static void insert(test_context *ctx, Watchdog_Control *the_watchdog)
+{
+  rtems_interrupt_level level;
+
+  rtems_interrupt_local_disable(level);
+  _Watchdog_Per_CPU_insert_ticks(
+    the_watchdog,
+    _Per_CPU_Get(),
+    random_interval(ctx)
+  );
+  rtems_interrupt_local_enable(level);
+}
+
+static void rearm(Watchdog_Control *the_watchdog)
+{
+  insert(&test_instance, the_watchdog);
+}
+
+static void set_wheel(bool enable)
+{
+  Per_CPU_Control *cpu;
+  Watchdog_Header *header;
+  rtems_interrupt_level level;
+
+  cpu = _Per_CPU_Get_by_index(0);
+  header = &cpu->Watchdog.Header[PER_CPU_WATCHDOG_TICKS];
+
+  rtems_interrupt_local_disable(level);
+
+  rtems_test_assert(_Watchdog_Header_first(header) == NULL);
+
+  if (enable) {
+    _Watchdog_Wheel_initialize(&_Watchdog_Wheels[0], cpu->Watchdog.ticks);
+    header->wheel = &_Watchdog_Wheels[0];
+  } else {
+    header->wheel = NULL;
+  }
+
+  rtems_interrupt_local_enable(level);
+}
+
+static void account(
+  operation_results *results,
+  rtems_counter_ticks a,
+  rtems_counter_ticks b
+)
+{
+  rtems_counter_ticks d;
+
+  d = rtems_counter_difference(b, a);
+  results->sum += d;
+
+  if (d > results->max) {
+    results->max = d;
+  }
+}
+
+static void print_results(
+  const char *name,
+  const operation_results *results,
+  size_t count
+)
+{
+  printf(
+    "      <%s><Avg unit=\"ns\">%" PRIu64 "</Avg>"
+    "<Max unit=\"ns\">%" PRIu64 "</Max></%s>\n",
+    name,
+    rtems_counter_ticks_to_nanoseconds(results->sum) / count,
+    rtems_counter_ticks_to_nanoseconds(results->max),
+    name
+  );
+}
+
+static void measure(test_context *ctx, const char *name, size_t count)
+{
+  Per_CPU_Control *cpu_self;
+  operation_results inserts;
+  operation_results ticks;
+  operation_results removes;
+  size_t i;
+
+  memset(&inserts, 0, sizeof(inserts));
+  memset(&ticks, 0, sizeof(ticks));
+  memset(&removes, 0, sizeof(removes));
+  ctx->seed = 0;
+
+  for (i = 0; i < count; ++i) {
+    rtems_counter_ticks a;
+    rtems_counter_ticks b;
+
+    _Watchdog_Preinitialize(&ctx->watchdogs[i], _Per_CPU_Get_by_index(0));
+    _Watchdog_Initialize(&ctx->watchdogs[i], rearm);
+
+    a = rtems_counter_read();
+    insert(ctx, &ctx->watchdogs[i]);
+    b = rtems_counter_read();
+
+    account(&inserts, a, b);
+  }
+
+  /*
+   * The expired watchdogs are inserted again, so that the count of scheduled
+   * watchdogs stays constant.  This is included in the tick time.
+   */
+  cpu_self = _Thread_Dispatch_disable();
+
+  for (i = 0; i < TICK_COUNT; ++i) {
+    rtems_counter_ticks a;
+    rtems_counter_ticks b;
+
+    a = rtems_counter_read();
+    _Watchdog_Tick(cpu_self);
+    b = rtems_counter_read();
+
+    account(&ticks, a, b);
+  }
+
+  _Thread_Dispatch_enable(cpu_self);
+
+  for (i = 0; i < count; ++i) {
+    rtems_counter_ticks a;
+    rtems_counter_ticks b;
+    rtems_interrupt_level level;
+
+    rtems_test_assert(_Watchdog_Is_scheduled(&ctx->watchdogs[i]));
+
+    rtems_interrupt_local_disable(level);
+    a = rtems_counter_read();
+    _Watchdog_Per_CPU_remove_ticks(&ctx->watchdogs[i]);
+    b = rtems_counter_read();
+    rtems_interrupt_local_enable(level);
+
+    account(&removes, a, b);
+  }
+
+  printf("    <%s>\n", name);
+  print_results("Insert", &inserts, count);
+  print_results("Tick", &ticks, TICK_COUNT);
+  print_results("Remove", &removes, count);
+  printf("    </%s>\n", name);
+}
+
+static void Init(rtems_task_argument arg)
+{
+  test_context *ctx;
+  size_t i;
+
+  ctx = &test_instance;
+
+  TEST_BEGIN();
+
+  printf("<TMWatchdog01>\n");
+
+  for (i = 0; i < RTEMS_ARRAY_SIZE(watchdog_counts); ++i) {
+    printf("  <Watchdogs count=\"%zu\">\n", watchdog_counts[i]);
+    set_wheel(false);
+    measure(ctx, "RBTree", watchdog_counts[i]);
+    set_wheel(true);
+    measure(ctx, "Wheel", watchdog_counts[i]);
+    printf("  </Watchdogs>\n");
+  }
+
+  printf("</TMWatchdog01>\n");
+
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+/* The benchmark calls _Watchdog_Tick() directly */
+#define CONFIGURE_APPLICATION_DOES_NOT_NEED_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_CONSOLE_DRIVER
+
+#define CONFIGURE_MAXIMUM_TASKS 1
+
+#define CONFIGURE_WATCHDOG_TIMING_WHEEL
+
+#define CONFIGURE_INIT_TASK_INITIAL_MODES RTEMS_DEFAULT_MODES
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>